@@ -5,6 +5,7 @@
 #include <QHash>
 #include <QList>
 #include <QPalette>
+#include <QSet>
 #include <QString>
 
 namespace DisplayThemeKeys {
@@ -131,6 +132,8 @@ bool saveDisplayThemeStore(const DisplayThemeStore &store, QString *errorText =
 QColor displayThemeColor(const DisplayTheme &theme, const QString &key);
 void setDisplayThemeColor(DisplayTheme *theme, const QString &key, const QColor &color);
 DisplayFontStyle displayThemeFontStyle(const DisplayTheme &theme, const QString &key);
+// Color and font role keys whose resolved values differ between the two themes.
+QSet<QString> changedDisplayThemeRoles(const DisplayTheme &before, const DisplayTheme &after);
 void setDisplayThemeFontStyle(DisplayTheme *theme, const QString &key, const DisplayFontStyle &style);
 QFont qFontFromDisplayFontStyle(const DisplayFontStyle &style, const QFont &fallback = QFont());
 QString styleSheetFontFragment(const DisplayFontStyle &style);
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QString>
+
+enum class LogLevel {
+    Debug,
+    Info,
+    Warning,
+    Error,
+};
+
+enum class LogCategory {
+    General,
+    Guide,
+    Zap,
+    Player,
+    Schedule,
+    Theme,
+    Signal,
+    Qt,
+};
+
+inline constexpr int kLogCategoryCount = static_cast<int>(LogCategory::Qt) + 1;
+
+// Timestamps are steady-clock nanoseconds; they are only turned into wall-clock text when written or shown.
+struct LogRecord {
+    qint64 monotonicNs{0};
+    LogCategory category{LogCategory::General};
+    LogLevel level{LogLevel::Info};
+    QString message;
+};
+
+QString resolveProjectLogPath();
+
+qint64 logMonotonicNowNs();
+QDateTime logRecordDateTime(qint64 monotonicNs);
+QString logCategoryName(LogCategory category);
+QString logLevelName(LogLevel level);
+
+bool logEnabled(LogCategory category, LogLevel level);
+void setLogThreshold(LogCategory category, LogLevel level);
+// Accepts "category=level" pairs separated by commas, e.g. "*=info,schedule=debug,player=warning".
+bool configureLogFilter(const QString &spec, QString *errorText);
+
+QString formatLogRecordText(const LogRecord &record);
+QByteArray formatLogRecordJson(const LogRecord &record);
+
+// Starts the background writer for logPath. Records appended before this call are dropped.
+// When writeJsonLines is set, every record is also written as one JSON object per line next to the log.
+bool startLogSink(const QString &logPath, bool writeJsonLines, QString *errorText);
+// Queues one record without blocking on file I/O; safe to call from any thread.
+void appendLogSinkRecord(LogRecord record);
+// Blocks until every record queued before the call has been written.
+void flushLogSink();
+void stopLogSink();
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "DisplayTheme.h"
+#include "LogSink.h"
+#include "ScheduledSwitchQueue.h"
 #include "TvGuideDialog.h"
 
 #include <QByteArray>
+#include <QFuture>
 #include <QKeySequence>
 #include <QMainWindow>
 #include <QMediaPlayer>
@@ -12,6 +15,9 @@
 #include <QList>
 #include <QSet>
 
+#include <functional>
+#include <memory>
+
 class QComboBox;
 class QDialog;
 class QFontComboBox;
@@ -20,9 +26,9 @@ class QKeyEvent;
 class QKeySequenceEdit;
 class QLineEdit;
 class QPushButton;
-class QPlainTextEdit;
+class QListView;
 class QShortcut;
-class QTableWidget;
+class QTableView;
 class QSpinBox;
 class QAudioOutput;
 class QVideoWidget;
@@ -41,6 +47,8 @@ class QVBoxLayout;
 class QCheckBox;
 class QSpinBox;
 class QGroupBox;
+class QJsonObject;
+class SchedulesDirectClient;
 
 class MainWindow : public QMainWindow
 {
@@ -106,11 +114,46 @@ private:
         QCheckBox *italic{};
         QCheckBox *underline{};
     };
+    struct ChannelTableRow {
+        QString number;
+        QString label;
+        QString rawLine;
+        QString show;
+        QString nextShow;
+        QDateTime showChangesUtc;
+    };
+    class LogLinesModel;
+    class ChannelListModel;
+    struct GuideCacheFileData;
+    struct GuideCachePruneWrite;
+    struct StartupStoreResult;
+    struct GuideChannelIndex;
+    struct FavoriteShowIndex;
+    struct SchedulesDirectSync;
+    struct SchedulesDirectSyncResult;
+    using GuideRefreshCallback = std::function<void(bool refreshed)>;
+    using SchedulesDirectSyncCallback = std::function<void(const SchedulesDirectSyncResult &result)>;
+    enum class StartupStore {
+        ChannelHints,
+        Channels,
+        ScheduledSwitches,
+        GuideCache,
+    };
 
     static constexpr int kQuickFavoriteCount = 10;
 
     void buildUi();
+    // Display Options, Key Bindings and Testing/bugs start as empty pages and are filled on first activation.
+    void ensureTabPageBuilt(QWidget *page);
+    void buildTvGuidePage();
+    void buildMetaManagementPage();
+    void buildLogsPage();
+    void buildDisplayOptionsPage();
+    void buildKeyBindingsPage();
+    void buildTestingBugsPage();
     void applyDisplayTheme(bool persistCurrentTheme);
+    void applyDisplayThemeWidgetFonts(QWidget *root);
+    void applyDisplayThemeWidgetFonts(QWidget *root, const QSet<QString> &fontRoles);
     void syncConfigGroupBoxHeights();
     void refreshDisplayThemeControls();
     void refreshSavedDisplayThemeList(const QString &preferredSelection = QString());
@@ -126,9 +169,36 @@ private:
     void updateDisplayThemeColorButton(const QString &roleKey);
     void setScanningState(bool running);
     void appendLog(const QString &line);
+    void appendLogRecord(LogCategory category, LogLevel level, const QString &message);
+    // Builds the message only when the category/level passes the runtime log filter.
+    template <typename MessageBuilder>
+    void logRecord(LogCategory category, LogLevel level, MessageBuilder &&buildMessage)
+    {
+        if (logEnabled(category, level)) {
+            appendLogRecord(category, level, buildMessage());
+        }
+    }
+    void scheduleLogViewFlush();
+    void flushLogView();
+    void copySelectedLogLines() const;
+    void completeStartupTrace();
     // Keep user/program behavior observable: new interaction paths should log entry and outcome here.
-    void logInteraction(const QString &actor, const QString &action, const QString &details = QString());
+    void logInteraction(const QString &actor,
+                        const QString &action,
+                        const QString &details = QString(),
+                        LogLevel level = LogLevel::Info);
+    template <typename DetailsBuilder>
+    void logInteractionLazy(const QString &actor, const QString &action, LogLevel level, DetailsBuilder &&buildDetails)
+    {
+        if (logEnabled(interactionLogCategory(action), level)) {
+            logInteraction(actor, action, buildDetails(), level);
+        }
+    }
+    static LogCategory interactionLogCategory(const QString &action);
     void parseAndStoreLine(const QString &line);
+    // Parsed rows are queued and inserted in one batch at most once per frame.
+    void scheduleChannelTableFlush();
+    void flushPendingChannelRows();
     bool persistChannelsFile();
     bool startWatchingChannel(const QString &channelName,
                               bool reconnectAttempt = false,
@@ -136,11 +206,23 @@ private:
     void refreshQuickButtons();
     void saveFavorites();
     void loadFavorites();
-    void loadXspfChannelHints();
     void loadChannelsFileIfPresent();
+    void applyChannelsFileLines(const QString &channelsFilePath, const QStringList &lines);
+    // Startup reads the channel hints, channels.conf, scheduled switches and guide cache on worker threads;
+    // the channel table is filled from the startup snapshot until the real stores arrive.
+    static StartupStoreResult loadStartupStore(StartupStore store, int guideRetentionHours);
+    void startStartupStoreLoads();
+    void applyStartupStoreResult(const StartupStoreResult &result);
+    void finishStartupStoreLoads();
+    void resumeStartupAfterStoresLoaded();
+    void restoreStartupPlayback();
+    bool applyStartupSnapshot();
+    void saveStartupSnapshot();
     void startPlaybackFromDvr(const QString &dvrPath);
-    bool refreshGuideData(bool interactive, bool updateDialog);
-    bool refreshGuideDataFromSchedulesDirect(bool interactive, bool updateDialog);
+    void refreshGuideData(bool interactive, bool updateDialog, GuideRefreshCallback onFinished = {});
+    bool refreshGuideDataFromBroadcast(bool interactive, bool updateDialog);
+    void refreshGuideDataFromSchedulesDirect(bool interactive, bool updateDialog, GuideRefreshCallback onFinished);
+    bool applySchedulesDirectGuideRefresh(bool updateDialog, const SchedulesDirectSyncResult &result);
     bool writeGuideCacheFile(const QStringList &channelOrder,
                              const QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
                              const QDateTime &windowStartUtc,
@@ -148,6 +230,18 @@ private:
                              int slotCount,
                              const QString &statusText);
     bool loadGuideCacheFile();
+    static bool readGuideCacheFile(const QString &cachePath,
+                                   const QDateTime &nowUtc,
+                                   int retentionHours,
+                                   GuideCacheFileData *data);
+    void applyGuideCacheFileData(const GuideCacheFileData &data);
+    // Entries dropped by retention while loading are persisted later, off the GUI thread.
+    void scheduleGuideCachePruneWrite(const GuideCacheFileData &data);
+    void invalidateGuideChannelIndex();
+    GuideChannelIndex &guideChannelIndex();
+    void invalidateFavoriteShowIndex();
+    FavoriteShowIndex &favoriteShowIndex();
+    void writePrunedGuideCacheInBackground();
     void scheduleReconnect(const QString &reason);
     bool tryDynamicBridgeFallback(const QString &reason);
     QString playbackStatusText() const;
@@ -168,8 +262,16 @@ private:
     void setSignalMonitorStatus(const QString &text, const QString &toolTip = QString());
     void setStatusBarStateMessage(const QString &text);
     void showTransientStatusBarMessage(const QString &text, int timeoutMs = 3000);
-    QString channelTableShowText(const QString &channelName) const;
+    QString channelTableShowText(const QString &channelName,
+                                 const QDateTime &nowUtc,
+                                 QString *nextShow,
+                                 QDateTime *changesUtc) const;
+    void rebuildChannelShowGuideIndex();
+    // Recomputes every row after the guide changes; rows otherwise update only at their next program boundary.
     void refreshChannelTableShowColumn();
+    void refreshDueChannelTableShows();
+    void updateChannelTableShows(bool dueRowsOnly);
+    void scheduleChannelShowBoundaryRefresh();
     void updateTvGuideDialogFromCurrentCache(bool showStatusMessage = false);
     QStringList makeArguments() const;
     QString selectedChannelNameFromTable() const;
@@ -211,8 +313,9 @@ private:
     void restoreLastPlayedChannel();
     void handleGuideScheduleToggle(const QString &channelName, const TvGuideEntry &entry, bool enabled);
     void handleObeyScheduledSwitchesChanged(bool obey);
-    bool saveScheduledSwitches() const;
-    bool loadScheduledSwitches();
+    bool saveScheduledSwitches();
+    void compactScheduledSwitchesInBackground();
+    void applyLoadedScheduledSwitches(const QList<TvGuideScheduledSwitch> &loadedSwitches);
     bool pruneExpiredScheduledSwitches(bool includeStartedSwitches = false);
     bool hasActiveScheduledSwitchesNow() const;
     void refreshScheduledSwitchTimer();
@@ -230,10 +333,21 @@ private:
     bool refreshGuideWhenCacheRunsOutEnabled() const;
     bool maybeRefreshGuideWhenCacheRunsOut(bool updateDialog);
     void updateSchedulesDirectControls();
-    bool ensureSchedulesDirectJson(bool allowCachedExport,
-                                   bool *usedCachedExport,
-                                   QString *summary,
-                                   QString *errorText);
+    void startSchedulesDirectSync(bool allowCachedExport, SchedulesDirectSyncCallback onFinished);
+    void fetchSchedulesDirectAccountStatus();
+    void fetchSchedulesDirectHeadends();
+    void syncNextSchedulesDirectLineup();
+    void fetchSchedulesDirectLineup();
+    void fetchSchedulesDirectScheduleMd5s();
+    void fetchSchedulesDirectSchedules();
+    void fetchSchedulesDirectPrograms();
+    void finishSchedulesDirectLineup();
+    void finishSchedulesDirectSync();
+    void failSchedulesDirectSync(const QString &failureSummary, const QString &details);
+    void completeSchedulesDirectSync(const SchedulesDirectSyncResult &result);
+    SchedulesDirectSyncResult cachedSchedulesDirectExportResult(const QString &reason);
+    void cancelSchedulesDirectSync();
+    void setSchedulesDirectSyncStatus(const QString &text, const QString &statusBarText = QString());
     void loadTestingBugItems();
     void saveTestingBugItems() const;
     bool addTestingBugItemEntry(const QString &text, bool checked);
@@ -255,7 +369,9 @@ private:
     bool shouldDetachVideoForCurrentTab(int index) const;
     void detachVideoToPip();
     void attachVideoFromPip();
-    bool applySchedulesDirectGuideFallback(QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
+    bool applySchedulesDirectGuideFallback(const QJsonObject &rootObject,
+                                           const QString &exportPath,
+                                           QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
                                            int retentionHours,
                                            const QDateTime &nowUtc,
                                            QDateTime *latestEndUtc,
@@ -268,7 +384,7 @@ private:
                                                  QDateTime *latestEndUtc = nullptr) const;
     void applyGuideFilterSettings();
     void applyGuideRefreshIntervalSetting();
-    bool purgeExpiredGuideCacheFiles(bool clearLoadedState, bool includeSchedulesDirect = false);
+    bool purgeExpiredSchedulesDirectExports();
     void clearLoadedGuideCache();
     void loadKeyBindings();
     void applyKeyBindings();
@@ -299,8 +415,10 @@ private:
     QPushButton *muteButton_{};
     QPushButton *fullscreenButton_{};
     QPushButton *pipToggleButton_{};
-    QPlainTextEdit *logOutput_{};
-    QTableWidget *channelsTable_{};
+    QListView *logOutput_{};
+    LogLinesModel *logLinesModel_{};
+    QTableView *channelsTable_{};
+    ChannelListModel *channelsModel_{};
     QVideoWidget *videoWidget_{};
     QVideoWidget *pipVideoWidget_{};
     QWidget *fullscreenWindow_{};
@@ -366,8 +484,17 @@ private:
     QTabWidget *tabs_{};
     QWidget *watchPage_{};
     QWidget *configPage_{};
+    QWidget *tvGuidePage_{};
+    QWidget *metaManagementPage_{};
+    QWidget *logsPage_{};
     QWidget *displayOptionsPage_{};
     QWidget *keyBindingsPage_{};
+    QWidget *testingBugsPage_{};
+    bool metaManagementPageBuilt_{false};
+    bool logsPageBuilt_{false};
+    bool displayOptionsPageBuilt_{false};
+    bool keyBindingsPageBuilt_{false};
+    bool testingBugsPageBuilt_{false};
     QGroupBox *configGuideOptionsGroup_{};
     QGroupBox *configPlaybackOptionsGroup_{};
     QGroupBox *configCacheOptionsGroup_{};
@@ -384,11 +511,10 @@ private:
     QProcess *signalMonitorProcess_{};
     QMediaPlayer *mediaPlayer_{};
     QAudioOutput *audioOutput_{};
-    QString partialStdOut_;
-    QString partialStdErr_;
+    QByteArray partialStdOut_;
+    QByteArray partialStdErr_;
     QString partialSignalMonitorOutput_;
     QString channelsFilePath_;
-    QString logFilePath_;
     QStringList channelLines_;
     QStringList favorites_;
     QStringList favoriteShowRules_;
@@ -441,19 +567,46 @@ private:
     QTimer *playbackAttachTimer_{};
     QTimer *guideRefreshTimer_{};
     QTimer *guideCachePollTimer_{};
+    QTimer *guideCachePruneWriteTimer_{};
     QTimer *scheduledSwitchTimer_{};
     QTimer *fullscreenCursorHideTimer_{};
     QTimer *audioRecoveryUnmuteTimer_{};
+    QTimer *logViewFlushTimer_{};
+    QTimer *channelTableFlushTimer_{};
+    QTimer *channelShowBoundaryTimer_{};
+    QHash<QString, QList<TvGuideEntry>> channelShowGuideIndex_;
+    QList<LogRecord> pendingLogRecords_;
+    QList<ChannelTableRow> pendingChannelRows_;
+    QMetaObject::Connection startupFirstFrameConnection_;
+    bool startupFirstWindowRecorded_{false};
     TvGuideDialog *tvGuideDialog_{};
     int currentShowLookupSerial_{0};
     int playbackStartSerial_{0};
-    QList<TvGuideScheduledSwitch> scheduledSwitches_;
+    ScheduledSwitchQueue scheduledSwitches_;
     bool obeyScheduledSwitches_{true};
     bool videoDetachedToPip_{false};
     bool autoFavoriteShowSchedulingEnabled_{true};
     bool favoriteShowRatingsOverrideEnabled_{false};
     bool autoPictureInPictureEnabled_{true};
     bool deferStartupAutoFavoriteScheduling_{true};
+    int pendingStartupStoreLoads_{0};
+    bool startupSnapshotApplied_{false};
+    bool startupChannelHintsReady_{false};
+    bool startupChannelsReady_{false};
+    QString pendingStartupChannelsFilePath_;
+    QStringList pendingStartupChannelLines_;
+    std::shared_ptr<const GuideCachePruneWrite> pendingGuideCachePrune_;
+    QString loadedGuideCacheFileStamp_;
+    QFuture<void> guideCachePruneWrite_;
+    QFuture<bool> scheduledSwitchCompaction_;
+    int scheduledSwitchJournalEntries_{0};
+    bool scheduledSwitchesLoaded_{false};
+    bool scheduledSwitchCompactionPending_{false};
+    std::unique_ptr<SchedulesDirectSync> schedulesDirectSync_;
+    std::unique_ptr<GuideChannelIndex> guideChannelIndex_;
+    quint64 guideChannelIndexGeneration_{0};
+    std::unique_ptr<FavoriteShowIndex> favoriteShowIndex_;
+    quint64 favoriteShowIndexGeneration_{0};
     QString currentShowOverlayToolTip_;
     QString signalMonitorOverlayToolTip_;
     QStringList dismissedAutoFavoriteCandidates_;
@@ -474,7 +627,11 @@ private:
     QAction *aboutAction_{};
     DisplayTheme defaultDisplayTheme_;
     DisplayTheme currentDisplayTheme_;
+    // Last theme pushed to the widgets, used to restyle only the groups whose roles changed.
+    DisplayTheme appliedDisplayTheme_;
+    bool displayThemeApplied_{false};
     DisplayThemeStore displayThemeStore_;
     QString pendingDisplayThemeLoadError_;
+    QString displayThemeStatusText_;
     bool syncingDisplayThemeUi_{false};
 };
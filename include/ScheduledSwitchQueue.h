@@ -0,0 +1,65 @@
+#pragma once
+
+#include "TvGuideDialog.h"
+
+#include <QDateTime>
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QString>
+
+#include <utility>
+
+// Pending scheduled switches ordered by effective start, with membership by scheduled-switch key. Callers pass
+// normalized switches together with their key; an empty key or an empty interval is rejected. Every insert and
+// remove is also recorded in a journal that the owner drains with takeJournal() to persist incrementally.
+//
+// Interval queries scan the start order back by the longest queued duration only, so they cost O(log n + k) for
+// guide-length switches.
+class ScheduledSwitchQueue
+{
+public:
+    struct JournalEntry {
+        bool added{false};
+        QString key;
+        TvGuideScheduledSwitch scheduledSwitch;
+    };
+
+    bool isEmpty() const;
+    int size() const;
+    bool contains(const QString &key) const;
+    TvGuideScheduledSwitch value(const QString &key) const;
+
+    // Returns false when the key is empty or already queued.
+    bool insert(const QString &key, const TvGuideScheduledSwitch &scheduledSwitch);
+    // Same as insert() but not journaled, for switches read back from disk.
+    bool restore(const QString &key, const TvGuideScheduledSwitch &scheduledSwitch);
+    bool remove(const QString &key);
+    void clear();
+
+    const TvGuideScheduledSwitch &first() const;
+    // Ordered by start, then key; the list is cached until the next change.
+    const QList<TvGuideScheduledSwitch> &items() const;
+    // Switches whose start is at or before nowUtc, in start order.
+    QList<TvGuideScheduledSwitch> startedBy(const QDateTime &nowUtc) const;
+    QList<TvGuideScheduledSwitch> startingAt(const QDateTime &startUtc) const;
+    // Every switch sharing the earliest start after afterUtc.
+    QList<TvGuideScheduledSwitch> nextStartingAfter(const QDateTime &afterUtc) const;
+    // Switches whose [start, end) overlaps [startUtc, endUtc), in start order.
+    QList<TvGuideScheduledSwitch> overlapping(const QDateTime &startUtc, const QDateTime &endUtc) const;
+    QList<TvGuideScheduledSwitch> activeAt(const QDateTime &atUtc) const;
+
+    QList<JournalEntry> takeJournal();
+
+private:
+    using OrderKey = std::pair<qint64, QString>;
+
+    bool insertEntry(const QString &key, const TvGuideScheduledSwitch &scheduledSwitch);
+
+    QMap<OrderKey, TvGuideScheduledSwitch> entries_;
+    QHash<QString, qint64> startByKey_;
+    QMap<qint64, int> durationCounts_;
+    QList<JournalEntry> journal_;
+    mutable QList<TvGuideScheduledSwitch> itemsCache_;
+    mutable bool itemsCacheValid_{true};
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QJsonDocument>
+#include <QList>
+#include <QObject>
+#include <QString>
+#include <QUrl>
+
+#include <functional>
+
+class QNetworkAccessManager;
+class QNetworkReply;
+class QTimer;
+
+// Asynchronous Schedules Direct JSON client. Requests are queued and up to maxConcurrentRequests() of them are
+// kept in flight; transient failures (timeouts, connection errors, HTTP 429 and 5xx) are retried with
+// exponential backoff.
+class SchedulesDirectClient : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Request {
+        QUrl url;
+        QJsonDocument body;
+        QByteArray method;
+        int timeoutMs{15000};
+    };
+
+    struct Reply {
+        QJsonDocument document;
+        QByteArray body;
+        QString errorText;
+        int httpStatus{0};
+        bool timedOut{false};
+        bool cancelled{false};
+
+        bool ok() const
+        {
+            return errorText.trimmed().isEmpty() && !timedOut && !cancelled && httpStatus >= 200
+                   && httpStatus < 300;
+        }
+    };
+
+    using Callback = std::function<void(const Reply &reply)>;
+
+    explicit SchedulesDirectClient(const QString &userAgent, QObject *parent = nullptr);
+    ~SchedulesDirectClient() override;
+
+    void setToken(const QString &token);
+    void setMaxConcurrentRequests(int limit);
+    int maxConcurrentRequests() const;
+    void setMaxRetries(int retries);
+
+    // The callback runs on the client's thread once the request has succeeded, failed for good or been cancelled.
+    void enqueue(const Request &request, Callback callback);
+    // Aborts requests in flight and drops queued ones; their callbacks see Reply::cancelled.
+    void cancel();
+    bool isIdle() const;
+
+    qint64 bytesReceived() const;
+
+signals:
+    void progress(int finishedRequests, int totalRequests, qint64 bytesReceived);
+    void idle();
+
+private:
+    struct PendingRequest {
+        Request request;
+        Callback callback;
+        int attempt{0};
+    };
+
+    void startQueuedRequests();
+    void startRequest(PendingRequest pending);
+    void handleReplyFinished(QNetworkReply *reply);
+    void finishRequest(const PendingRequest &pending, const Reply &reply);
+    void checkIdle();
+    static bool shouldRetry(const Reply &reply);
+
+    QNetworkAccessManager *networkManager_{};
+    QString userAgent_;
+    QString token_;
+    QList<PendingRequest> queue_;
+    QHash<QNetworkReply *, PendingRequest> inFlight_;
+    QHash<QNetworkReply *, QTimer *> timeoutTimers_;
+    QHash<QNetworkReply *, bool> timedOutReplies_;
+    // Requests waiting out a retry delay, by backoff id; cancel() finishes them with Reply::cancelled.
+    QHash<quint64, PendingRequest> backingOff_;
+    int maxConcurrentRequests_{4};
+    int maxRetries_{3};
+    int finishedRequests_{0};
+    int totalRequests_{0};
+    qint64 bytesReceived_{0};
+    quint64 nextBackoffId_{0};
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <QString>
+
+// Records startup stages on the GUI thread until finishStartupTrace() is called.
+void beginStartupTrace();
+void markStartupMilestone(const QString &name);
+bool startupTraceFinished();
+// Returns a one-line summary for the log and writes the Chrome trace file when one was requested.
+QString finishStartupTrace();
+bool exportStartupTraceJson(const QString &path, QString *errorText);
+
+class StartupTraceScope
+{
+public:
+    explicit StartupTraceScope(const char *name);
+    ~StartupTraceScope();
+
+    StartupTraceScope(const StartupTraceScope &) = delete;
+    StartupTraceScope &operator=(const StartupTraceScope &) = delete;
+
+private:
+    const char *name_;
+    qint64 startNs_;
+};
@@ -9,6 +9,8 @@
 #include <QStringList>
 #include <QWidget>
 
+#include <memory>
+
 class QPlainTextEdit;
 class QPushButton;
 class QResizeEvent;
@@ -18,9 +20,11 @@ class QTimer;
 class QWidget;
 class QLineEdit;
 class QLabel;
-class QListWidget;
+class QListView;
 class QObject;
 class QEvent;
+template <typename T>
+class QFutureWatcher;
 
 struct TvGuideEntry {
     QDateTime startUtc;
@@ -77,30 +81,44 @@ private:
     struct SearchResult {
         QString channelName;
         TvGuideEntry entry;
-        QString ratedTitle;
-        QString episodeTitle;
-        QString synopsisBody;
-        QString timeChannelText;
-        QString toolTip;
         QString normalizedHaystack;
         bool isFavorite{false};
     };
 
+    // Immutable once built; shared between the dialog and the results model.
+    struct SearchIndex {
+        QList<SearchResult> results;
+        QHash<quint64, QList<int>> trigramPostings;
+        quint64 generation{0};
+    };
+
+    class SearchResultsModel;
+
     QString entryLabel(const TvGuideEntry &entry) const;
     QString entryToolTip(const TvGuideEntry &entry) const;
     bool channelHasVisibleData(const QString &channel) const;
     int guideSlotPixelWidth() const;
     void scrollGuideToCurrentTime(bool force);
-    void rebuildSearchIndex();
+    static std::shared_ptr<const SearchIndex> buildSearchIndex(const QStringList &channelOrder,
+                                                               const QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
+                                                               const QHash<QString, int> &favoriteShowRatings,
+                                                               quint64 generation);
+    static QList<int> findSearchMatches(const SearchIndex &index, const QString &normalizedQuery);
+    static void runSearchBenchmark(int entryCount);
+    void requestSearchIndexBuild();
+    void startSearchIndexBuild();
+    void handleSearchIndexBuilt();
     void updateSearchResults();
     void updateSearchActionState();
-    bool searchResultIsCurrent(const SearchResult &result) const;
+    void rememberSearchSelection();
+    const SearchResult *searchResultAtRow(int row) const;
     void scheduleSelectedSearchResult();
     void renderGuideTable();
 
     QLineEdit *showSearchEdit_{};
     QLabel *showSearchSummaryLabel_{};
-    QListWidget *showSearchResultsList_{};
+    QListView *showSearchResultsList_{};
+    SearchResultsModel *searchResultsModel_{};
     QTimer *searchUpdateTimer_{};
     QPlainTextEdit *logsView_{};
     QPushButton *refreshButton_{};
@@ -119,7 +137,12 @@ private:
     bool hideChannelsWithoutEitData_{false};
     bool showFavoritesOnly_{false};
     bool pendingSyncToCurrentTime_{false};
-    QList<SearchResult> searchIndex_;
-    QList<SearchResult> searchResults_;
+    std::shared_ptr<const SearchIndex> searchIndex_;
+    QFutureWatcher<std::shared_ptr<const SearchIndex>> *searchIndexWatcher_{};
+    quint64 searchIndexGeneration_{0};
+    bool searchIndexRebuildQueued_{false};
+    bool searchIndexStale_{true};
+    SearchResult searchSelection_;
+    bool hasSearchSelection_{false};
     DisplayTheme displayTheme_;
 };
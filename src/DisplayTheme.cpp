@@ -302,6 +302,12 @@ DisplayFontStyle normalizedFontStyle(const DisplayFontStyle &candidate, const Di
     return style;
 }
 
+bool sameFontStyle(const DisplayFontStyle &left, const DisplayFontStyle &right)
+{
+    return left.family == right.family && left.pointSize == right.pointSize && left.bold == right.bold
+           && left.italic == right.italic && left.underline == right.underline;
+}
+
 } // namespace
 
 QList<DisplayColorRoleSpec> displayColorRoleSpecs()
@@ -507,6 +513,24 @@ DisplayFontStyle displayThemeFontStyle(const DisplayTheme &theme, const QString
     return normalized.fonts.value(key);
 }
 
+QSet<QString> changedDisplayThemeRoles(const DisplayTheme &before, const DisplayTheme &after)
+{
+    const DisplayTheme normalizedBefore = normalizedDisplayTheme(before);
+    const DisplayTheme normalizedAfter = normalizedDisplayTheme(after);
+    QSet<QString> changed;
+    for (const DisplayColorRoleSpec &spec : displayColorSpecsStorage()) {
+        if (normalizedBefore.colors.value(spec.key) != normalizedAfter.colors.value(spec.key)) {
+            changed.insert(spec.key);
+        }
+    }
+    for (const DisplayFontRoleSpec &spec : displayFontSpecsStorage()) {
+        if (!sameFontStyle(normalizedBefore.fonts.value(spec.key), normalizedAfter.fonts.value(spec.key))) {
+            changed.insert(spec.key);
+        }
+    }
+    return changed;
+}
+
 void setDisplayThemeFontStyle(DisplayTheme *theme, const QString &key, const DisplayFontStyle &style)
 {
     if (theme == nullptr) {
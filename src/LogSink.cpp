@@ -0,0 +1,606 @@
+#include "LogSink.h"
+
+#include <QDir>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QStringList>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr auto kLogFlushInterval = std::chrono::milliseconds(200);
+constexpr auto kLogFlushWaitTimeout = std::chrono::seconds(2);
+constexpr qsizetype kLogFlushThresholdBytes = 64 * 1024;
+constexpr int kLogMaxBatchLines = 64;
+constexpr qint64 kDefaultLogMaxBytes = 8LL * 1024 * 1024;
+constexpr int kLogRotationKeepCount = 3;
+
+qint64 configuredLogMaxBytes()
+{
+    bool ok = false;
+    const qint64 value = qEnvironmentVariable("TV_TUNER_GUI_LOG_MAX_BYTES").trimmed().toLongLong(&ok);
+    return ok && value > 0 ? value : kDefaultLogMaxBytes;
+}
+
+QString jsonLinesPathForLog(const QString &logPath)
+{
+    if (logPath.endsWith(".log")) {
+        return logPath.left(logPath.size() - 4) + ".jsonl";
+    }
+    return logPath + ".jsonl";
+}
+
+struct LogClockAnchor {
+    qint64 monotonicNs{0};
+    qint64 wallClockMs{0};
+};
+
+const LogClockAnchor &logClockAnchor()
+{
+    static const LogClockAnchor anchor{logMonotonicNowNs(), QDateTime::currentMSecsSinceEpoch()};
+    return anchor;
+}
+
+std::array<std::atomic<int>, kLogCategoryCount> &logThresholds()
+{
+    static std::array<std::atomic<int>, kLogCategoryCount> thresholds;
+    static const bool initialized = []() {
+        for (std::atomic<int> &threshold : thresholds) {
+            threshold.store(static_cast<int>(LogLevel::Info), std::memory_order_relaxed);
+        }
+        return true;
+    }();
+    Q_UNUSED(initialized);
+    return thresholds;
+}
+
+bool logLevelFromName(const QString &name, LogLevel *level)
+{
+    const QString normalized = name.trimmed().toLower();
+    if (normalized == "debug") {
+        *level = LogLevel::Debug;
+    } else if (normalized == "info") {
+        *level = LogLevel::Info;
+    } else if (normalized == "warn" || normalized == "warning") {
+        *level = LogLevel::Warning;
+    } else if (normalized == "error" || normalized == "crit" || normalized == "critical") {
+        *level = LogLevel::Error;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+struct LogNode {
+    std::atomic<LogNode *> next{nullptr};
+    LogRecord record;
+};
+
+// Producers push with a single atomic exchange; only the writer thread pops.
+class LogQueue
+{
+public:
+    LogQueue()
+        : head_(&stub_)
+        , tail_(&stub_)
+    {
+    }
+
+    ~LogQueue()
+    {
+        LogRecord ignored;
+        while (pop(&ignored)) {
+        }
+        if (tail_ != &stub_) {
+            delete tail_;
+        }
+    }
+
+    void push(LogNode *node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        LogNode *previous = head_.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    bool pop(LogRecord *record)
+    {
+        LogNode *tail = tail_;
+        LogNode *next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        tail_ = next;
+        *record = std::move(next->record);
+        if (tail != &stub_) {
+            delete tail;
+        }
+        return true;
+    }
+
+    bool empty() const
+    {
+        return tail_->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    LogNode stub_;
+    std::atomic<LogNode *> head_;
+    LogNode *tail_;
+};
+
+// An append-only descriptor that rotates itself to .1/.2/.3 once it grows past maxBytes.
+class LogFile
+{
+public:
+    ~LogFile()
+    {
+        close();
+    }
+
+    void setPath(const QString &path, qint64 maxBytes)
+    {
+        path_ = QFile::encodeName(path);
+        maxBytes_ = maxBytes;
+    }
+
+    bool isConfigured() const
+    {
+        return !path_.isEmpty();
+    }
+
+    bool open()
+    {
+        fd_ = ::open(path_.constData(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0664);
+        if (fd_ < 0) {
+            return false;
+        }
+        struct stat info {};
+        bytes_ = ::fstat(fd_, &info) == 0 ? static_cast<qint64>(info.st_size) : 0;
+        return true;
+    }
+
+    void close()
+    {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    void write(const std::vector<QByteArray> &batch)
+    {
+        if (batch.empty()) {
+            return;
+        }
+
+        qint64 batchBytes = 0;
+        for (const QByteArray &line : batch) {
+            batchBytes += line.size();
+        }
+        if (bytes_ > 0 && bytes_ + batchBytes > maxBytes_) {
+            rotate();
+        }
+        if (fd_ < 0 && !open()) {
+            return;
+        }
+
+        std::vector<iovec> vectors;
+        vectors.reserve(batch.size());
+        for (const QByteArray &line : batch) {
+            vectors.push_back({const_cast<char *>(line.constData()), static_cast<size_t>(line.size())});
+        }
+
+        std::size_t index = 0;
+        while (index < vectors.size()) {
+            const ssize_t written = ::writev(fd_, vectors.data() + index, static_cast<int>(vectors.size() - index));
+            if (written <= 0) {
+                // Reopen on the next batch rather than spinning on a broken descriptor.
+                close();
+                return;
+            }
+            bytes_ += written;
+            std::size_t remaining = static_cast<std::size_t>(written);
+            while (index < vectors.size() && remaining >= vectors[index].iov_len) {
+                remaining -= vectors[index].iov_len;
+                ++index;
+            }
+            if (index < vectors.size()) {
+                vectors[index].iov_base = static_cast<char *>(vectors[index].iov_base) + remaining;
+                vectors[index].iov_len -= remaining;
+            }
+        }
+    }
+
+private:
+    void rotate()
+    {
+        close();
+        for (int generation = kLogRotationKeepCount - 1; generation >= 1; --generation) {
+            const QByteArray from = path_ + '.' + QByteArray::number(generation);
+            const QByteArray to = path_ + '.' + QByteArray::number(generation + 1);
+            ::rename(from.constData(), to.constData());
+        }
+        const QByteArray firstBackup = path_ + ".1";
+        ::rename(path_.constData(), firstBackup.constData());
+        open();
+    }
+
+    QByteArray path_;
+    int fd_{-1};
+    qint64 bytes_{0};
+    qint64 maxBytes_{kDefaultLogMaxBytes};
+};
+
+class AsyncLogSink
+{
+public:
+    ~AsyncLogSink()
+    {
+        stop();
+    }
+
+    bool start(const QString &logPath, bool writeJsonLines, QString *errorText)
+    {
+        if (running_.load(std::memory_order_acquire)) {
+            return true;
+        }
+
+        const qint64 maxBytes = configuredLogMaxBytes();
+        textFile_.setPath(logPath, maxBytes);
+        if (!textFile_.open()) {
+            if (errorText != nullptr) {
+                *errorText = QString("failed to open log file for append: %1").arg(logPath);
+            }
+            return false;
+        }
+        if (writeJsonLines) {
+            const QString jsonPath = jsonLinesPathForLog(logPath);
+            jsonFile_.setPath(jsonPath, maxBytes);
+            if (!jsonFile_.open() && errorText != nullptr) {
+                *errorText = QString("failed to open JSON log file for append: %1").arg(jsonPath);
+            }
+        }
+
+        stopping_ = false;
+        running_.store(true, std::memory_order_release);
+        writer_ = std::thread([this]() { run(); });
+        return true;
+    }
+
+    void append(LogRecord record)
+    {
+        if (!running_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        auto *node = new LogNode;
+        const qsizetype size = record.message.size() * qsizetype(sizeof(QChar));
+        node->record = std::move(record);
+        queue_.push(node);
+        enqueuedCount_.fetch_add(1, std::memory_order_release);
+        if (pendingBytes_.fetch_add(size, std::memory_order_relaxed) + size >= kLogFlushThresholdBytes) {
+            wake();
+        }
+    }
+
+    void flush()
+    {
+        if (!running_.load(std::memory_order_acquire) || std::this_thread::get_id() == writer_.get_id()) {
+            return;
+        }
+
+        const quint64 target = enqueuedCount_.load(std::memory_order_acquire);
+        quint64 requested = flushTarget_.load(std::memory_order_relaxed);
+        while (requested < target
+               && !flushTarget_.compare_exchange_weak(requested, target, std::memory_order_acq_rel)) {
+        }
+        wake();
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        writtenCondition_.wait_for(lock, kLogFlushWaitTimeout, [this, target]() {
+            return writtenCount_.load(std::memory_order_acquire) >= target
+                   || !running_.load(std::memory_order_acquire);
+        });
+    }
+
+    void stop()
+    {
+        if (!running_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wakeCondition_.notify_one();
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+        running_.store(false, std::memory_order_release);
+        textFile_.close();
+        jsonFile_.close();
+    }
+
+private:
+    void wake()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            wakeRequested_ = true;
+        }
+        wakeCondition_.notify_one();
+    }
+
+    bool flushPending() const
+    {
+        return writtenCount_.load(std::memory_order_acquire) < flushTarget_.load(std::memory_order_acquire);
+    }
+
+    void run()
+    {
+        for (;;) {
+            bool stopping = false;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeCondition_.wait_for(lock, kLogFlushInterval, [this]() {
+                    return stopping_ || wakeRequested_;
+                });
+                wakeRequested_ = false;
+                stopping = stopping_;
+            }
+
+            drainQueue();
+            // A producer may have swapped the head but not linked its node yet; finish the flush it is part of.
+            while (flushPending()) {
+                std::this_thread::yield();
+                drainQueue();
+            }
+
+            if (stopping && queue_.empty()) {
+                return;
+            }
+        }
+    }
+
+    void drainQueue()
+    {
+        std::vector<QByteArray> textBatch;
+        std::vector<QByteArray> jsonBatch;
+        textBatch.reserve(kLogMaxBatchLines);
+        const bool writeJson = jsonFile_.isConfigured();
+        if (writeJson) {
+            jsonBatch.reserve(kLogMaxBatchLines);
+        }
+
+        auto writeBatches = [&]() {
+            textFile_.write(textBatch);
+            jsonFile_.write(jsonBatch);
+            textBatch.clear();
+            jsonBatch.clear();
+        };
+
+        LogRecord record;
+        quint64 drained = 0;
+        while (queue_.pop(&record)) {
+            QByteArray text = formatLogRecordText(record).toUtf8();
+            text.append('\n');
+            textBatch.push_back(std::move(text));
+            if (writeJson) {
+                QByteArray json = formatLogRecordJson(record);
+                json.append('\n');
+                jsonBatch.push_back(std::move(json));
+            }
+            ++drained;
+            if (static_cast<int>(textBatch.size()) >= kLogMaxBatchLines) {
+                writeBatches();
+            }
+        }
+        writeBatches();
+        if (drained == 0) {
+            return;
+        }
+
+        pendingBytes_.store(0, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            writtenCount_.fetch_add(drained, std::memory_order_acq_rel);
+        }
+        writtenCondition_.notify_all();
+    }
+
+    LogQueue queue_;
+    LogFile textFile_;
+    LogFile jsonFile_;
+    std::thread writer_;
+    std::mutex mutex_;
+    std::condition_variable wakeCondition_;
+    std::condition_variable writtenCondition_;
+    bool wakeRequested_{false};
+    bool stopping_{false};
+    std::atomic<bool> running_{false};
+    std::atomic<qsizetype> pendingBytes_{0};
+    std::atomic<quint64> enqueuedCount_{0};
+    std::atomic<quint64> writtenCount_{0};
+    std::atomic<quint64> flushTarget_{0};
+};
+
+AsyncLogSink &logSinkInstance()
+{
+    static AsyncLogSink sink;
+    return sink;
+}
+
+}
+
+QString resolveProjectLogPath()
+{
+    const QString envPath = qEnvironmentVariable("TV_TUNER_GUI_LOG_PATH");
+    if (!envPath.isEmpty()) {
+        return envPath;
+    }
+
+    QDir sourceDir(QStringLiteral(TV_TUNER_GUI_SOURCE_DIR));
+    if (sourceDir.exists()) {
+        return sourceDir.filePath("tv_tuner_gui.log");
+    }
+
+    QDir cwdDir(QDir::currentPath());
+    if (cwdDir.dirName() == "build") {
+        cwdDir.cdUp();
+    }
+    return cwdDir.filePath("tv_tuner_gui.log");
+}
+
+qint64 logMonotonicNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+QDateTime logRecordDateTime(qint64 monotonicNs)
+{
+    const LogClockAnchor &anchor = logClockAnchor();
+    return QDateTime::fromMSecsSinceEpoch(anchor.wallClockMs + (monotonicNs - anchor.monotonicNs) / 1000000);
+}
+
+QString logCategoryName(LogCategory category)
+{
+    switch (category) {
+    case LogCategory::General:
+        return "general";
+    case LogCategory::Guide:
+        return "guide";
+    case LogCategory::Zap:
+        return "zap";
+    case LogCategory::Player:
+        return "player";
+    case LogCategory::Schedule:
+        return "schedule";
+    case LogCategory::Theme:
+        return "theme";
+    case LogCategory::Signal:
+        return "signal";
+    case LogCategory::Qt:
+        return "qt";
+    }
+    return "general";
+}
+
+QString logLevelName(LogLevel level)
+{
+    switch (level) {
+    case LogLevel::Debug:
+        return "DEBUG";
+    case LogLevel::Info:
+        return "INFO";
+    case LogLevel::Warning:
+        return "WARN";
+    case LogLevel::Error:
+        return "ERROR";
+    }
+    return "INFO";
+}
+
+bool logEnabled(LogCategory category, LogLevel level)
+{
+    return static_cast<int>(level)
+           >= logThresholds()[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+}
+
+void setLogThreshold(LogCategory category, LogLevel level)
+{
+    logThresholds()[static_cast<std::size_t>(category)].store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+bool configureLogFilter(const QString &spec, QString *errorText)
+{
+    QStringList rejected;
+    for (const QString &part : spec.split(',', Qt::SkipEmptyParts)) {
+        const int separator = part.indexOf('=');
+        LogLevel level = LogLevel::Info;
+        if (separator <= 0 || !logLevelFromName(part.mid(separator + 1), &level)) {
+            rejected.append(part.trimmed());
+            continue;
+        }
+
+        const QString name = part.left(separator).trimmed().toLower();
+        bool matched = false;
+        for (int index = 0; index < kLogCategoryCount; ++index) {
+            const auto category = static_cast<LogCategory>(index);
+            if (name == "*" || name == logCategoryName(category)) {
+                setLogThreshold(category, level);
+                matched = true;
+            }
+        }
+        if (!matched) {
+            rejected.append(part.trimmed());
+        }
+    }
+
+    if (!rejected.isEmpty() && errorText != nullptr) {
+        *errorText = QString("ignored log filter entries: %1").arg(rejected.join(", "));
+    }
+    return rejected.isEmpty();
+}
+
+QString formatLogRecordText(const LogRecord &record)
+{
+    const QDateTime timestamp = logRecordDateTime(record.monotonicNs);
+    if (record.category == LogCategory::Qt) {
+        return QString("[%1] [QT:%2] %3")
+            .arg(timestamp.toString(Qt::ISODate), logLevelName(record.level), record.message);
+    }
+
+    const QString prefix = timestamp.toString("MM/dd/yyyy HH:mm:ss");
+    if (record.level == LogLevel::Info) {
+        return QString("[%1] %2").arg(prefix, record.message);
+    }
+    return QString("[%1] [%2] %3").arg(prefix, logLevelName(record.level), record.message);
+}
+
+QByteArray formatLogRecordJson(const LogRecord &record)
+{
+    QJsonObject object;
+    object.insert("time", logRecordDateTime(record.monotonicNs).toUTC().toString(Qt::ISODateWithMs));
+    object.insert("monotonicUs", record.monotonicNs / 1000);
+    object.insert("level", logLevelName(record.level).toLower());
+    object.insert("category", logCategoryName(record.category));
+    object.insert("message", record.message);
+    return QJsonDocument(object).toJson(QJsonDocument::Compact);
+}
+
+bool startLogSink(const QString &logPath, bool writeJsonLines, QString *errorText)
+{
+    logClockAnchor();
+    return logSinkInstance().start(logPath, writeJsonLines, errorText);
+}
+
+void appendLogSinkRecord(LogRecord record)
+{
+    logSinkInstance().append(std::move(record));
+}
+
+void flushLogSink()
+{
+    logSinkInstance().flush();
+}
+
+void stopLogSink()
+{
+    logSinkInstance().stop();
+}
@@ -1,11 +1,18 @@
 #include "MainWindow.h"
+#include "LogSink.h"
+#include "ScheduledSwitchQueue.h"
+#include "SchedulesDirectClient.h"
+#include "StartupTrace.h"
 #include "TvGuideDialog.h"
 
 #include <QAbstractItemView>
+#include <QAbstractListModel>
+#include <QAbstractTableModel>
 #include <QAbstractButton>
 #include <QApplication>
 #include <QAudioOutput>
 #include <QCheckBox>
+#include <QClipboard>
 #include <QColorDialog>
 #include <QComboBox>
 #include <QCloseEvent>
@@ -22,6 +29,7 @@
 #include <QFileInfo>
 #include <QFontMetrics>
 #include <QFontComboBox>
+#include <QFutureWatcher>
 #include <QFormLayout>
 #include <QGridLayout>
 #include <QGuiApplication>
@@ -36,6 +44,7 @@
 #include <QLabel>
 #include <QKeySequenceEdit>
 #include <QLineEdit>
+#include <QListView>
 #include <QListWidget>
 #include <QListWidgetItem>
 #include <QMediaPlayer>
@@ -44,10 +53,6 @@
 #include <QMenuBar>
 #include <QMessageBox>
 #include <QMediaMetaData>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QNetworkRequest>
-#include <QPlainTextEdit>
 #include <QProgressDialog>
 #include <QProcess>
 #include <QPushButton>
@@ -69,7 +74,7 @@
 #include <QStyleOptionSlider>
 #include <QTabBar>
 #include <QTabWidget>
-#include <QTableWidget>
+#include <QTableView>
 #include <QTextCursor>
 #include <QTimer>
 #include <QTimeZone>
@@ -78,6 +83,8 @@
 #include <QUrlQuery>
 #include <QXmlStreamReader>
 #include <QVBoxLayout>
+#include <QVideoFrame>
+#include <QVideoSink>
 #include <QVideoWidget>
 #include <QWidget>
 #include <QScreen>
@@ -85,6 +92,7 @@
 #include <QCursor>
 #include <QCryptographicHash>
 #include <QSet>
+#include <QtConcurrent/QtConcurrentRun>
 #include <linux/dvb/dmx.h>
 #include <fcntl.h>
 #include <poll.h>
@@ -95,7 +103,9 @@
 #include <cerrno>
 #include <cstring>
 #include <functional>
+#include <initializer_list>
 #include <thread>
+#include <utility>
 #include <vector>
 #include <limits>
 
@@ -130,6 +140,11 @@ constexpr auto kKeyBindingSettingPrefix = "keyBindings/";
 constexpr auto kSchedulesDirectUsernameSetting = "schedulesDirect/username";
 constexpr auto kSchedulesDirectPasswordSha1Setting = "schedulesDirect/passwordSha1";
 constexpr auto kSchedulesDirectPostalCodeSetting = "schedulesDirect/postalCode";
+constexpr auto kSchedulesDirectConcurrentRequestsSetting = "schedulesDirect/concurrentRequests";
+constexpr int kSchedulesDirectDefaultConcurrentRequests = 4;
+constexpr int kSchedulesDirectMaxConcurrentRequests = 8;
+constexpr int kSchedulesDirectRequestTimeoutMs = 120000;
+constexpr int kSchedulesDirectProgramChunkSize = 500;
 constexpr int kMinGuideRefreshIntervalMinutes = 1;
 constexpr int kMaxGuideRefreshIntervalMinutes = 2880;
 constexpr int kGuideRunoutRefreshRetryMinutes = 15;
@@ -430,6 +445,21 @@ QString colorCss(const QColor &color)
     return color.alpha() < 255 ? color.name(QColor::HexArgb) : color.name(QColor::HexRgb);
 }
 
+bool anyDisplayThemeRoleChanged(const QSet<QString> &changedRoles, std::initializer_list<const char *> roleKeys)
+{
+    return std::any_of(roleKeys.begin(), roleKeys.end(), [&changedRoles](const char *roleKey) {
+        return changedRoles.contains(QString::fromLatin1(roleKey));
+    });
+}
+
+// Setting a stylesheet re-polishes the widget and all of its children even when the text is unchanged.
+void setStyleSheetIfChanged(QWidget *widget, const QString &styleSheet)
+{
+    if (widget != nullptr && widget->styleSheet() != styleSheet) {
+        widget->setStyleSheet(styleSheet);
+    }
+}
+
 QColor contrastingTextColor(const QColor &color)
 {
     const int brightness = static_cast<int>((color.red() * 299 + color.green() * 587 + color.blue() * 114) / 1000);
@@ -765,6 +795,47 @@ QString normalizeChannelNumberHint(const QString &channelNumber)
     return normalized;
 }
 
+// Appends chunk to pending and returns its finished lines; only the new bytes are searched for line breaks.
+QStringList takeCompleteOutputLines(QByteArray *pending, const QByteArray &chunk)
+{
+    QStringList lines;
+    const qsizetype searchFrom = pending->size();
+    pending->append(chunk);
+    qsizetype lineStart = 0;
+    qsizetype lineEnd = pending->indexOf('\n', searchFrom);
+    while (lineEnd >= 0) {
+        const QString line = QString::fromUtf8(pending->constData() + lineStart, lineEnd - lineStart).trimmed();
+        if (!line.isEmpty()) {
+            lines.append(line);
+        }
+        lineStart = lineEnd + 1;
+        lineEnd = pending->indexOf('\n', lineStart);
+    }
+    if (lineStart > 0) {
+        pending->remove(0, lineStart);
+    }
+    return lines;
+}
+
+bool matchScanChannelNumberLine(const QString &line, QString *channelNumber, QString *channelName)
+{
+    static const QRegularExpression channelNumberPattern(
+        QStringLiteral("Channel number:\\s*(\\d+[:.-]\\d+)\\.\\s*Name:\\s*'([^']+)'"),
+        QRegularExpression::CaseInsensitiveOption);
+
+    // Most w_scan2 stderr lines are progress chatter, so skip the regex unless the marker is present.
+    if (!line.contains(QLatin1String("Channel number:"), Qt::CaseInsensitive)) {
+        return false;
+    }
+    const QRegularExpressionMatch match = channelNumberPattern.match(line);
+    if (!match.hasMatch()) {
+        return false;
+    }
+    *channelNumber = normalizeChannelNumberHint(match.captured(1));
+    *channelName = match.captured(2).trimmed();
+    return !channelNumber->isEmpty() && !channelName->isEmpty();
+}
+
 QString displayChannelNumber(const QString &channelNumber)
 {
     const QString normalized = normalizeChannelNumberHint(channelNumber);
@@ -1021,68 +1092,37 @@ QString channelDisplayLabelForLine(const QString &line,
     return channelDisplayLabelForParts(normalizedLine.split(':'), numberByTuneKey);
 }
 
-QString resolveProjectLogPath()
+bool verboseQtLoggingEnabled()
 {
-    const QString envPath = qEnvironmentVariable("TV_TUNER_GUI_LOG_PATH");
-    if (!envPath.isEmpty()) {
-        return envPath;
-    }
-
-    QDir sourceDir(QStringLiteral(TV_TUNER_GUI_SOURCE_DIR));
-    if (sourceDir.exists()) {
-        return sourceDir.filePath("tv_tuner_gui.log");
-    }
-
-    QDir cwdDir(QDir::currentPath());
-    if (cwdDir.dirName() == "build") {
-        cwdDir.cdUp();
-    }
-    return cwdDir.filePath("tv_tuner_gui.log");
+    const QByteArray value = qgetenv("TV_TUNER_GUI_VERBOSE_QT_LOGS").trimmed().toLower();
+    return value == "1" || value == "true" || value == "yes" || value == "on";
 }
 
-bool appendDirectLineToLogFile(const QString &logPath, const QString &line)
+QString resolveGuideCachePath()
 {
-    if (logPath.isEmpty()) {
-        return false;
-    }
-
-    const QByteArray encodedPath = QFile::encodeName(logPath);
-    const int fd = ::open(encodedPath.constData(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0664);
-    if (fd < 0) {
-        return false;
-    }
-
-    QByteArray payload = line.toUtf8();
-    payload.append('\n');
-
-    qsizetype totalWritten = 0;
-    while (totalWritten < payload.size()) {
-        const ssize_t written =
-            ::write(fd, payload.constData() + totalWritten, static_cast<size_t>(payload.size() - totalWritten));
-        if (written <= 0) {
-            ::close(fd);
-            return false;
-        }
-        totalWritten += written;
+    const QString appDataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    if (appDataPath.isEmpty()) {
+        return {};
     }
-
-    ::close(fd);
-    return true;
+    return QDir(appDataPath).filePath("guide_cache.json");
 }
 
-bool verboseQtLoggingEnabled()
+QString resolveChannelsFilePath()
 {
-    const QByteArray value = qgetenv("TV_TUNER_GUI_VERBOSE_QT_LOGS").trimmed().toLower();
-    return value == "1" || value == "true" || value == "yes" || value == "on";
+    const QString appDataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    if (appDataPath.isEmpty()) {
+        return {};
+    }
+    return QDir(appDataPath).filePath("channels.conf");
 }
 
-QString resolveGuideCachePath()
+QString resolveStartupSnapshotPath()
 {
     const QString appDataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
     if (appDataPath.isEmpty()) {
         return {};
     }
-    return QDir(appDataPath).filePath("guide_cache.json");
+    return QDir(appDataPath).filePath("startup_snapshot.json");
 }
 
 QString resolveGuideSchedulePath()
@@ -1112,6 +1152,30 @@ QString resolveLegacySchedulesDirectExportPath()
     return QDir(appDataPath).filePath("schedules_direct.org");
 }
 
+QString resolveSchedulesDirectSyncCachePath()
+{
+    const QString appDataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    if (appDataPath.isEmpty()) {
+        return {};
+    }
+    return QDir(appDataPath).filePath("schedules_direct_sync_cache.json");
+}
+
+// TV_TUNER_GUI_SCHEDULES_DIRECT_RAW_DUMP=1 (or a file path) also saves the raw lineup, schedule and program
+// responses for debugging. The guide itself only reads the compact export.
+QString requestedSchedulesDirectRawDumpPath()
+{
+    const QString value = qEnvironmentVariable("TV_TUNER_GUI_SCHEDULES_DIRECT_RAW_DUMP").trimmed();
+    if (value.isEmpty() || value == "0" || value.compare("false", Qt::CaseInsensitive) == 0) {
+        return {};
+    }
+    if (value == "1" || value.compare("true", Qt::CaseInsensitive) == 0) {
+        const QString appDataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+        return appDataPath.isEmpty() ? QString() : QDir(appDataPath).filePath("schedules_direct.raw.json");
+    }
+    return value;
+}
+
 QString resolveChannelHintsJsonPath()
 {
     const QString appDataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
@@ -1261,101 +1325,6 @@ QString guideDialogPresentationStamp(const QString &cacheStamp,
     return QString::fromLatin1(hash.result().toHex());
 }
 
-struct JsonRequestResult {
-    QJsonDocument document;
-    QByteArray body;
-    QString errorText;
-    int httpStatus{0};
-    bool timedOut{false};
-
-    bool ok() const
-    {
-        return errorText.trimmed().isEmpty() && !timedOut && httpStatus >= 200 && httpStatus < 300;
-    }
-};
-
-JsonRequestResult performJsonRequest(QNetworkAccessManager &networkManager,
-                                     const QString &userAgent,
-                                     const QUrl &url,
-                                     const QString &token = QString(),
-                                     const QJsonDocument &requestBody = QJsonDocument(),
-                                     const QByteArray &method = QByteArray(),
-                                     int timeoutMs = 15000)
-{
-    JsonRequestResult result;
-
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-    request.setRawHeader("Accept", "application/json");
-    request.setRawHeader("User-Agent", userAgent.toUtf8());
-    if (!token.trimmed().isEmpty()) {
-        request.setRawHeader("token", token.trimmed().toUtf8());
-    }
-
-    const QByteArray body = requestBody.isNull() ? QByteArray() : requestBody.toJson(QJsonDocument::Compact);
-    const QByteArray effectiveMethod = method.trimmed().toUpper();
-    QNetworkReply *reply = nullptr;
-    if (effectiveMethod.isEmpty()) {
-        reply = requestBody.isNull()
-                    ? networkManager.get(request)
-                    : networkManager.post(request, body);
-    } else if (effectiveMethod == "GET") {
-        reply = networkManager.get(request);
-    } else if (effectiveMethod == "POST") {
-        reply = networkManager.post(request, body);
-    } else {
-        reply = networkManager.sendCustomRequest(request, effectiveMethod, body);
-    }
-    QEventLoop loop;
-    QTimer timeoutTimer;
-    timeoutTimer.setSingleShot(true);
-
-    QObject::connect(reply, &QNetworkReply::finished, &loop, &QEventLoop::quit);
-    QObject::connect(&timeoutTimer, &QTimer::timeout, &loop, [&]() {
-        result.timedOut = true;
-        result.errorText = QString("Request timed out after %1 ms").arg(timeoutMs);
-        reply->abort();
-        loop.quit();
-    });
-
-    timeoutTimer.start(timeoutMs);
-    loop.exec();
-    timeoutTimer.stop();
-
-    const QVariant statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute);
-    result.httpStatus = statusCode.isValid() ? statusCode.toInt() : 0;
-    result.body = reply->readAll();
-
-    QJsonParseError parseError{};
-    result.document = QJsonDocument::fromJson(result.body, &parseError);
-    if (!result.body.trimmed().isEmpty() && parseError.error != QJsonParseError::NoError) {
-        result.errorText = QString("Invalid JSON response: %1").arg(parseError.errorString());
-    }
-
-    if (!result.timedOut && reply->error() != QNetworkReply::NoError) {
-        QString serverMessage;
-        if (result.document.isObject()) {
-            const QJsonObject object = result.document.object();
-            const QString message = object.value("message").toString().trimmed();
-            const QString response = object.value("response").toString().trimmed();
-            if (!message.isEmpty() && !response.isEmpty()) {
-                serverMessage = QString("%1 (%2)").arg(message, response);
-            } else {
-                serverMessage = !message.isEmpty() ? message : response;
-            }
-        }
-
-        result.errorText = serverMessage.isEmpty()
-                               ? reply->errorString()
-                               : QString("%1: %2").arg(reply->errorString(), serverMessage);
-    } else if (!result.timedOut && result.errorText.trimmed().isEmpty() && (result.httpStatus < 200 || result.httpStatus >= 300)) {
-        result.errorText = QString("Unexpected HTTP status %1").arg(result.httpStatus);
-    }
-
-    reply->deleteLater();
-    return result;
-}
-
 QString firstProgramTitle(const QJsonObject &program)
 {
     const QJsonArray titles = program.value("titles").toArray();
@@ -1392,6 +1361,108 @@ QString bestProgramDescription(const QJsonObject &program)
     return {};
 }
 
+// TV_TUNER_GUI_SCHEDULES_DIRECT_URL points the client at a stand-in server for testing.
+QUrl schedulesDirectApiUrl(const QString &path)
+{
+    QString baseUrl = qEnvironmentVariable("TV_TUNER_GUI_SCHEDULES_DIRECT_URL").trimmed();
+    if (baseUrl.isEmpty()) {
+        baseUrl = QStringLiteral("https://json.schedulesdirect.org/20141201");
+    }
+    while (baseUrl.endsWith('/')) {
+        baseUrl.chop(1);
+    }
+    return QUrl(baseUrl + path);
+}
+
+// Station-day schedules and program details kept between refreshes. Schedule days carry metadata.md5 and
+// programs carry md5, so a refresh only downloads the days and programs whose hash changed.
+struct SchedulesDirectSyncCache {
+    QHash<QString, QHash<QString, QJsonObject>> scheduleDaysByStation;
+    QHash<QString, QJsonObject> programsById;
+};
+
+QString schedulesDirectScheduleDayMd5(const QJsonObject &scheduleDay)
+{
+    return scheduleDay.value("metadata").toObject().value("md5").toString().trimmed();
+}
+
+QString schedulesDirectScheduleDayDate(const QJsonObject &scheduleDay)
+{
+    return scheduleDay.value("metadata").toObject().value("startDate").toString().trimmed();
+}
+
+bool loadSchedulesDirectSyncCache(const QString &cachePath, SchedulesDirectSyncCache *cache)
+{
+    *cache = SchedulesDirectSyncCache();
+    QFile cacheFile(cachePath);
+    if (cachePath.isEmpty() || !cacheFile.exists() || !cacheFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QJsonParseError parseError{};
+    const QJsonDocument document = QJsonDocument::fromJson(cacheFile.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError || !document.isObject()
+        || document.object().value("version").toInt() != 1) {
+        return false;
+    }
+
+    const QJsonObject root = document.object();
+    const QJsonObject stations = root.value("scheduleDays").toObject();
+    for (auto stationIt = stations.begin(); stationIt != stations.end(); ++stationIt) {
+        QHash<QString, QJsonObject> &days = cache->scheduleDaysByStation[stationIt.key()];
+        const QJsonObject daysObject = stationIt.value().toObject();
+        for (auto dayIt = daysObject.begin(); dayIt != daysObject.end(); ++dayIt) {
+            days.insert(dayIt.key(), dayIt.value().toObject());
+        }
+    }
+    const QJsonObject programs = root.value("programs").toObject();
+    cache->programsById.reserve(programs.size());
+    for (auto it = programs.begin(); it != programs.end(); ++it) {
+        cache->programsById.insert(it.key(), it.value().toObject());
+    }
+    return true;
+}
+
+bool saveSchedulesDirectSyncCache(const QString &cachePath, const SchedulesDirectSyncCache &cache, QString *errorText)
+{
+    QJsonObject stations;
+    for (auto stationIt = cache.scheduleDaysByStation.cbegin(); stationIt != cache.scheduleDaysByStation.cend();
+         ++stationIt) {
+        QJsonObject days;
+        for (auto dayIt = stationIt.value().cbegin(); dayIt != stationIt.value().cend(); ++dayIt) {
+            days.insert(dayIt.key(), dayIt.value());
+        }
+        stations.insert(stationIt.key(), days);
+    }
+    QJsonObject programs;
+    for (auto it = cache.programsById.cbegin(); it != cache.programsById.cend(); ++it) {
+        programs.insert(it.key(), it.value());
+    }
+
+    QJsonObject root;
+    root.insert("version", 1);
+    root.insert("savedUtc", QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs));
+    root.insert("scheduleDays", stations);
+    root.insert("programs", programs);
+
+    QSaveFile cacheFile(cachePath);
+    if (!cacheFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        if (errorText != nullptr) {
+            *errorText = QString("Could not open %1 for writing.").arg(cachePath);
+        }
+        return false;
+    }
+    const QByteArray payload = QJsonDocument(root).toJson(QJsonDocument::Compact);
+    if (cacheFile.write(payload) != payload.size() || !cacheFile.commit()) {
+        cacheFile.cancelWriting();
+        if (errorText != nullptr) {
+            *errorText = QString("Could not write %1.").arg(cachePath);
+        }
+        return false;
+    }
+    return true;
+}
+
 TvGuideScheduledSwitch normalizedScheduledSwitch(const TvGuideScheduledSwitch &scheduledSwitch);
 TvGuideScheduledSwitch scheduledSwitchFromGuideEntry(const QString &channelName, const TvGuideEntry &entry);
 
@@ -1484,15 +1555,72 @@ QString scheduledSwitchKey(const TvGuideScheduledSwitch &scheduledSwitch)
              normalized.title);
 }
 
-bool scheduledSwitchListContains(const QList<TvGuideScheduledSwitch> &switches,
-                                 const TvGuideScheduledSwitch &candidate)
+// Identifies one airing of a favorite show; titles that differ only in case or spacing are the same airing.
+QString favoriteShowOccurrenceKey(const TvGuideScheduledSwitch &normalizedSwitch, const QString &normalizedTitle)
 {
-    for (const TvGuideScheduledSwitch &scheduledSwitch : switches) {
-        if (scheduledSwitchesMatch(scheduledSwitch, candidate)) {
-            return true;
+    return QString("%1|%2|%3|%4")
+        .arg(normalizedSwitch.channelName,
+             QString::number(normalizedSwitch.startUtc.toSecsSinceEpoch()),
+             QString::number(normalizedSwitch.endUtc.toSecsSinceEpoch()),
+             normalizedTitle);
+}
+
+bool queueScheduledSwitch(ScheduledSwitchQueue &queue, const TvGuideScheduledSwitch &scheduledSwitch)
+{
+    const TvGuideScheduledSwitch normalized = normalizedScheduledSwitch(scheduledSwitch);
+    return queue.insert(scheduledSwitchKey(normalized), normalized);
+}
+
+// Drops candidates that overlap a higher-priority switch, whether already queued or kept earlier in this pass.
+// Candidates are taken in descending priority so one pass settles the whole set; overlaps between equal priorities
+// are left for the conflict prompt at airtime. Kept candidates are returned in input order.
+QList<TvGuideScheduledSwitch> keepHighestPriorityScheduledSwitches(
+    const QList<TvGuideScheduledSwitch> &candidates,
+    const ScheduledSwitchQueue &queued,
+    const std::function<int(const QString &title)> &priorityForTitle,
+    QList<TvGuideScheduledSwitch> *outranked)
+{
+    QList<int> priorities;
+    QList<int> order;
+    priorities.reserve(candidates.size());
+    order.reserve(candidates.size());
+    for (int index = 0; index < candidates.size(); ++index) {
+        priorities.append(priorityForTitle(candidates.at(index).title));
+        order.append(index);
+    }
+    std::stable_sort(order.begin(), order.end(), [&priorities](int left, int right) {
+        return priorities.at(left) > priorities.at(right);
+    });
+
+    const auto outrankedBy = [&priorityForTitle](const QList<TvGuideScheduledSwitch> &others, int priority) {
+        return std::any_of(others.cbegin(), others.cend(), [&](const TvGuideScheduledSwitch &other) {
+            return priorityForTitle(other.title) > priority;
+        });
+    };
+
+    ScheduledSwitchQueue kept;
+    QList<bool> keepCandidate(candidates.size(), false);
+    for (const int index : std::as_const(order)) {
+        const TvGuideScheduledSwitch &candidate = candidates.at(index);
+        const int priority = priorities.at(index);
+        if (outrankedBy(queued.overlapping(candidate.startUtc, candidate.endUtc), priority)
+            || outrankedBy(kept.overlapping(candidate.startUtc, candidate.endUtc), priority)) {
+            if (outranked != nullptr) {
+                outranked->append(candidate);
+            }
+            continue;
         }
+        kept.restore(scheduledSwitchKey(candidate), candidate);
+        keepCandidate[index] = true;
     }
-    return false;
+
+    QList<TvGuideScheduledSwitch> keptCandidates;
+    for (int index = 0; index < candidates.size(); ++index) {
+        if (keepCandidate.at(index)) {
+            keptCandidates.append(candidates.at(index));
+        }
+    }
+    return keptCandidates;
 }
 
 bool scheduledSwitchesOverlap(const TvGuideScheduledSwitch &left, const TvGuideScheduledSwitch &right)
@@ -1657,15 +1785,13 @@ QString summarizeScheduledSwitchesDebug(const QList<TvGuideScheduledSwitch> &swi
 struct ScheduledSwitchChoiceOption {
     TvGuideScheduledSwitch scheduledSwitch;
     bool isExisting{false};
-    int existingIndex{-1};
+    QString existingKey;
 };
 
 QString scheduledSwitchChoiceDebugLabel(const ScheduledSwitchChoiceOption &choice)
 {
-    return QString("%1 | %2 | existingIndex=%3")
-        .arg(scheduledSwitchDebugLabel(choice.scheduledSwitch),
-             choice.isExisting ? "existing" : "candidate",
-             QString::number(choice.existingIndex));
+    return QString("%1 | %2")
+        .arg(scheduledSwitchDebugLabel(choice.scheduledSwitch), choice.isExisting ? "existing" : "candidate");
 }
 
 QJsonObject scheduledSwitchToJsonObject(const TvGuideScheduledSwitch &scheduledSwitch)
@@ -1985,89 +2111,385 @@ bool saveChannelHintsToJson(const QHash<QString, QString> &numberByTuneKey,
     return true;
 }
 
-QStringList normalizedFavorites(const QStringList &favorites, int maxCount = -1)
-{
-    QStringList normalized;
-    for (const QString &favorite : favorites) {
-        const QString trimmedFavorite = normalizeDisplayedChannelLabel(favorite);
-        if (trimmedFavorite.isEmpty() || channelDisplayListContains(normalized, trimmedFavorite)) {
-            continue;
-        }
-        normalized.append(trimmedFavorite);
-        if (maxCount > 0 && normalized.size() >= maxCount) {
-            break;
-        }
-    }
-    return normalized;
-}
-
-QStringList favoriteCandidatesFromTable(const QTableWidget *channelsTable, const QStringList &favorites)
+// Reads the saved channel hint JSON and, when present, the desktop XSPF playlist. Safe to run off the GUI thread;
+// log lines are collected for the caller instead of being appended directly.
+void readChannelHints(QHash<QString, QString> &numberByTuneKey,
+                      QHash<QString, QString> &programByChannel,
+                      QStringList *logLines)
 {
-    if (channelsTable == nullptr) {
-        return {};
+    QString jsonError;
+    const bool loadedJsonHints = loadChannelHintsFromJson(numberByTuneKey, programByChannel, &jsonError);
+    if (loadedJsonHints) {
+        logLines->append(QString("Loaded %1 saved channel hint mapping%2 from %3")
+                             .arg(programByChannel.size())
+                             .arg(programByChannel.size() == 1 ? QString() : QString("s"))
+                             .arg(resolveChannelHintsJsonPath()));
+    } else if (!jsonError.trimmed().isEmpty()) {
+        logLines->append(jsonError);
     }
 
-    const QStringList normalizedExistingFavorites = normalizedFavorites(favorites);
-    QStringList candidates;
-    for (int row = 0; row < channelsTable->rowCount(); ++row) {
-        const QTableWidgetItem *item = channelsTable->item(row, 1);
-        if (item == nullptr) {
-            continue;
-        }
-
-        const QString channelName = item->text().trimmed();
-        if (channelName.isEmpty()
-            || channelDisplayListContains(normalizedExistingFavorites, channelName)
-            || candidates.contains(channelName)) {
-            continue;
+    const QString xspfPath = QDir::home().filePath("Desktop/tv.xspf");
+    QFile file(xspfPath);
+    if (!file.exists()) {
+        if (!loadedJsonHints) {
+            logLines->append("No saved channel hint JSON or XSPF playlist found; using channels.conf metadata.");
         }
-        candidates.append(channelName);
-    }
-    return candidates;
-}
-
-int firstAvailableFrontendForAdapter(int adapter, int preferredFrontend)
-{
-    const auto frontendPath = [adapter](int frontend) {
-        return QString("/dev/dvb/adapter%1/frontend%2").arg(adapter).arg(frontend);
-    };
-
-    if (preferredFrontend >= 0 && QFileInfo::exists(frontendPath(preferredFrontend))) {
-        return preferredFrontend;
+        return;
     }
-
-    for (int frontend = 0; frontend <= 7; ++frontend) {
-        if (QFileInfo::exists(frontendPath(frontend))) {
-            return frontend;
-        }
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        logLines->append("Could not open XSPF playlist: " + xspfPath);
+        return;
     }
 
-    return -1;
-}
-
-bool adapterHasGuideDevices(int adapter)
-{
-    return QFileInfo::exists(QString("/dev/dvb/adapter%1/demux0").arg(adapter))
-           && QFileInfo::exists(QString("/dev/dvb/adapter%1/dvr0").arg(adapter));
-}
+    const QHash<QString, QString> savedNumberByTuneKey = numberByTuneKey;
+    const QHash<QString, QString> savedProgramByChannel = programByChannel;
+    static const QRegularExpression frequencyPattern(QStringLiteral("frequency=(\\d+)"));
+    QXmlStreamReader xml(&file);
+    QString currentTitle;
+    QString currentProgram;
+    QString currentFrequency;
+    bool inTrack = false;
+    bool inVlcOption = false;
+    QString optionText;
 
-int findPreferredGuideAdapter(int preferredFrontend, int &guideFrontend)
-{
-    const QList<int> preferredAdapters = {1, 0};
-    for (int adapter : preferredAdapters) {
-        if (!adapterHasGuideDevices(adapter)) {
-            continue;
+    auto flushTrack = [&]() {
+        if (currentTitle.isEmpty() || currentProgram.isEmpty()) {
+            return;
         }
-        const int frontend = firstAvailableFrontendForAdapter(adapter, preferredFrontend);
-        if (frontend >= 0) {
-            guideFrontend = frontend;
-            return adapter;
+        const int firstSpace = currentTitle.indexOf(' ');
+        if (firstSpace <= 0 || firstSpace >= currentTitle.size() - 1) {
+            return;
         }
-    }
-
-    for (int adapter = 0; adapter <= 32; ++adapter) {
-        if (!adapterHasGuideDevices(adapter)) {
-            continue;
+        const QString channelNumber = currentTitle.left(firstSpace).trimmed();
+        const QString channelName = currentTitle.mid(firstSpace + 1).trimmed();
+        if (!channelName.isEmpty()) {
+            const QString normalizedChannelNumber = normalizeChannelNumberHint(channelNumber);
+            if (!normalizedChannelNumber.isEmpty() && !currentFrequency.isEmpty()) {
+                numberByTuneKey.insert(tuneKey(currentFrequency, currentProgram), normalizedChannelNumber);
+            }
+            programByChannel.insert(channelName, currentProgram);
+            const QString displayLabel = channelDisplayLabel(channelName, normalizedChannelNumber);
+            if (!displayLabel.isEmpty() && displayLabel != channelName) {
+                programByChannel.insert(displayLabel, currentProgram);
+            }
+        }
+    };
+
+    while (!xml.atEnd()) {
+        xml.readNext();
+        if (xml.isStartElement()) {
+            const QStringView name = xml.name();
+            if (name == u"track") {
+                inTrack = true;
+                currentTitle.clear();
+                currentProgram.clear();
+                currentFrequency.clear();
+            } else if (inTrack && name == u"title") {
+                currentTitle = xml.readElementText(QXmlStreamReader::SkipChildElements).trimmed();
+            } else if (inTrack && name == u"location") {
+                const QString location = xml.readElementText(QXmlStreamReader::SkipChildElements).trimmed();
+                const QRegularExpressionMatch match = frequencyPattern.match(location);
+                currentFrequency = match.hasMatch() ? match.captured(1) : QString();
+            } else if (inTrack && name == u"option" && xml.namespaceUri().toString().contains("videolan.org")) {
+                inVlcOption = true;
+                optionText.clear();
+            }
+        } else if (xml.isCharacters() && inVlcOption) {
+            optionText += xml.text().toString();
+        } else if (xml.isEndElement()) {
+            const QStringView name = xml.name();
+            if (inVlcOption && name == u"option") {
+                inVlcOption = false;
+                const QString opt = optionText.trimmed();
+                if (opt.startsWith("program=")) {
+                    currentProgram = opt.mid(QString("program=").size()).trimmed();
+                }
+                optionText.clear();
+            } else if (inTrack && name == u"track") {
+                flushTrack();
+                inTrack = false;
+                currentTitle.clear();
+                currentProgram.clear();
+                currentFrequency.clear();
+            }
+        }
+    }
+
+    if (xml.hasError()) {
+        logLines->append("Failed to parse XSPF playlist: " + xml.errorString());
+        if (!loadedJsonHints) {
+            numberByTuneKey.clear();
+            programByChannel.clear();
+        }
+        return;
+    }
+
+    // The playlist rarely changes, so only rewrite the hint JSON when it actually adds something.
+    if (numberByTuneKey != savedNumberByTuneKey || programByChannel != savedProgramByChannel) {
+        QString saveError;
+        if (!saveChannelHintsToJson(numberByTuneKey, programByChannel, &saveError) && !saveError.trimmed().isEmpty()) {
+            logLines->append(saveError);
+        }
+    }
+
+    logLines->append(QString("Loaded %1 XSPF program mappings from %2 and cached them to %3")
+                         .arg(programByChannel.size())
+                         .arg(xspfPath)
+                         .arg(resolveChannelHintsJsonPath()));
+}
+
+bool readChannelsFileLines(const QString &channelsFilePath, QStringList *lines, QStringList *logLines)
+{
+    if (channelsFilePath.isEmpty()) {
+        logLines->append("Could not resolve app data directory for channels list.");
+        return false;
+    }
+
+    QFile file(channelsFilePath);
+    if (!file.exists()) {
+        logLines->append("No saved channels file found. Run a scan once to create one.");
+        return false;
+    }
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        logLines->append("Could not open channels file: " + channelsFilePath);
+        return false;
+    }
+
+    while (!file.atEnd()) {
+        const QString line = QString::fromUtf8(file.readLine()).trimmed();
+        if (!line.isEmpty()) {
+            lines->append(line);
+        }
+    }
+    return true;
+}
+
+// Changes since the last snapshot are appended here as one JSON object per line; replaying the journal over the
+// snapshot is idempotent, so a crash between writing a snapshot and trimming the journal loses nothing.
+QString scheduledSwitchJournalPath(const QString &schedulePath)
+{
+    return schedulePath + ".journal";
+}
+
+QByteArray scheduledSwitchJournalLine(const ScheduledSwitchQueue::JournalEntry &entry)
+{
+    QJsonObject object;
+    if (entry.added) {
+        object.insert("op", "add");
+        object.insert("switch", scheduledSwitchToJsonObject(entry.scheduledSwitch));
+    } else {
+        object.insert("op", "remove");
+        object.insert("key", entry.key);
+    }
+    return QJsonDocument(object).toJson(QJsonDocument::Compact) + '\n';
+}
+
+int replayScheduledSwitchJournal(const QString &journalPath, QList<TvGuideScheduledSwitch> *scheduledSwitches)
+{
+    QFile journalFile(journalPath);
+    if (!journalFile.exists() || !journalFile.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+
+    ScheduledSwitchQueue queue;
+    for (const TvGuideScheduledSwitch &scheduledSwitch : std::as_const(*scheduledSwitches)) {
+        queue.restore(scheduledSwitchKey(scheduledSwitch), scheduledSwitch);
+    }
+
+    int entryCount = 0;
+    while (!journalFile.atEnd()) {
+        const QJsonDocument document = QJsonDocument::fromJson(journalFile.readLine().trimmed());
+        if (!document.isObject()) {
+            continue;
+        }
+        const QJsonObject object = document.object();
+        const QString op = object.value("op").toString();
+        if (op == "add") {
+            const QList<TvGuideScheduledSwitch> added =
+                scheduledSwitchesFromJsonArray(QJsonArray{object.value("switch")});
+            for (const TvGuideScheduledSwitch &scheduledSwitch : added) {
+                queue.restore(scheduledSwitchKey(scheduledSwitch), scheduledSwitch);
+            }
+        } else if (op == "remove") {
+            queue.remove(object.value("key").toString());
+        } else {
+            continue;
+        }
+        ++entryCount;
+    }
+
+    *scheduledSwitches = queue.items();
+    return entryCount;
+}
+
+bool readScheduledSwitchesFile(const QString &schedulePath,
+                               QList<TvGuideScheduledSwitch> *scheduledSwitches,
+                               int *journalEntries)
+{
+    if (schedulePath.isEmpty()) {
+        return false;
+    }
+
+    scheduledSwitches->clear();
+    QFile scheduleFile(schedulePath);
+    const bool snapshotExists = scheduleFile.exists();
+    if (snapshotExists) {
+        if (!scheduleFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            return false;
+        }
+
+        QJsonParseError parseError{};
+        const QJsonDocument document = QJsonDocument::fromJson(scheduleFile.readAll(), &parseError);
+        if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+            return false;
+        }
+        *scheduledSwitches = scheduledSwitchesFromJsonArray(document.object().value("switches").toArray());
+    }
+
+    const QString journalPath = scheduledSwitchJournalPath(schedulePath);
+    *journalEntries = replayScheduledSwitchJournal(journalPath, scheduledSwitches);
+    return snapshotExists || QFileInfo::exists(journalPath);
+}
+
+bool writeScheduledSwitchesSnapshot(const QString &schedulePath, const QList<TvGuideScheduledSwitch> &scheduledSwitches)
+{
+    QJsonObject root;
+    root.insert("version", 1);
+    root.insert("savedUtc", QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs));
+
+    QJsonArray switchesArray;
+    for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches) {
+        switchesArray.append(scheduledSwitchToJsonObject(scheduledSwitch));
+    }
+    root.insert("switches", switchesArray);
+
+    QSaveFile scheduleFile(schedulePath);
+    if (!scheduleFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    const QByteArray payload = QJsonDocument(root).toJson(QJsonDocument::Compact);
+    if (scheduleFile.write(payload) != payload.size()) {
+        scheduleFile.cancelWriting();
+        return false;
+    }
+    return scheduleFile.commit();
+}
+
+// Drops the first compactedBytes of the journal, which the snapshot just written already covers. Returns the
+// number of entries left, or -1 if the journal could not be rewritten.
+int trimScheduledSwitchJournal(const QString &journalPath, qint64 compactedBytes)
+{
+    QFile journalFile(journalPath);
+    if (!journalFile.exists()) {
+        return 0;
+    }
+    if (!journalFile.open(QIODevice::ReadOnly)) {
+        return -1;
+    }
+    const QByteArray remaining = journalFile.readAll().mid(compactedBytes);
+    journalFile.close();
+    if (remaining.isEmpty()) {
+        return journalFile.remove() ? 0 : -1;
+    }
+
+    QSaveFile trimmedFile(journalPath);
+    if (!trimmedFile.open(QIODevice::WriteOnly | QIODevice::Truncate)
+        || trimmedFile.write(remaining) != remaining.size()
+        || !trimmedFile.commit()) {
+        return -1;
+    }
+    return static_cast<int>(remaining.count('\n'));
+}
+
+// The startup snapshot is only trusted while the files it was derived from are unchanged.
+QString startupSnapshotSourceStamp()
+{
+    QStringList parts;
+    const QStringList sourcePaths{resolveChannelsFilePath(),
+                                  resolveChannelHintsJsonPath(),
+                                  QDir::home().filePath("Desktop/tv.xspf")};
+    for (const QString &path : sourcePaths) {
+        const QFileInfo info(path);
+        parts.append(info.exists() ? QString("%1:%2").arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch())
+                                   : QString("-"));
+    }
+    return parts.join('|');
+}
+
+QStringList normalizedFavorites(const QStringList &favorites, int maxCount = -1)
+{
+    QStringList normalized;
+    for (const QString &favorite : favorites) {
+        const QString trimmedFavorite = normalizeDisplayedChannelLabel(favorite);
+        if (trimmedFavorite.isEmpty() || channelDisplayListContains(normalized, trimmedFavorite)) {
+            continue;
+        }
+        normalized.append(trimmedFavorite);
+        if (maxCount > 0 && normalized.size() >= maxCount) {
+            break;
+        }
+    }
+    return normalized;
+}
+
+QStringList favoriteCandidatesFromChannels(const QStringList &channelLabels, const QStringList &favorites)
+{
+    const QStringList normalizedExistingFavorites = normalizedFavorites(favorites);
+    QStringList candidates;
+    for (const QString &channelLabel : channelLabels) {
+        const QString channelName = channelLabel.trimmed();
+        if (channelName.isEmpty()
+            || channelDisplayListContains(normalizedExistingFavorites, channelName)
+            || candidates.contains(channelName)) {
+            continue;
+        }
+        candidates.append(channelName);
+    }
+    return candidates;
+}
+
+int firstAvailableFrontendForAdapter(int adapter, int preferredFrontend)
+{
+    const auto frontendPath = [adapter](int frontend) {
+        return QString("/dev/dvb/adapter%1/frontend%2").arg(adapter).arg(frontend);
+    };
+
+    if (preferredFrontend >= 0 && QFileInfo::exists(frontendPath(preferredFrontend))) {
+        return preferredFrontend;
+    }
+
+    for (int frontend = 0; frontend <= 7; ++frontend) {
+        if (QFileInfo::exists(frontendPath(frontend))) {
+            return frontend;
+        }
+    }
+
+    return -1;
+}
+
+bool adapterHasGuideDevices(int adapter)
+{
+    return QFileInfo::exists(QString("/dev/dvb/adapter%1/demux0").arg(adapter))
+           && QFileInfo::exists(QString("/dev/dvb/adapter%1/dvr0").arg(adapter));
+}
+
+int findPreferredGuideAdapter(int preferredFrontend, int &guideFrontend)
+{
+    const QList<int> preferredAdapters = {1, 0};
+    for (int adapter : preferredAdapters) {
+        if (!adapterHasGuideDevices(adapter)) {
+            continue;
+        }
+        const int frontend = firstAvailableFrontendForAdapter(adapter, preferredFrontend);
+        if (frontend >= 0) {
+            guideFrontend = frontend;
+            return adapter;
+        }
+    }
+
+    for (int adapter = 0; adapter <= 32; ++adapter) {
+        if (!adapterHasGuideDevices(adapter)) {
+            continue;
         }
         const int frontend = firstAvailableFrontendForAdapter(adapter, preferredFrontend);
         if (frontend < 0) {
@@ -2322,60 +2744,108 @@ QString schedulesDirectSynopsisForProgram(const QJsonObject &programObject)
     return programObject.value("description").toString().trimmed();
 }
 
-QVector<SchedulesDirectChannelPayload> parseSchedulesDirectExportChannels(const QJsonObject &root)
+SchedulesDirectChannelPayload schedulesDirectChannelPayload(const QJsonObject &mapObject,
+                                                            const QJsonObject &stationObject)
 {
-    QVector<SchedulesDirectChannelPayload> channels;
-    const QJsonArray lineups = root.value("lineups").toArray();
-    for (const QJsonValue &lineupValue : lineups) {
-        const QJsonArray lineupChannels = lineupValue.toObject().value("channels").toArray();
-        for (const QJsonValue &channelValue : lineupChannels) {
-            if (!channelValue.isObject()) {
-                continue;
-            }
+    SchedulesDirectChannelPayload channel;
+    channel.channelLabel = mapObject.value("channel").toString().trimmed();
+    channel.rfChannel = mapObject.value("uhfVhf").toInt(-1);
+    parseSchedulesDirectChannelLabel(channel.channelLabel, channel.virtualMajor, channel.virtualMinor);
+    channel.stationName = stationObject.value("name").toString().trimmed();
+    channel.callsign = stationObject.value("callsign").toString().trimmed();
+    channel.affiliate = stationObject.value("affiliate").toString().trimmed();
+    return channel;
+}
 
-            const QJsonObject channelObject = channelValue.toObject();
-            SchedulesDirectChannelPayload channel;
-            channel.channelLabel = channelObject.value("channel").toString().trimmed();
-            channel.rfChannel = channelObject.value("uhfVhf").toInt(-1);
-            parseSchedulesDirectChannelLabel(channel.channelLabel, channel.virtualMajor, channel.virtualMinor);
+bool schedulesDirectGuideEntry(const QJsonObject &scheduledProgram,
+                               const QString &title,
+                               const QString &episode,
+                               const QString &synopsis,
+                               TvGuideEntry *entry)
+{
+    const QString airDateTime = scheduledProgram.value("airDateTime").toString().trimmed();
+    if (airDateTime.isEmpty()) {
+        return false;
+    }
 
-            const QJsonObject stationObject = channelObject.value("station").toObject();
-            channel.stationName = stationObject.value("name").toString().trimmed();
-            channel.callsign = stationObject.value("callsign").toString().trimmed();
-            channel.affiliate = stationObject.value("affiliate").toString().trimmed();
+    QDateTime startUtc = QDateTime::fromString(airDateTime, Qt::ISODate);
+    if (!startUtc.isValid()) {
+        startUtc = QDateTime::fromString(airDateTime, Qt::ISODateWithMs);
+    }
+    if (!startUtc.isValid()) {
+        return false;
+    }
+    startUtc = startUtc.toUTC();
 
-            const QJsonArray scheduleDays = channelObject.value("schedule").toArray();
-            for (const QJsonValue &scheduleDayValue : scheduleDays) {
-                const QJsonArray programs = scheduleDayValue.toObject().value("programs").toArray();
-                for (const QJsonValue &programValue : programs) {
-                    const QJsonObject programObject = programValue.toObject();
-                    const QString airDateTime = programObject.value("airDateTime").toString().trimmed();
-                    if (airDateTime.isEmpty()) {
-                        continue;
-                    }
+    const int durationSeconds = std::max(0, scheduledProgram.value("duration").toInt());
+    if (title.isEmpty() || durationSeconds <= 0) {
+        return false;
+    }
 
-                    QDateTime startUtc = QDateTime::fromString(airDateTime, Qt::ISODate);
-                    if (!startUtc.isValid()) {
-                        startUtc = QDateTime::fromString(airDateTime, Qt::ISODateWithMs);
-                    }
-                    if (!startUtc.isValid()) {
-                        continue;
-                    }
-                    startUtc = startUtc.toUTC();
+    entry->startUtc = startUtc;
+    entry->endUtc = startUtc.addSecs(durationSeconds);
+    entry->title = title;
+    entry->episode = episode;
+    entry->synopsis = synopsis;
+    return true;
+}
 
-                    const int durationSeconds = std::max(0, programObject.value("duration").toInt());
-                    const QString title = programObject.value("title").toString().trimmed();
-                    if (title.isEmpty() || durationSeconds <= 0) {
-                        continue;
-                    }
+// Maps one /schedules day straight onto guide entries using the /programs details; returns the airings it listed.
+int appendSchedulesDirectScheduleDay(QList<TvGuideEntry> *entries,
+                                     const QJsonObject &scheduleDayObject,
+                                     const QHash<QString, QJsonObject> &programsById)
+{
+    int scheduledCount = 0;
+    const QJsonArray dailyPrograms = scheduleDayObject.value("programs").toArray();
+    for (const QJsonValue &programValue : dailyPrograms) {
+        const QJsonObject scheduledProgram = programValue.toObject();
+        ++scheduledCount;
+        const auto programIt = programsById.constFind(scheduledProgram.value("programID").toString().trimmed());
+        if (programIt == programsById.cend()) {
+            continue;
+        }
+
+        TvGuideEntry entry;
+        if (schedulesDirectGuideEntry(scheduledProgram,
+                                      firstProgramTitle(programIt.value()),
+                                      programIt->value("episodeTitle150").toString().trimmed(),
+                                      bestProgramDescription(programIt.value()),
+                                      &entry)) {
+            entries->append(entry);
+        }
+    }
+    return scheduledCount;
+}
+
+// Reads the enriched lineup layout that older builds saved; newer exports keep compact "sdChannels" instead.
+QVector<SchedulesDirectChannelPayload> parseSchedulesDirectExportChannels(const QJsonObject &root)
+{
+    QVector<SchedulesDirectChannelPayload> channels;
+    const QJsonArray lineups = root.value("lineups").toArray();
+    for (const QJsonValue &lineupValue : lineups) {
+        const QJsonArray lineupChannels = lineupValue.toObject().value("channels").toArray();
+        for (const QJsonValue &channelValue : lineupChannels) {
+            if (!channelValue.isObject()) {
+                continue;
+            }
 
+            const QJsonObject channelObject = channelValue.toObject();
+            SchedulesDirectChannelPayload channel =
+                schedulesDirectChannelPayload(channelObject, channelObject.value("station").toObject());
+
+            const QJsonArray scheduleDays = channelObject.value("schedule").toArray();
+            for (const QJsonValue &scheduleDayValue : scheduleDays) {
+                const QJsonArray programs = scheduleDayValue.toObject().value("programs").toArray();
+                for (const QJsonValue &programValue : programs) {
+                    const QJsonObject programObject = programValue.toObject();
                     TvGuideEntry entry;
-                    entry.startUtc = startUtc;
-                    entry.endUtc = startUtc.addSecs(durationSeconds);
-                    entry.title = title;
-                    entry.episode = schedulesDirectEpisodeForProgram(programObject);
-                    entry.synopsis = schedulesDirectSynopsisForProgram(programObject);
-                    channel.entries.append(entry);
+                    if (schedulesDirectGuideEntry(programObject,
+                                                  programObject.value("title").toString().trimmed(),
+                                                  schedulesDirectEpisodeForProgram(programObject),
+                                                  schedulesDirectSynopsisForProgram(programObject),
+                                                  &entry)) {
+                        channel.entries.append(entry);
+                    }
                 }
             }
 
@@ -2386,23 +2856,138 @@ QVector<SchedulesDirectChannelPayload> parseSchedulesDirectExportChannels(const
     return channels;
 }
 
-bool schedulesDirectLocalNameMatches(const QString &localName,
-                                     const SchedulesDirectChannelPayload &candidate)
+struct GuideChannelIdentity {
+    int rfChannel{-1};
+    int virtualMajor{-1};
+    int virtualMinor{-1};
+    QString normalizedName;
+};
+
+struct SchedulesDirectNormalizedNames {
+    QString station;
+    QString callsign;
+    QString affiliate;
+};
+
+qint64 guideChannelPairKey(int first, int second)
+{
+    return (static_cast<qint64>(first) << 32) | static_cast<quint32>(second);
+}
+
+// Schedules Direct channels keyed by virtual number, RF channel and normalized names, so matching a local channel
+// only looks at the few candidates that share one of those keys.
+struct SchedulesDirectChannelLookup {
+    QHash<qint64, QVector<int>> byVirtual;
+    QHash<qint64, QVector<int>> byRfMinor;
+    QHash<int, QVector<int>> byRf;
+    QHash<int, QVector<int>> byMajor;
+    QVector<SchedulesDirectNormalizedNames> normalizedNames;
+    QString stamp;
+};
+
+SchedulesDirectChannelLookup buildSchedulesDirectChannelLookup(const QVector<SchedulesDirectChannelPayload> &channels)
+{
+    SchedulesDirectChannelLookup lookup;
+    lookup.normalizedNames.reserve(channels.size());
+    QStringList stampParts;
+    stampParts.reserve(channels.size());
+    for (int index = 0; index < channels.size(); ++index) {
+        const SchedulesDirectChannelPayload &channel = channels.at(index);
+        if (channel.virtualMajor > 0 && channel.virtualMinor > 0) {
+            lookup.byVirtual[guideChannelPairKey(channel.virtualMajor, channel.virtualMinor)].append(index);
+        }
+        if (channel.rfChannel > 0) {
+            lookup.byRf[channel.rfChannel].append(index);
+            if (channel.virtualMinor > 0) {
+                lookup.byRfMinor[guideChannelPairKey(channel.rfChannel, channel.virtualMinor)].append(index);
+            }
+        }
+        if (channel.virtualMajor > 0) {
+            lookup.byMajor[channel.virtualMajor].append(index);
+        }
+        lookup.normalizedNames.append({normalizeGuideMatchText(channel.stationName),
+                                       normalizeGuideMatchText(channel.callsign),
+                                       normalizeGuideMatchText(channel.affiliate)});
+        stampParts.append(QString("%1|%2|%3|%4|%5")
+                              .arg(channel.channelLabel)
+                              .arg(channel.rfChannel)
+                              .arg(channel.stationName, channel.callsign, channel.affiliate));
+    }
+    lookup.stamp = stampParts.join('\n');
+    return lookup;
+}
+
+bool schedulesDirectLocalNameMatches(const QString &normalizedLocal,
+                                     const SchedulesDirectNormalizedNames &candidate)
 {
-    const QString normalizedLocal = normalizeGuideMatchText(localName);
     if (normalizedLocal.isEmpty()) {
         return false;
     }
 
-    const QString normalizedStation = normalizeGuideMatchText(candidate.stationName);
-    const QString normalizedCallsign = normalizeGuideMatchText(candidate.callsign);
-    const QString normalizedAffiliate = normalizeGuideMatchText(candidate.affiliate);
+    return candidate.station == normalizedLocal
+           || candidate.callsign == normalizedLocal
+           || candidate.station.contains(normalizedLocal)
+           || candidate.callsign.contains(normalizedLocal)
+           || candidate.affiliate == normalizedLocal;
+}
+
+// Returns the only candidate accepted by the filter, or -1 when none or several are.
+template <typename Filter>
+int uniqueSchedulesDirectCandidate(const QVector<int> &candidates, Filter accepts)
+{
+    int found = -1;
+    for (int index : candidates) {
+        if (!accepts(index)) {
+            continue;
+        }
+        if (found >= 0) {
+            return -1;
+        }
+        found = index;
+    }
+    return found;
+}
+
+// Tries exact major.minor, then a unique RF+minor pair. Channels without a specific minor may also match on a
+// unique RF+name, a unique major+name or a lone RF candidate.
+int matchSchedulesDirectChannel(const SchedulesDirectChannelLookup &lookup,
+                                const GuideChannelIdentity &identity,
+                                bool *missingExactSubchannel)
+{
+    *missingExactSubchannel = false;
+    if (identity.virtualMajor > 0 && identity.virtualMinor > 0) {
+        const QVector<int> exact =
+            lookup.byVirtual.value(guideChannelPairKey(identity.virtualMajor, identity.virtualMinor));
+        if (!exact.isEmpty()) {
+            return exact.first();
+        }
+    }
+
+    if (identity.rfChannel > 0 && identity.virtualMinor > 0) {
+        const QVector<int> rfMinor =
+            lookup.byRfMinor.value(guideChannelPairKey(identity.rfChannel, identity.virtualMinor));
+        if (rfMinor.size() == 1) {
+            return rfMinor.first();
+        }
+    }
+
+    if (identity.virtualMinor > 0) {
+        *missingExactSubchannel = true;
+        return -1;
+    }
 
-    return normalizedStation == normalizedLocal
-           || normalizedCallsign == normalizedLocal
-           || normalizedStation.contains(normalizedLocal)
-           || normalizedCallsign.contains(normalizedLocal)
-           || normalizedAffiliate == normalizedLocal;
+    const auto nameMatches = [&lookup, &identity](int index) {
+        return schedulesDirectLocalNameMatches(identity.normalizedName, lookup.normalizedNames.at(index));
+    };
+    const QVector<int> sameRf = identity.rfChannel > 0 ? lookup.byRf.value(identity.rfChannel) : QVector<int>();
+    int match = uniqueSchedulesDirectCandidate(sameRf, nameMatches);
+    if (match < 0 && identity.virtualMajor > 0) {
+        match = uniqueSchedulesDirectCandidate(lookup.byMajor.value(identity.virtualMajor), nameMatches);
+    }
+    if (match < 0 && sameRf.size() == 1) {
+        match = sameRf.first();
+    }
+    return match;
 }
 
 struct RawGuideEvent {
@@ -2435,17 +3020,12 @@ QString atscEventTextKey(int serviceId, int eventId)
     return QString("%1|%2").arg(serviceId).arg(eventId);
 }
 
-QHash<QString, QList<TvGuideEntry>> mapGuideEntriesForFrequency(const QVector<GuideChannelInfo> &frequencyChannels,
+QHash<QString, QList<TvGuideEntry>> mapGuideEntriesForFrequency(const QHash<int, QStringList> &namesByServiceId,
                                                                 const QList<RawGuideEvent> &frequencyEvents,
                                                                 const QHash<int, int> &atscSourceToProgram,
                                                                 int *mappedForFrequency = nullptr,
                                                                 QSet<QString> *mappedChannelNamesForMux = nullptr)
 {
-    QHash<int, QStringList> namesByServiceId;
-    for (const GuideChannelInfo &channel : frequencyChannels) {
-        namesByServiceId[channel.serviceId].append(channel.name);
-    }
-
     int mappedCount = 0;
     QSet<QString> mappedNames;
     QHash<QString, QList<TvGuideEntry>> mappedEntriesByChannel;
@@ -2483,7 +3063,8 @@ QHash<QString, QList<TvGuideEntry>> mapGuideEntriesForFrequency(const QVector<Gu
 QList<TvGuideEntry> cleanGuideEntries(const QList<TvGuideEntry> &entries,
                                       const QDateTime &nowUtc,
                                       int pastRetentionHours,
-                                      QDateTime *latestEndUtc = nullptr)
+                                      QDateTime *latestEndUtc = nullptr,
+                                      int *expiredCount = nullptr)
 {
     QList<TvGuideEntry> sorted = entries;
     std::sort(sorted.begin(), sorted.end(), [](const TvGuideEntry &a, const TvGuideEntry &b) {
@@ -2504,6 +3085,9 @@ QList<TvGuideEntry> cleanGuideEntries(const QList<TvGuideEntry> &entries,
             continue;
         }
         if (limitPastEntries && entry.endUtc < earliestEndUtc) {
+            if (expiredCount != nullptr) {
+                ++*expiredCount;
+            }
             continue;
         }
 
@@ -2616,11 +3200,57 @@ QList<TvGuideEntry> guideEntriesFromJsonArray(const QJsonArray &array)
     return entries;
 }
 
+QJsonObject schedulesDirectChannelToJson(const SchedulesDirectChannelPayload &channel)
+{
+    QJsonObject object;
+    object.insert("channel", channel.channelLabel);
+    object.insert("uhfVhf", channel.rfChannel);
+    object.insert("stationName", channel.stationName);
+    object.insert("callsign", channel.callsign);
+    object.insert("affiliate", channel.affiliate);
+    object.insert("entries", guideEntriesToJsonArray(channel.entries));
+    return object;
+}
+
+QVector<SchedulesDirectChannelPayload> schedulesDirectChannelsFromExport(const QJsonObject &root)
+{
+    const QJsonArray compactChannels = root.value("sdChannels").toArray();
+    if (compactChannels.isEmpty()) {
+        return parseSchedulesDirectExportChannels(root);
+    }
+
+    QVector<SchedulesDirectChannelPayload> channels;
+    channels.reserve(compactChannels.size());
+    for (const QJsonValue &channelValue : compactChannels) {
+        const QJsonObject channelObject = channelValue.toObject();
+        SchedulesDirectChannelPayload channel;
+        channel.channelLabel = channelObject.value("channel").toString().trimmed();
+        channel.rfChannel = channelObject.value("uhfVhf").toInt(-1);
+        parseSchedulesDirectChannelLabel(channel.channelLabel, channel.virtualMajor, channel.virtualMinor);
+        channel.stationName = channelObject.value("stationName").toString().trimmed();
+        channel.callsign = channelObject.value("callsign").toString().trimmed();
+        channel.affiliate = channelObject.value("affiliate").toString().trimmed();
+        channel.entries = guideEntriesFromJsonArray(channelObject.value("entries").toArray());
+        channels.append(channel);
+    }
+    return channels;
+}
+
+QString guideCacheFileStamp(const QString &cachePath)
+{
+    const QFileInfo info(cachePath);
+    if (!info.exists()) {
+        return {};
+    }
+    return QString("%1:%2").arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch());
+}
+
+// Drops expired entries from a guide-cache shaped file by reading only each entry's end time.
 bool pruneGuideCacheFile(const QString &cachePath,
                          const QDateTime &nowUtc,
                          int retentionHours)
 {
-    if (cachePath.isEmpty()) {
+    if (cachePath.isEmpty() || retentionHours <= 0) {
         return false;
     }
 
@@ -2631,6 +3261,7 @@ bool pruneGuideCacheFile(const QString &cachePath,
 
     QJsonParseError parseError{};
     const QJsonDocument document = QJsonDocument::fromJson(cacheFile.readAll(), &parseError);
+    cacheFile.close();
     if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
         return false;
     }
@@ -2641,40 +3272,38 @@ bool pruneGuideCacheFile(const QString &cachePath,
         return false;
     }
 
+    const QDateTime earliestEndUtc = nowUtc.addSecs(-static_cast<qint64>(retentionHours) * 3600);
     bool changed = false;
     QJsonObject trimmedEntriesObject;
     QDateTime latestEndUtc;
     for (auto it = entriesObject.begin(); it != entriesObject.end(); ++it) {
         const QJsonArray originalArray = it.value().toArray();
-        const QList<TvGuideEntry> trimmedEntries =
-            cleanGuideEntries(guideEntriesFromJsonArray(originalArray), nowUtc, retentionHours, &latestEndUtc);
-        const QJsonArray trimmedArray = guideEntriesToJsonArray(trimmedEntries);
-        if (trimmedArray != originalArray) {
-            changed = true;
+        QJsonArray trimmedArray;
+        for (const QJsonValue &value : originalArray) {
+            const QDateTime endUtc =
+                QDateTime::fromString(value.toObject().value("endUtc").toString(), Qt::ISODateWithMs);
+            if (!endUtc.isValid() || endUtc < earliestEndUtc) {
+                changed = true;
+                continue;
+            }
+            if (!latestEndUtc.isValid() || endUtc > latestEndUtc) {
+                latestEndUtc = endUtc;
+            }
+            trimmedArray.append(value);
         }
         trimmedEntriesObject.insert(it.key(), trimmedArray);
     }
-
-    const int slotMinutes = std::clamp(root.value("slotMinutes").toInt(30), 15, 120);
-    const QDateTime windowStartUtc = alignedGuideWindowStartUtc(nowUtc);
-    const int slotCount = guideWindowSlotCount(windowStartUtc, latestEndUtc, slotMinutes);
-    const QString existingWindowStartText = root.value("windowStartUtc").toString().trimmed();
-    const QString normalizedWindowStartText = windowStartUtc.toString(Qt::ISODateWithMs);
-    if (existingWindowStartText != normalizedWindowStartText
-        || root.value("slotMinutes").toInt(30) != slotMinutes
-        || root.value("slotCount").toInt(12) != slotCount) {
-        changed = true;
-    }
-
     if (!changed) {
         return false;
     }
 
+    const int slotMinutes = std::clamp(root.value("slotMinutes").toInt(30), 15, 120);
+    const QDateTime windowStartUtc = alignedGuideWindowStartUtc(nowUtc);
     QJsonObject updatedRoot = root;
     updatedRoot.insert("entriesByChannel", trimmedEntriesObject);
-    updatedRoot.insert("windowStartUtc", normalizedWindowStartText);
+    updatedRoot.insert("windowStartUtc", windowStartUtc.toString(Qt::ISODateWithMs));
     updatedRoot.insert("slotMinutes", slotMinutes);
-    updatedRoot.insert("slotCount", slotCount);
+    updatedRoot.insert("slotCount", guideWindowSlotCount(windowStartUtc, latestEndUtc, slotMinutes));
 
     QSaveFile saveFile(cachePath);
     if (!saveFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
@@ -2688,6 +3317,57 @@ bool pruneGuideCacheFile(const QString &cachePath,
     return saveFile.commit();
 }
 
+bool writeGuideCacheJson(const QString &cachePath,
+                         const QStringList &channelOrder,
+                         const QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
+                         const QString &generatedUtc,
+                         const QDateTime &windowStartUtc,
+                         int slotMinutes,
+                         int slotCount,
+                         const QString &statusText)
+{
+    if (cachePath.isEmpty()) {
+        return false;
+    }
+
+    QFileInfo cacheInfo(cachePath);
+    QDir cacheDir = cacheInfo.dir();
+    if (!cacheDir.exists() && !cacheDir.mkpath(".")) {
+        return false;
+    }
+
+    QJsonObject root;
+    root.insert("version", 1);
+    root.insert("generatedUtc", generatedUtc);
+    root.insert("windowStartUtc", windowStartUtc.toString(Qt::ISODateWithMs));
+    root.insert("slotMinutes", slotMinutes);
+    root.insert("slotCount", slotCount);
+    root.insert("statusText", statusText);
+
+    QJsonArray channelOrderArray;
+    for (const QString &channelName : channelOrder) {
+        channelOrderArray.append(channelName);
+    }
+    root.insert("channelOrder", channelOrderArray);
+
+    QJsonObject entriesObject;
+    for (auto it = entriesByChannel.cbegin(); it != entriesByChannel.cend(); ++it) {
+        entriesObject.insert(it.key(), guideEntriesToJsonArray(it.value()));
+    }
+    root.insert("entriesByChannel", entriesObject);
+
+    QSaveFile cacheFile(cachePath);
+    if (!cacheFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    const QByteArray payload = QJsonDocument(root).toJson(QJsonDocument::Indented);
+    if (cacheFile.write(payload) != payload.size()) {
+        cacheFile.cancelWriting();
+        return false;
+    }
+    return cacheFile.commit();
+}
+
 QDateTime latestGuideEntryEndUtc(const QHash<QString, QList<TvGuideEntry>> &entriesByChannel)
 {
     QDateTime latestEndUtc;
@@ -3131,8 +3811,15 @@ constexpr int kGuideLookupTotalMaxMs = 4000;
 constexpr int kGuideProbeIntervalMs = 350;
 constexpr int kGuideCapturePacketCount = 60000;
 constexpr int kGuideCachePollIntervalMs = 5000;
+constexpr int kGuideCachePruneWriteDelayMs = 10000;
+constexpr int kScheduledSwitchJournalCompactEntries = 256;
 constexpr int kVideoOnlyAudioRecoveryDelayMs = 12000;
 constexpr int kRecoveryAudioUnmuteStabilityMs = 2500;
+constexpr int kLogViewMaxLines = 4000;
+constexpr int kLogViewFlushIntervalMs = 16;
+constexpr int kChannelTableFlushIntervalMs = 16;
+constexpr int kStartupTraceTimeoutMs = 120000;
+constexpr int kStartupGuideRefreshDelayMs = 4000;
 constexpr int kLivePlaybackAttachDelayMs = 900;
 constexpr int kLivePlaybackUdpBufferSizeBytes = 4 * 1024 * 1024;
 constexpr int kLivePlaybackUdpReceiveFifoPackets = 131072;
@@ -3141,7 +3828,9 @@ constexpr int kChannelTableNumberColumn = 0;
 constexpr int kChannelTableNameColumn = 1;
 constexpr int kChannelTableShowColumn = 2;
 constexpr int kChannelTableRawLineColumn = 3;
+constexpr int kChannelTableColumnCount = 4;
 constexpr auto kChannelTableNoShowText = "NO EIT DATA";
+constexpr qint64 kChannelShowBoundaryMaxDelayMs = 60LL * 60LL * 1000LL;
 
 quint8 byteAt(const QByteArray &data, int index)
 {
@@ -4189,768 +4878,1528 @@ bool captureGuideEventsForChannel(const QString &channelsFilePath,
     }
     return captured;
 }
-}
 
-MainWindow::MainWindow(QWidget *parent)
-    : QMainWindow(parent)
+// Maps the "tag:" prefix of existing free-form log lines (or the first segment of an interaction action) to a category.
+LogCategory logCategoryForTag(const QString &tag)
 {
-    QSettings startupSettings("tv_tuner_gui", "watcher");
-    disableTooltips_ = startupSettings.value(kDisableTooltipsSetting, false).toBool();
-    defaultDisplayTheme_ = defaultDisplayTheme();
-    if (!loadDisplayThemeStore(&displayThemeStore_, &pendingDisplayThemeLoadError_)) {
-        displayThemeStore_ = defaultDisplayThemeStore();
-    }
-    currentDisplayTheme_ = normalizedDisplayTheme(displayThemeStore_.currentTheme);
-    buildUi();
-    loadKeyBindings();
-    applyDisplayTheme(false);
-    qApp->installEventFilter(this);
-
-    scanProcess_ = new QProcess(this);
-    zapProcess_ = new QProcess(this);
-    streamBridgeProcess_ = new QProcess(this);
-    signalMonitorProcess_ = new QProcess(this);
-    mediaPlayer_ = new QMediaPlayer(this);
-    audioOutput_ = new QAudioOutput(this);
-    reconnectTimer_ = new QTimer(this);
-    currentShowTimer_ = new QTimer(this);
-    playbackAttachTimer_ = new QTimer(this);
-    guideRefreshTimer_ = new QTimer(this);
-    guideCachePollTimer_ = new QTimer(this);
-    scheduledSwitchTimer_ = new QTimer(this);
-    fullscreenCursorHideTimer_ = new QTimer(this);
-    audioRecoveryUnmuteTimer_ = new QTimer(this);
-    reconnectTimer_->setSingleShot(true);
-    currentShowTimer_->setSingleShot(true);
-    playbackAttachTimer_->setSingleShot(true);
-    scheduledSwitchTimer_->setSingleShot(true);
-    fullscreenCursorHideTimer_->setSingleShot(true);
-    fullscreenCursorHideTimer_->setInterval(5000);
-    audioRecoveryUnmuteTimer_->setSingleShot(true);
-    audioRecoveryUnmuteTimer_->setInterval(kRecoveryAudioUnmuteStabilityMs);
-
-    mediaPlayer_->setAudioOutput(audioOutput_);
-    mediaPlayer_->setVideoOutput(videoWidget_);
-    QSettings settings("tv_tuner_gui", "watcher");
-    const int savedVolume = std::clamp(settings.value("volume_percent", 85).toInt(), 0, 100);
-    const bool savedMuted = settings.value(kMutedSetting, false).toBool();
-    disableTooltips_ = settings.value(kDisableTooltipsSetting, false).toBool();
-    obeyScheduledSwitches_ = settings.value(kObeyScheduledSwitchesSetting, true).toBool();
-    autoFavoriteShowSchedulingEnabled_ = settings.value(kAutoFavoriteShowSchedulingSetting, true).toBool();
-    favoriteShowRatingsOverrideEnabled_ = settings.value(kFavoriteShowRatingsOverrideSetting, false).toBool();
-    autoPictureInPictureEnabled_ = settings.value(kAutoPictureInPictureSetting, true).toBool();
-    lastAutoFavoriteScheduleStamp_ =
-        settings.value(kDismissedAutoFavoriteCandidatesStampSetting).toString().trimmed();
-    dismissedAutoFavoriteCandidates_ = settings.value(kDismissedAutoFavoriteCandidatesSetting).toStringList();
-    settings.remove(kLockedAutoFavoriteSelectionsSetting);
-    settings.remove(kLockedScheduledSwitchesSetting);
-    volumeSlider_->setValue(savedVolume);
-    if (muteButton_ != nullptr) {
-        const QSignalBlocker blocker(muteButton_);
-        muteButton_->setChecked(savedMuted);
-    }
-    applyAudioOutputState();
-    if (hideNoEitChannelsCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(hideNoEitChannelsCheckBox_);
-        hideNoEitChannelsCheckBox_->setChecked(settings.value(kHideNoEitChannelsSetting, false).toBool());
-    }
-    if (showFavoritesOnlyCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(showFavoritesOnlyCheckBox_);
-        showFavoritesOnlyCheckBox_->setChecked(settings.value(kShowFavoritesOnlySetting, false).toBool());
-    }
-    if (showTodayOnlyListingsCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(showTodayOnlyListingsCheckBox_);
-        showTodayOnlyListingsCheckBox_->setChecked(settings.value(kShowTodayOnlyListingsSetting, false).toBool());
-    }
-    if (obeyScheduledSwitchesCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(obeyScheduledSwitchesCheckBox_);
-        obeyScheduledSwitchesCheckBox_->setChecked(obeyScheduledSwitches_);
-    }
-    if (autoFavoriteShowSchedulingCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(autoFavoriteShowSchedulingCheckBox_);
-        autoFavoriteShowSchedulingCheckBox_->setChecked(autoFavoriteShowSchedulingEnabled_);
-    }
-    if (favoriteShowRatingsOverrideCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(favoriteShowRatingsOverrideCheckBox_);
-        favoriteShowRatingsOverrideCheckBox_->setChecked(obeyScheduledSwitches_ && favoriteShowRatingsOverrideEnabled_);
-        favoriteShowRatingsOverrideCheckBox_->setEnabled(obeyScheduledSwitches_);
+    const QString normalized = tag.trimmed().toLower();
+    if (normalized.startsWith("guide") || normalized == "schedules-direct" || normalized == "current-show") {
+        return LogCategory::Guide;
     }
-    if (autoPictureInPictureCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(autoPictureInPictureCheckBox_);
-        autoPictureInPictureCheckBox_->setChecked(autoPictureInPictureEnabled_);
+    if (normalized == "schedule" || normalized == "favorite-show") {
+        return LogCategory::Schedule;
     }
-    if (processedPlaybackCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(processedPlaybackCheckBox_);
-        processedPlaybackCheckBox_->setChecked(settings.value(kProcessedPlaybackSetting, false).toBool());
+    if (normalized == "player" || normalized.startsWith("ffmpeg") || normalized == "fullscreen"
+        || normalized == "playback") {
+        return LogCategory::Player;
     }
-    if (hideStartupSwitchSummaryCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(hideStartupSwitchSummaryCheckBox_);
-        hideStartupSwitchSummaryCheckBox_->setChecked(
-            settings.value(kHideStartupSwitchSummarySetting, false).toBool());
+    if (normalized == "zap" || normalized == "channel") {
+        return LogCategory::Zap;
     }
-    if (disableTooltipsCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(disableTooltipsCheckBox_);
-        disableTooltipsCheckBox_->setChecked(disableTooltips_);
+    if (normalized == "signal") {
+        return LogCategory::Signal;
     }
-    if (hideStartupSwitchSummaryCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(hideStartupSwitchSummaryCheckBox_);
-        hideStartupSwitchSummaryCheckBox_->setChecked(
-            settings.value(kHideStartupSwitchSummarySetting, false).toBool());
+    if (normalized == "display-theme" || normalized == "theme") {
+        return LogCategory::Theme;
     }
-    if (logAutoScrollCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(logAutoScrollCheckBox_);
-        logAutoScrollCheckBox_->setChecked(settings.value(kLogAutoScrollSetting, true).toBool());
+    return LogCategory::General;
+}
+}
+
+struct MainWindow::GuideCacheFileData {
+    QHash<QString, QList<TvGuideEntry>> entriesByChannel;
+    QStringList channelOrder;
+    QString generatedUtc;
+    int slotMinutes{30};
+    QString statusText;
+    QString sourceStamp;
+    // Set only when retention dropped expired entries; malformed or duplicate entries do not count.
+    bool pruned{false};
+};
+
+struct MainWindow::GuideCachePruneWrite {
+    GuideCacheFileData data;
+    QDateTime windowStartUtc;
+    int slotCount{0};
+};
+
+// Only the fields belonging to `store` are filled in.
+struct MainWindow::StartupStoreResult {
+    StartupStore store{StartupStore::ChannelHints};
+    bool loaded{false};
+    QStringList logLines;
+    QHash<QString, QString> numberByTuneKey;
+    QHash<QString, QString> programByChannel;
+    QString channelsFilePath;
+    QStringList channelLines;
+    QList<TvGuideScheduledSwitch> scheduledSwitches;
+    int scheduledSwitchJournalEntries{0};
+    bool guideCachePruned{false};
+    GuideCacheFileData guideCache;
+};
+
+// Guide-side view of channelLines_, built once per channel list and shared by the EIT and Schedules Direct
+// importers. identities runs parallel to channels.
+struct MainWindow::GuideChannelIndex {
+    quint64 generation{0};
+    QVector<GuideChannelInfo> channels;
+    QVector<GuideChannelIdentity> identities;
+    QHash<QString, int> nameCounts;
+    QHash<qint64, QVector<GuideChannelInfo>> channelsByFrequency;
+    QHash<qint64, QHash<int, QStringList>> namesByServiceIdByFrequency;
+    QString schedulesDirectStamp;
+    QHash<QString, int> schedulesDirectMatchByName;
+};
+
+// Favorite-show view of the guide entries used for scheduling: normalized title -> normalized switches in channel
+// order, rebuilt once per guide snapshot. The processed* fields survive rebuilds so the auto-scheduler can tell
+// which occurrences it already considered.
+struct MainWindow::FavoriteShowIndex {
+    quint64 generation{0};
+    QHash<QString, QList<TvGuideScheduledSwitch>> occurrencesByTitle;
+    QSet<QString> processedRules;
+    QSet<QString> processedOccurrenceKeys;
+};
+
+struct MainWindow::SchedulesDirectSyncResult {
+    bool ok{false};
+    bool usedCachedExport{false};
+    QString summary;
+    QString errorText;
+    // Only a fresh download fills this: the compact export it just saved, already mapped onto the local channels.
+    QJsonObject exportRoot;
+};
+
+// One Schedules Direct download in flight. Each stage enqueues its request and the reply callback starts the next
+// stage, so the UI thread never waits on the network.
+struct MainWindow::SchedulesDirectSync {
+    struct Lineup {
+        QString id;
+        QUrl url;
+        QJsonObject object;
+        QHash<QString, QJsonObject> stationById;
+        QSet<QString> stationIdSet;
+        QJsonArray schedulesRequestArray;
+        QHash<QString, QHash<QString, QString>> remoteDayMd5sByStation;
+        QJsonArray changedSchedulesRequestArray;
+        QSet<QString> fullScheduleStationIds;
+        QStringList uniqueProgramIds;
+        int scheduleDays{0};
+        int scheduleEntries{0};
+        int programChunkCount{0};
+        int finishedProgramChunks{0};
+    };
+
+    SchedulesDirectClient *client{};
+    SchedulesDirectSyncCallback onFinished;
+    bool allowCachedExport{false};
+    QString username;
+    QString postalCode;
+    QString exportPath;
+    QString cachedExportPath;
+    int retentionHours{0};
+    QJsonObject tokenObject;
+    QJsonObject statusObject;
+    QJsonArray otaHeadends;
+    QStringList otaLineupIds;
+    QSet<QString> accountLineupIds;
+    int lineupIndex{0};
+    Lineup lineup;
+    QJsonArray addedLineups;
+    QJsonArray exportedLineups;
+    QJsonArray sdChannels;
+    QString rawDumpPath;
+    QJsonArray rawDumpLineups;
+    int totalChannels{0};
+    int totalScheduleEntries{0};
+    int totalResolvedPrograms{0};
+    QString syncCachePath;
+    SchedulesDirectSyncCache syncCache;
+    QSet<QString> syncedStationIds;
+    QSet<QString> referencedProgramIds;
+    qint64 syncDownloadedBytes{0};
+    int reusedScheduleDays{0};
+    int reusedPrograms{0};
+};
+
+// Fixed-capacity ring of log records; the oldest rows fall off the front as new ones arrive.
+class MainWindow::LogLinesModel : public QAbstractListModel
+{
+public:
+    explicit LogLinesModel(int capacity, QObject *parent = nullptr)
+        : QAbstractListModel(parent)
+        , lines_(std::max(1, capacity))
+    {
     }
-    if (useSchedulesDirectGuideCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(useSchedulesDirectGuideCheckBox_);
-        useSchedulesDirectGuideCheckBox_->setChecked(settings.value(kUseSchedulesDirectGuideSetting, false).toBool());
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : count_;
     }
-    if (refreshGuideWhenCacheRunsOutCheckBox_ != nullptr) {
-        const QSignalBlocker blocker(refreshGuideWhenCacheRunsOutCheckBox_);
-        refreshGuideWhenCacheRunsOutCheckBox_->setChecked(
-            settings.value(kGuideRefreshWhenCacheRunsOutSetting, false).toBool());
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (!index.isValid() || index.row() < 0 || index.row() >= count_ || role != Qt::DisplayRole) {
+            return {};
+        }
+        return lineAt(index.row());
     }
-    if (guideRefreshIntervalCombo_ != nullptr) {
-        const QSignalBlocker blocker(guideRefreshIntervalCombo_);
-        const int selectedMinutes =
-            nearestGuideRefreshIntervalMinutes(settings.value(kGuideRefreshIntervalMinutesSetting,
-                                                              kDefaultGuideRefreshIntervalMinutes)
-                                                   .toInt());
-        const int index = guideRefreshIntervalCombo_->findData(selectedMinutes);
-        guideRefreshIntervalCombo_->setCurrentIndex(index >= 0 ? index : 0);
+
+    // Timestamps are turned into text here, so only rows the view actually paints pay for formatting.
+    QString lineAt(int row) const
+    {
+        return formatLogRecordText(lines_.at((head_ + row) % lines_.size()));
     }
-    if (guideCacheRetentionCombo_ != nullptr) {
-        const QSignalBlocker blocker(guideCacheRetentionCombo_);
-        const int selectedHours =
-            nearestGuideCacheRetentionHours(settings.value(kGuideCacheRetentionHoursSetting,
-                                                           kDefaultGuideCacheRetentionHours)
-                                                .toInt());
-        const int index = guideCacheRetentionCombo_->findData(selectedHours);
-        guideCacheRetentionCombo_->setCurrentIndex(index >= 0 ? index : 0);
+
+    // Returns the number of rows dropped from the front to make room.
+    int appendRecords(const QList<LogRecord> &lines)
+    {
+        const int capacity = static_cast<int>(lines_.size());
+        const int incoming = std::min(static_cast<int>(lines.size()), capacity);
+        if (incoming <= 0) {
+            return 0;
+        }
+
+        const int overflow = std::max(0, count_ + incoming - capacity);
+        if (overflow > 0) {
+            beginRemoveRows(QModelIndex(), 0, overflow - 1);
+            for (int i = 0; i < overflow; ++i) {
+                lines_[head_] = LogRecord();
+                head_ = (head_ + 1) % capacity;
+            }
+            count_ -= overflow;
+            endRemoveRows();
+        }
+
+        beginInsertRows(QModelIndex(), count_, count_ + incoming - 1);
+        for (qsizetype i = lines.size() - incoming; i < lines.size(); ++i) {
+            lines_[(head_ + count_) % capacity] = lines.at(i);
+            ++count_;
+        }
+        endInsertRows();
+        return overflow;
     }
-    if (schedulesDirectUsernameEdit_ != nullptr) {
-        const QSignalBlocker blocker(schedulesDirectUsernameEdit_);
-        schedulesDirectUsernameEdit_->setText(settings.value(kSchedulesDirectUsernameSetting).toString().trimmed());
+
+    void clear()
+    {
+        beginResetModel();
+        lines_.fill(LogRecord());
+        head_ = 0;
+        count_ = 0;
+        endResetModel();
     }
-    if (schedulesDirectPasswordEdit_ != nullptr) {
-        const QSignalBlocker blocker(schedulesDirectPasswordEdit_);
-        schedulesDirectPasswordEdit_->setText(settings.value(kSchedulesDirectPasswordSha1Setting).toString().trimmed());
+
+private:
+    QList<LogRecord> lines_;
+    int head_{0};
+    int count_{0};
+};
+
+// Channel rows with label and tune-line indexes. Sorting happens here rather than in a proxy, so view rows
+// and model rows always line up.
+class MainWindow::ChannelListModel : public QAbstractTableModel
+{
+public:
+    explicit ChannelListModel(QObject *parent = nullptr)
+        : QAbstractTableModel(parent)
+    {
     }
-    if (schedulesDirectPostalCodeEdit_ != nullptr) {
-        const QSignalBlocker blocker(schedulesDirectPostalCodeEdit_);
-        schedulesDirectPostalCodeEdit_->setText(settings.value(kSchedulesDirectPostalCodeSetting).toString().trimmed());
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : static_cast<int>(rows_.size());
     }
-    applyGuideFilterSettings();
-    applyGuideRefreshIntervalSetting();
-    updateSchedulesDirectControls();
 
-    connect(scanProcess_, &QProcess::readyReadStandardOutput, this, &MainWindow::handleStdOut);
-    connect(scanProcess_, &QProcess::readyReadStandardError, this, &MainWindow::handleStdErr);
-    connect(scanProcess_, &QProcess::finished, this, &MainWindow::processFinished);
-    connect(zapProcess_, &QProcess::readyReadStandardError, this, &MainWindow::handleZapStdErr);
-    connect(zapProcess_, &QProcess::finished, this, &MainWindow::handleZapFinished);
-    connect(zapProcess_, &QProcess::errorOccurred, this, [this](QProcess::ProcessError error) {
-        appendLog(QString("zap: errorOccurred=%1 (%2)")
-                      .arg(processErrorToString(error), zapProcess_->errorString()));
-    });
-    signalMonitorProcess_->setProcessChannelMode(QProcess::MergedChannels);
-    connect(signalMonitorProcess_, &QProcess::readyReadStandardOutput, this, [this]() {
-        handleSignalMonitorOutput(QString::fromUtf8(signalMonitorProcess_->readAllStandardOutput()));
-    });
-    connect(signalMonitorProcess_, &QProcess::finished, this, &MainWindow::handleSignalMonitorFinished);
-    connect(signalMonitorProcess_, &QProcess::errorOccurred, this, [this](QProcess::ProcessError error) {
-        if (currentChannelName_.isEmpty() || userStoppedWatching_) {
-            return;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : kChannelTableColumnCount;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (!index.isValid() || index.row() < 0 || index.row() >= rows_.size()) {
+            return {};
         }
-        setSignalMonitorStatus("Signal: unavailable",
-                               QString("dvb-fe-tool error: %1 (%2)")
-                                   .arg(processErrorToString(error), signalMonitorProcess_->errorString()));
-        appendLog(QString("signal: dvb-fe-tool errorOccurred=%1 (%2)")
-                      .arg(processErrorToString(error), signalMonitorProcess_->errorString()));
-    });
-    connect(streamBridgeProcess_, &QProcess::errorOccurred, this, [this](QProcess::ProcessError error) {
-        appendLog(QString("ffmpeg bridge: errorOccurred=%1 (%2)")
-                      .arg(processErrorToString(error), streamBridgeProcess_->errorString()));
-    });
-    connect(streamBridgeProcess_, &QProcess::readyReadStandardError, this, [this]() {
-        const QString err = QString::fromUtf8(streamBridgeProcess_->readAllStandardError()).trimmed();
-        if (!err.isEmpty()) {
-            const QStringList lines = err.split('\n');
-            for (const QString &line : lines) {
-                const QString trimmed = line.trimmed();
-                if (!trimmed.isEmpty()) {
-                    const QString lowerTrimmed = trimmed.toLower();
-                    if (lowerTrimmed.contains("could not find codec parameters")
-                        || lowerTrimmed.contains("could not write header")
-                        || lowerTrimmed.contains("sample rate not set")) {
-                        bridgeSawCodecParameterFailure_ = true;
-                    }
-                    appendLog("ffmpeg: " + trimmed);
-                }
-            }
+        const ChannelTableRow &row = rows_.at(index.row());
+        if (role == Qt::ToolTipRole && index.column() == kChannelTableShowColumn && !row.nextShow.isEmpty()) {
+            return QString("Next: %1").arg(row.nextShow);
         }
-    });
-    connect(streamBridgeProcess_, &QProcess::finished, this, [this](int exitCode, QProcess::ExitStatus status) {
-        appendLog(QString("ffmpeg bridge exited (code=%1, status=%2, error=%3)")
-                      .arg(exitCode)
-                      .arg(status == QProcess::NormalExit ? "normal" : "crash")
-                      .arg(streamBridgeProcess_->errorString()));
-        if (zapProcess_ != nullptr && zapProcess_->state() != QProcess::NotRunning) {
-            suppressZapExitReconnect_ = true;
-            stopProcess(zapProcess_, 1000);
-            suppressZapExitReconnect_ = false;
+        if (role != Qt::DisplayRole) {
+            return {};
         }
-        if (!suppressBridgeExitReconnect_ && !userStoppedWatching_ && !currentChannelName_.isEmpty()) {
-            if (tryDynamicBridgeFallback("Live stream bridge exited")) {
-                return;
-            }
-            scheduleReconnect("Live stream bridge exited");
+        return columnText(row, index.column());
+    }
+
+    QVariant headerData(int section, Qt::Orientation orientation, int role) const override
+    {
+        static const QStringList labels{"Channel Number", "Channel", "TV Show", "Raw line"};
+        if (orientation != Qt::Horizontal || role != Qt::DisplayRole || section < 0 || section >= labels.size()) {
+            return QAbstractTableModel::headerData(section, orientation, role);
         }
-    });
-    connect(mediaPlayer_, &QMediaPlayer::mediaStatusChanged, this, &MainWindow::handleMediaStatusChanged);
-    connect(mediaPlayer_, &QMediaPlayer::playbackStateChanged, this, [this]() {
-        appendLog(QString("player: playbackStateChanged=%1").arg(static_cast<int>(mediaPlayer_->playbackState())));
-        playbackStatusLabel_->setText(playbackStatusText());
-        refreshLocalMediaSignalStatus();
-        syncFullscreenOverlayState();
-        refreshRecoveryAudioMuteGate();
-    });
-    connect(mediaPlayer_, &QMediaPlayer::errorChanged, this, [this]() {
-        if (mediaPlayer_->error() != QMediaPlayer::NoError) {
-            appendLog(QString("player: errorChanged code=%1 text=%2")
-                          .arg(static_cast<int>(mediaPlayer_->error()))
-                          .arg(mediaPlayer_->errorString()));
-            handlePlayerError(mediaPlayer_->errorString());
+        return labels.at(section);
+    }
+
+    void sort(int column, Qt::SortOrder order) override
+    {
+        sortColumn_ = column;
+        sortOrder_ = order;
+        if (column < 0 || column >= kChannelTableColumnCount || rows_.size() < 2) {
+            // appendRows relies on sort() to index the rows it just added, even when there is nothing to reorder.
+            rebuildIndexes();
+            return;
         }
-    });
-    connect(mediaPlayer_, &QMediaPlayer::errorOccurred, this, [this](QMediaPlayer::Error error, const QString &errorString) {
-        appendLog(QString("player: errorOccurred code=%1 text=%2").arg(static_cast<int>(error)).arg(errorString));
-    });
-    connect(mediaPlayer_, &QMediaPlayer::hasVideoChanged, this, [this](bool hasVideo) {
-        appendLog(QString("player: hasVideoChanged=%1").arg(hasVideo ? "true" : "false"));
-        Q_UNUSED(hasVideo);
-        refreshLocalMediaSignalStatus();
-        refreshRecoveryAudioMuteGate();
-    });
-    connect(mediaPlayer_, &QMediaPlayer::hasAudioChanged, this, [this](bool hasAudio) {
-        const QString playbackMode = useVideoOnlyBridgeMode_
-                                         ? "video-only"
-                                         : (useResilientBridgeMode_
-                                                ? "resilient"
-                                                : (processedPlaybackActive_ ? "processed" : "normal"));
-        appendLog(QString("player: hasAudioChanged=%1 (playbackState=%2, mediaStatus=%3, mode=%4, hasVideo=%5)")
-                      .arg(hasAudio ? "true" : "false")
-                      .arg(static_cast<int>(mediaPlayer_->playbackState()))
-                      .arg(static_cast<int>(mediaPlayer_->mediaStatus()))
-                      .arg(playbackMode)
-                      .arg(mediaPlayer_->hasVideo() ? "true" : "false"));
-        if (!hasAudio
-            && !currentChannelName_.isEmpty()
-            && !currentChannelName_.startsWith("File: ")
-            && mediaPlayer_->playbackState() == QMediaPlayer::PlayingState) {
-            appendLog("player: live audio disappeared while playback continued; monitoring bridge/buffer state.");
+
+        emit layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+        const QList<int> newRowForOldRow = sortRows();
+        const QModelIndexList oldIndexes = persistentIndexList();
+        QModelIndexList newIndexes;
+        newIndexes.reserve(oldIndexes.size());
+        for (const QModelIndex &oldIndex : oldIndexes) {
+            newIndexes.append(index(newRowForOldRow.at(oldIndex.row()), oldIndex.column()));
         }
-        if (hasAudio && mediaPlayer_->hasVideo()) {
-            bridgeSawCodecParameterFailure_ = false;
+        changePersistentIndexList(oldIndexes, newIndexes);
+        emit layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+    }
+
+    int sortColumn() const
+    {
+        return sortColumn_;
+    }
+
+    void clear()
+    {
+        beginResetModel();
+        rows_.clear();
+        rebuildIndexes();
+        endResetModel();
+    }
+
+    void setRows(QList<ChannelTableRow> rows)
+    {
+        beginResetModel();
+        rows_ = std::move(rows);
+        if (sortColumn_ >= 0 && sortColumn_ < kChannelTableColumnCount) {
+            sortRows();
+        } else {
+            rebuildIndexes();
         }
-        refreshLocalMediaSignalStatus();
-        refreshRecoveryAudioMuteGate();
-    });
-    connect(mediaPlayer_, &QMediaPlayer::metaDataChanged, this, [this]() {
-        refreshLocalMediaSignalStatus();
-    });
-    connect(mediaPlayer_, &QMediaPlayer::bufferProgressChanged, this, [this](float progress) {
-        appendLog(QString("player: bufferProgress=%1").arg(progress, 0, 'f', 3));
-    });
-    connect(mediaPlayer_, &QMediaPlayer::durationChanged, this, [this](qint64) {
-        syncPlaybackSeekUi();
-    });
-    connect(mediaPlayer_, &QMediaPlayer::positionChanged, this, [this](qint64) {
-        syncPlaybackSeekUi();
-    });
-    connect(mediaPlayer_, &QMediaPlayer::seekableChanged, this, [this](bool) {
-        syncPlaybackSeekUi();
-    });
-    connect(reconnectTimer_, &QTimer::timeout, this, &MainWindow::triggerReconnect);
-    connect(currentShowTimer_, &QTimer::timeout, this, &MainWindow::refreshCurrentShowStatus);
-    connect(playbackAttachTimer_, &QTimer::timeout, this, [this]() {
-        if (!waitingForDvrReady_ || pendingDvrPath_.isEmpty()) {
+        endResetModel();
+    }
+
+    void appendRows(const QList<ChannelTableRow> &rows)
+    {
+        if (rows.isEmpty()) {
             return;
         }
-        appendLog("player: DVR ready signal timeout; attempting playback anyway.");
-        startPlaybackFromDvr(pendingDvrPath_);
-    });
-    connect(audioRecoveryUnmuteTimer_, &QTimer::timeout, this, [this]() {
-        if (!recoveryAudioMuted_ || !isRecoveryAudioStable()) {
-            refreshRecoveryAudioMuteGate();
-            return;
+        const int firstRow = static_cast<int>(rows_.size());
+        beginInsertRows(QModelIndex(), firstRow, firstRow + static_cast<int>(rows.size()) - 1);
+        rows_.append(rows);
+        endInsertRows();
+        if (sortColumn_ >= 0 && sortColumn_ < kChannelTableColumnCount) {
+            sort(sortColumn_, sortOrder_);
+        } else {
+            rebuildIndexes();
         }
-        clearRecoveryAudioMute();
-        muteRecoveryAfterAudioRebuildFailure_ = false;
-        const bool userMuted = muteButton_ != nullptr && muteButton_->isChecked();
-        appendLog(userMuted ? "player: rebuilt audio stabilized; recovery mute released but user mute remains enabled."
-                            : "player: rebuilt audio stabilized; unmuting recovered audio.");
-        setStatusBarStateMessage(userMuted ? "Recovered audio ready (user muted)"
-                                           : "Recovered audio restored");
-    });
-    connect(scheduledSwitchTimer_, &QTimer::timeout, this, &MainWindow::processScheduledSwitches);
-    connect(fullscreenCursorHideTimer_, &QTimer::timeout, this, &MainWindow::hideFullscreenCursor);
-    connect(guideRefreshTimer_, &QTimer::timeout, this, [this]() {
-        appendLog("guide-bg: scheduled guide cache refresh triggered.");
-        if (refreshGuideData(false, false)) {
-            loadGuideCacheFile();
-            applyCurrentShowStatusFromGuideCache();
-            updateTvGuideDialogFromCurrentCache(false);
-        }
-    });
-    guideCachePollTimer_->setInterval(kGuideCachePollIntervalMs);
-    connect(guideCachePollTimer_, &QTimer::timeout, this, [this]() {
-        const bool guideDialogVisible = tvGuideDialog_ != nullptr && tvGuideDialog_->isVisible();
-        const bool refreshedBecauseCacheRanOut = maybeRefreshGuideWhenCacheRunsOut(guideDialogVisible);
-        refreshChannelTableShowColumn();
-        if (!guideDialogVisible || refreshedBecauseCacheRanOut) {
-            return;
-        }
-        if (loadGuideCacheFile()) {
-            updateTvGuideDialogFromCurrentCache(false);
-        }
-    });
-    connect(volumeSlider_, &QSlider::valueChanged, this, &MainWindow::handleVolumeChanged);
-    connect(seekSlider_, &QSlider::sliderMoved, this, [this](int value) {
-        if (fullscreenSeekSlider_ != nullptr) {
-            const QSignalBlocker blocker(fullscreenSeekSlider_);
-            fullscreenSeekSlider_->setValue(value);
-        }
-        if (seekPositionLabel_ != nullptr) {
-            seekPositionLabel_->setText(playbackSeekLabelText(value));
-        }
-        if (fullscreenSeekPositionLabel_ != nullptr) {
-            fullscreenSeekPositionLabel_->setText(playbackSeekLabelText(value));
-        }
-    });
-    connect(seekSlider_, &QSlider::valueChanged, this, [this](int value) {
-        if (fullscreenSeekSlider_ != nullptr && fullscreenSeekSlider_->value() != value) {
-            const QSignalBlocker blocker(fullscreenSeekSlider_);
-            fullscreenSeekSlider_->setValue(value);
-        }
-        if (seekPositionLabel_ != nullptr) {
-            seekPositionLabel_->setText(playbackSeekLabelText(value));
-        }
-        if (fullscreenSeekPositionLabel_ != nullptr) {
-            fullscreenSeekPositionLabel_->setText(playbackSeekLabelText(value));
-        }
-        if ((seekSlider_ != nullptr && seekSlider_->isSliderDown())
-            || (QApplication::mouseButtons() & Qt::LeftButton)) {
-            applyPlaybackSeekPosition(value);
-        }
-    });
-    connect(seekSlider_, &QSlider::sliderReleased, this, [this]() {
-        if (seekSlider_ != nullptr) {
-            applyPlaybackSeekPosition(seekSlider_->value());
-        }
-    });
-    connect(muteButton_, &QPushButton::toggled, this, &MainWindow::handleMuteToggled);
-    connect(logAutoScrollCheckBox_, &QCheckBox::toggled, this, [](bool checked) {
-        QSettings settings("tv_tuner_gui", "watcher");
-        settings.setValue(kLogAutoScrollSetting, checked);
-    });
-    connect(contentSplitter_, &QSplitter::splitterMoved, this, [this](int, int) {
-        saveChannelSidebarSizing();
-    });
-
-    logFilePath_ = resolveProjectLogPath();
-    loadFavorites();
-    loadFavoriteShowRules();
-    loadTestingBugItems();
-    loadXspfChannelHints();
-    loadChannelsFileIfPresent();
-    purgeExpiredGuideCacheFiles(true, true);
-    loadScheduledSwitches();
-    loadGuideCacheFile();
-    refreshFavoriteShowRuleList();
-    syncFavoriteShowRatingControls();
-    refreshScheduledSwitchList();
-    refreshQuickButtons();
-    playbackStatusLabel_->setText(playbackStatusText());
-    setSignalMonitorStatus("Signal: n/a");
-    setCurrentShowStatus("NO EIT DATA");
-    syncFullscreenOverlayState();
-    updateTvGuideDialogFromCurrentCache(false);
-    refreshScheduledSwitchTimer();
-    guideCachePollTimer_->start();
-    if (!pendingDisplayThemeLoadError_.trimmed().isEmpty()) {
-        appendLog(QString("display-theme: %1").arg(pendingDisplayThemeLoadError_));
-        setDisplayThemeStatusMessage("Theme file had issues; defaults were loaded.", false);
-    } else {
-        persistDisplayThemeStore("Display theme ready", false);
     }
 
-    QTimer::singleShot(0, this, [this]() {
-        const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-        if (guideCacheLooksCurrentForStartup(guideEntriesCache_, lastGuideWindowStartUtc_, nowUtc)) {
-            const QDateTime cacheCoverageEndUtc =
-                guideCacheCoverageEndUtc_.isValid() ? guideCacheCoverageEndUtc_ : latestGuideEntryEndUtc(guideEntriesCache_);
-            appendLog(QString("guide-bg: startup guide refresh skipped; cache already covers current time through %1")
-                          .arg(cacheCoverageEndUtc.toLocalTime().toString("ddd h:mm AP")));
-        } else {
-            appendLog("guide-bg: building initial guide cache at startup.");
-            if (refreshGuideData(false, false)) {
-                loadGuideCacheFile();
-                applyCurrentShowStatusFromGuideCache();
-            }
-        }
-        deferStartupAutoFavoriteScheduling_ = false;
-        logInteraction("program",
-                       "startup.favorite-show.auto-scan",
-                       QString("guide-cache-loaded=%1 favorites=%2 queue-before=%3")
-                           .arg(guideEntriesCache_.isEmpty() ? "false" : "true",
-                                favoriteShowRules_.join(" | "),
-                                summarizeScheduledSwitchesDebug(scheduledSwitches_)));
-        autoScheduleFavoriteShowsFromGuideCache(false, false);
-        if (!refreshGuideWhenCacheRunsOutEnabled()) {
-            guideRefreshTimer_->start();
-        }
-        setStatusBarStateMessage(lastStatusBarMessage_);
-        restoreChannelSidebarSizing();
-        const bool startupScheduledTuneAvailable = obeyScheduledSwitches_ && hasActiveScheduledSwitchesNow();
-        if (startupScheduledTuneAvailable) {
-            appendLog("startup: active scheduled tune available; deferring to scheduled-switch timer to avoid duplicate prompts.");
-            QTimer::singleShot(0, this, [this]() {
-                if (!currentChannelName_.trimmed().isEmpty()) {
-                    appendLog("startup: scheduled tuning already started playback before fallback check.");
-                    return;
-                }
-                if (obeyScheduledSwitches_ && hasActiveScheduledSwitchesNow()) {
-                    appendLog("startup: scheduled tuning still pending after startup deferral; leaving last channel restore skipped.");
-                    return;
-                }
-                appendLog("startup: scheduled tuning did not start playback; restoring last channel.");
-                restoreLastPlayedChannel();
-            });
-        } else {
-            appendLog("startup: no active scheduled tune available; restoring last channel.");
-            restoreLastPlayedChannel();
-        }
-        showStartupSwitchSummary();
-    });
-}
-
-MainWindow::~MainWindow()
-{
-    qApp->removeEventFilter(this);
-    exitFullscreen();
-    userStoppedWatching_ = true;
-    if (reconnectTimer_ != nullptr) {
-        reconnectTimer_->stop();
-    }
-    if (currentShowTimer_ != nullptr) {
-        currentShowTimer_->stop();
-    }
-    if (playbackAttachTimer_ != nullptr) {
-        playbackAttachTimer_->stop();
-    }
-    if (guideRefreshTimer_ != nullptr) {
-        guideRefreshTimer_->stop();
-    }
-    if (guideCachePollTimer_ != nullptr) {
-        guideCachePollTimer_->stop();
-    }
-    if (scheduledSwitchTimer_ != nullptr) {
-        scheduledSwitchTimer_->stop();
-    }
-    if (fullscreenCursorHideTimer_ != nullptr) {
-        fullscreenCursorHideTimer_->stop();
-    }
-    if (mediaPlayer_ != nullptr) {
-        mediaPlayer_->stop();
-        mediaPlayer_->setSource(QUrl());
+    const ChannelTableRow &rowAt(int row) const
+    {
+        return rows_.at(row);
     }
 
-    if (pipWindow_ != nullptr) {
-        pipWindow_->hide();
+    // Both lookups return the first row in display order, matching the linear scans they replace.
+    int rowForLabel(const QString &label) const
+    {
+        return rowByLabel_.value(label.trimmed(), -1);
     }
 
-    suppressBridgeExitReconnect_ = true;
-    stopProcess(streamBridgeProcess_, 1200);
-    suppressBridgeExitReconnect_ = false;
-
-    stopProcess(signalMonitorProcess_, 1000);
-
-    suppressZapExitReconnect_ = true;
-    stopProcess(zapProcess_, 1200);
-    suppressZapExitReconnect_ = false;
-
-    stopProcess(scanProcess_, 1200);
-}
-
-void MainWindow::closeEvent(QCloseEvent *event)
-{
-    appendLog("Application closing: releasing tuner resources.");
-    if (pipWindow_ != nullptr) {
-        pipWindow_->hide();
+    int rowForLine(const QString &channelLine) const
+    {
+        return rowByLine_.value(normalizeZapLine(channelLine).trimmed(), -1);
     }
-    exitFullscreen();
-    saveChannelSidebarSizing();
-    stopWatching();
-    stopProcess(scanProcess_, 1200);
-    QMainWindow::closeEvent(event);
-}
-
-void MainWindow::resizeEvent(QResizeEvent *event)
-{
-    QMainWindow::resizeEvent(event);
-    QTimer::singleShot(0, this, [this]() {
-        syncConfigGroupBoxHeights();
-    });
-}
 
-bool MainWindow::eventFilter(QObject *watched, QEvent *event)
-{
-    if (disableTooltips_ && event != nullptr && event->type() == QEvent::ToolTip) {
-        QToolTip::hideText();
-        event->ignore();
-        return true;
+    QStringList labels() const
+    {
+        QStringList labels;
+        labels.reserve(rows_.size());
+        for (const ChannelTableRow &row : rows_) {
+            labels.append(row.label.trimmed());
+        }
+        return labels;
     }
 
-    auto *watchedWidget = qobject_cast<QWidget *>(watched);
-    const bool watchedInsideFullscreenWindow =
-        fullscreenWindow_ != nullptr
-        && watchedWidget != nullptr
-        && (watchedWidget == fullscreenWindow_ || fullscreenWindow_->isAncestorOf(watchedWidget));
-    const bool watchedInsideFullscreenOverlay =
-        fullscreenOverlayContainer_ != nullptr
-        && watchedWidget != nullptr
-        && (watchedWidget == fullscreenOverlayContainer_
-            || fullscreenOverlayContainer_->isAncestorOf(watchedWidget));
-    const bool watchedInsideFullscreenRegion = watchedInsideFullscreenWindow || watchedInsideFullscreenOverlay;
-    const bool fullscreenActivityEvent =
-        fullscreenActive_
-        && event != nullptr
-        && (event->type() == QEvent::Enter
-            || event->type() == QEvent::MouseMove
-            || event->type() == QEvent::MouseButtonPress
-            || event->type() == QEvent::MouseButtonRelease
-            || event->type() == QEvent::Wheel
-            || event->type() == QEvent::HoverMove);
-
-    if (watched == videoWidget_ && event->type() == QEvent::MouseButtonDblClick) {
-        enterFullscreen();
+    // Only emits dataChanged when the visible show text or its tooltip actually changed.
+    bool setShow(int row, const QString &show, const QString &nextShow, const QDateTime &changesUtc)
+    {
+        ChannelTableRow &target = rows_[row];
+        target.showChangesUtc = changesUtc;
+        if (target.show == show && target.nextShow == nextShow) {
+            return false;
+        }
+        target.show = show;
+        target.nextShow = nextShow;
+        const QModelIndex showIndex = index(row, kChannelTableShowColumn);
+        emit dataChanged(showIndex, showIndex, {Qt::DisplayRole, Qt::ToolTipRole});
         return true;
     }
 
-    if (watched == pipWindow_ && event->type() == QEvent::Close) {
-        if (videoDetachedToPip_) {
-            manualPictureInPictureRequested_ = false;
-            attachVideoFromPip();
-            appendLog("player: PiP window closed; video returned to the main window.");
-            setStatusBarStateMessage("Video returned to main window");
+private:
+    static const QString &columnText(const ChannelTableRow &row, int column)
+    {
+        switch (column) {
+        case kChannelTableNumberColumn:
+            return row.number;
+        case kChannelTableNameColumn:
+            return row.label;
+        case kChannelTableShowColumn:
+            return row.show;
+        default:
+            return row.rawLine;
         }
-        event->ignore();
-        return true;
     }
 
-    if (watched == pipVideoWidget_ && event->type() == QEvent::MouseButtonDblClick) {
-        if (tabs_ != nullptr && watchPage_ != nullptr) {
-            tabs_->setCurrentWidget(watchPage_);
-        } else {
-            attachVideoFromPip();
+    // Stable-sorts rows_ by the current sort column and returns each old row's new position.
+    QList<int> sortRows()
+    {
+        QList<int> oldRows(rows_.size());
+        for (int row = 0; row < oldRows.size(); ++row) {
+            oldRows[row] = row;
+        }
+        const int column = sortColumn_;
+        const bool ascending = sortOrder_ == Qt::AscendingOrder;
+        std::stable_sort(oldRows.begin(), oldRows.end(), [this, column, ascending](int left, int right) {
+            const QString &leftText = columnText(rows_.at(left), column);
+            const QString &rightText = columnText(rows_.at(right), column);
+            return ascending ? leftText < rightText : rightText < leftText;
+        });
+
+        QList<ChannelTableRow> sortedRows;
+        sortedRows.reserve(rows_.size());
+        QList<int> newRowForOldRow(rows_.size());
+        for (int newRow = 0; newRow < oldRows.size(); ++newRow) {
+            sortedRows.append(std::move(rows_[oldRows.at(newRow)]));
+            newRowForOldRow[oldRows.at(newRow)] = newRow;
         }
-        return true;
+        rows_ = std::move(sortedRows);
+        rebuildIndexes();
+        return newRowForOldRow;
     }
 
-    if ((watchedInsideFullscreenRegion || watched == fullscreenVideoWidget_)
-        && event->type() == QEvent::MouseButtonDblClick) {
-        exitFullscreen();
-        return true;
+    void rebuildIndexes()
+    {
+        rowByLabel_.clear();
+        rowByLine_.clear();
+        rowByLabel_.reserve(rows_.size());
+        rowByLine_.reserve(rows_.size());
+        // Walking backwards leaves the first of any duplicates in the index.
+        for (int row = static_cast<int>(rows_.size()) - 1; row >= 0; --row) {
+            rowByLabel_.insert(rows_.at(row).label.trimmed(), row);
+            rowByLine_.insert(normalizeZapLine(rows_.at(row).rawLine).trimmed(), row);
+        }
+    }
+
+    QList<ChannelTableRow> rows_;
+    QHash<QString, int> rowByLabel_;
+    QHash<QString, int> rowByLine_;
+    int sortColumn_{-1};
+    Qt::SortOrder sortOrder_{Qt::AscendingOrder};
+};
+
+MainWindow::MainWindow(QWidget *parent)
+    : QMainWindow(parent)
+{
+    QSettings startupSettings("tv_tuner_gui", "watcher");
+    disableTooltips_ = startupSettings.value(kDisableTooltipsSetting, false).toBool();
+    defaultDisplayTheme_ = defaultDisplayTheme();
+    if (!loadDisplayThemeStore(&displayThemeStore_, &pendingDisplayThemeLoadError_)) {
+        displayThemeStore_ = defaultDisplayThemeStore();
+    }
+    currentDisplayTheme_ = normalizedDisplayTheme(displayThemeStore_.currentTheme);
+    {
+        const StartupTraceScope trace("build-ui");
+        buildUi();
+    }
+    loadKeyBindings();
+    {
+        const StartupTraceScope trace("apply-display-theme");
+        applyDisplayTheme(false);
     }
+    qApp->installEventFilter(this);
 
-    if (fullscreenActivityEvent) {
-        const bool overlayHidden = fullscreenOverlayContainer_ != nullptr && !fullscreenOverlayContainer_->isVisible();
-        const QRect overlayGeometry =
-            fullscreenOverlayContainer_ != nullptr ? fullscreenOverlayContainer_->geometry() : QRect();
-        const QRect fullscreenGeometry =
-            fullscreenWindow_ != nullptr ? fullscreenWindow_->geometry() : QRect();
+    scanProcess_ = new QProcess(this);
+    zapProcess_ = new QProcess(this);
+    streamBridgeProcess_ = new QProcess(this);
+    signalMonitorProcess_ = new QProcess(this);
+    mediaPlayer_ = new QMediaPlayer(this);
+    audioOutput_ = new QAudioOutput(this);
+    reconnectTimer_ = new QTimer(this);
+    currentShowTimer_ = new QTimer(this);
+    playbackAttachTimer_ = new QTimer(this);
+    guideRefreshTimer_ = new QTimer(this);
+    guideCachePollTimer_ = new QTimer(this);
+    guideCachePruneWriteTimer_ = new QTimer(this);
+    scheduledSwitchTimer_ = new QTimer(this);
+    fullscreenCursorHideTimer_ = new QTimer(this);
+    audioRecoveryUnmuteTimer_ = new QTimer(this);
+    logViewFlushTimer_ = new QTimer(this);
+    channelTableFlushTimer_ = new QTimer(this);
+    channelShowBoundaryTimer_ = new QTimer(this);
+    reconnectTimer_->setSingleShot(true);
+    currentShowTimer_->setSingleShot(true);
+    playbackAttachTimer_->setSingleShot(true);
+    scheduledSwitchTimer_->setSingleShot(true);
+    fullscreenCursorHideTimer_->setSingleShot(true);
+    fullscreenCursorHideTimer_->setInterval(5000);
+    audioRecoveryUnmuteTimer_->setSingleShot(true);
+    audioRecoveryUnmuteTimer_->setInterval(kRecoveryAudioUnmuteStabilityMs);
+    logViewFlushTimer_->setSingleShot(true);
+    logViewFlushTimer_->setInterval(kLogViewFlushIntervalMs);
+    guideCachePruneWriteTimer_->setSingleShot(true);
+    guideCachePruneWriteTimer_->setInterval(kGuideCachePruneWriteDelayMs);
+    connect(logViewFlushTimer_, &QTimer::timeout, this, &MainWindow::flushLogView);
+    channelTableFlushTimer_->setSingleShot(true);
+    channelTableFlushTimer_->setInterval(kChannelTableFlushIntervalMs);
+    connect(channelTableFlushTimer_, &QTimer::timeout, this, &MainWindow::flushPendingChannelRows);
+    channelShowBoundaryTimer_->setSingleShot(true);
+    connect(channelShowBoundaryTimer_, &QTimer::timeout, this, &MainWindow::refreshDueChannelTableShows);
 
-        if (watchedInsideFullscreenRegion) {
-            if (fullscreenCursorHidden_ || overlayHidden) {
-                appendLog(QStringLiteral("fullscreen-overlay: accepted activity type=%1 watched=%2 hiddenCursor=%3 overlayVisible=%4 overlayGeom=%5,%6 %7x%8 fullscreenGeom=%9,%10 %11x%12")
-                              .arg(eventTypeName(event->type()),
-                                   describeObjectForLog(watched),
-                                   fullscreenCursorHidden_ ? QStringLiteral("true") : QStringLiteral("false"),
-                                   overlayHidden ? QStringLiteral("false") : QStringLiteral("true"))
-                              .arg(overlayGeometry.x())
-                              .arg(overlayGeometry.y())
-                              .arg(overlayGeometry.width())
-                              .arg(overlayGeometry.height())
-                              .arg(fullscreenGeometry.x())
-                              .arg(fullscreenGeometry.y())
-                              .arg(fullscreenGeometry.width())
-                              .arg(fullscreenGeometry.height()));
-            }
-            showFullscreenCursor();
-            restartFullscreenCursorHideTimer();
-        } else if (fullscreenCursorHidden_ || overlayHidden) {
-            static qint64 lastIgnoredActivityLogMs = 0;
-            const qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
-            if (nowMs - lastIgnoredActivityLogMs >= 300) {
-                lastIgnoredActivityLogMs = nowMs;
-                appendLog(QStringLiteral("fullscreen-overlay: ignored activity type=%1 watched=%2 watchedIsWidget=%3 hiddenCursor=%4 overlayVisible=%5 cursor=%6,%7 fullscreenGeom=%8,%9 %10x%11")
-                              .arg(eventTypeName(event->type()),
-                                   describeObjectForLog(watched),
-                                   watchedWidget != nullptr ? QStringLiteral("true") : QStringLiteral("false"),
-                                   fullscreenCursorHidden_ ? QStringLiteral("true") : QStringLiteral("false"),
-                                   overlayHidden ? QStringLiteral("false") : QStringLiteral("true"))
-                              .arg(QCursor::pos().x())
-                              .arg(QCursor::pos().y())
-                              .arg(fullscreenGeometry.x())
-                              .arg(fullscreenGeometry.y())
-                              .arg(fullscreenGeometry.width())
-                              .arg(fullscreenGeometry.height()));
-            }
-        }
+    mediaPlayer_->setAudioOutput(audioOutput_);
+    mediaPlayer_->setVideoOutput(videoWidget_);
+    if (QVideoSink *videoSink = videoWidget_->videoSink()) {
+        startupFirstFrameConnection_ =
+            connect(videoSink, &QVideoSink::videoFrameChanged, this, [this](const QVideoFrame &frame) {
+                if (!frame.isValid()) {
+                    return;
+                }
+                disconnect(startupFirstFrameConnection_);
+                markStartupMilestone("first-video-frame");
+                completeStartupTrace();
+            });
     }
-
-    if (event != nullptr && event->type() == QEvent::KeyPress) {
-        auto *keyEvent = static_cast<QKeyEvent *>(event);
-        if (fullscreenActive_ && keyEvent->key() == Qt::Key_Escape) {
-            exitFullscreen();
-            return true;
-        }
-        if (handlePlaybackKeyBinding(keyEvent)) {
-            return true;
-        }
+    QSettings settings("tv_tuner_gui", "watcher");
+    const int savedVolume = std::clamp(settings.value("volume_percent", 85).toInt(), 0, 100);
+    const bool savedMuted = settings.value(kMutedSetting, false).toBool();
+    disableTooltips_ = settings.value(kDisableTooltipsSetting, false).toBool();
+    obeyScheduledSwitches_ = settings.value(kObeyScheduledSwitchesSetting, true).toBool();
+    autoFavoriteShowSchedulingEnabled_ = settings.value(kAutoFavoriteShowSchedulingSetting, true).toBool();
+    favoriteShowRatingsOverrideEnabled_ = settings.value(kFavoriteShowRatingsOverrideSetting, false).toBool();
+    autoPictureInPictureEnabled_ = settings.value(kAutoPictureInPictureSetting, true).toBool();
+    lastAutoFavoriteScheduleStamp_ =
+        settings.value(kDismissedAutoFavoriteCandidatesStampSetting).toString().trimmed();
+    dismissedAutoFavoriteCandidates_ = settings.value(kDismissedAutoFavoriteCandidatesSetting).toStringList();
+    settings.remove(kLockedAutoFavoriteSelectionsSetting);
+    settings.remove(kLockedScheduledSwitchesSetting);
+    volumeSlider_->setValue(savedVolume);
+    if (muteButton_ != nullptr) {
+        const QSignalBlocker blocker(muteButton_);
+        muteButton_->setChecked(savedMuted);
     }
-    return QObject::eventFilter(watched, event);
-}
-
-void MainWindow::stopProcess(QProcess *process, int timeoutMs)
-{
-    if (process == nullptr || process->state() == QProcess::NotRunning) {
-        return;
+    applyAudioOutputState();
+    if (hideNoEitChannelsCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(hideNoEitChannelsCheckBox_);
+        hideNoEitChannelsCheckBox_->setChecked(settings.value(kHideNoEitChannelsSetting, false).toBool());
     }
-
-    process->terminate();
-    if (!process->waitForFinished(timeoutMs)) {
-        process->kill();
-        process->waitForFinished(timeoutMs);
+    if (showFavoritesOnlyCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(showFavoritesOnlyCheckBox_);
+        showFavoritesOnlyCheckBox_->setChecked(settings.value(kShowFavoritesOnlySetting, false).toBool());
     }
-    process->close();
-}
-
-QWidget *MainWindow::modalDialogParent() const
-{
-    if (fullscreenActive_ && fullscreenWindow_ != nullptr) {
-        return fullscreenWindow_;
+    if (showTodayOnlyListingsCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(showTodayOnlyListingsCheckBox_);
+        showTodayOnlyListingsCheckBox_->setChecked(settings.value(kShowTodayOnlyListingsSetting, false).toBool());
     }
-    return const_cast<MainWindow *>(this);
-}
-
-void MainWindow::prepareModalWindow(QWidget *window, const QString &reason)
-{
-    if (window == nullptr || !fullscreenActive_ || fullscreenWindow_ == nullptr) {
-        return;
+    if (obeyScheduledSwitchesCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(obeyScheduledSwitchesCheckBox_);
+        obeyScheduledSwitchesCheckBox_->setChecked(obeyScheduledSwitches_);
     }
-
-    if (!reason.trimmed().isEmpty()) {
-        appendLog(QString("fullscreen: presenting modal UI: %1").arg(reason));
+    if (autoFavoriteShowSchedulingCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(autoFavoriteShowSchedulingCheckBox_);
+        autoFavoriteShowSchedulingCheckBox_->setChecked(autoFavoriteShowSchedulingEnabled_);
     }
-
-    showFullscreenCursor();
-    if (fullscreenCursorHideTimer_ != nullptr) {
-        fullscreenCursorHideTimer_->stop();
+    if (favoriteShowRatingsOverrideCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(favoriteShowRatingsOverrideCheckBox_);
+        favoriteShowRatingsOverrideCheckBox_->setChecked(obeyScheduledSwitches_ && favoriteShowRatingsOverrideEnabled_);
+        favoriteShowRatingsOverrideCheckBox_->setEnabled(obeyScheduledSwitches_);
     }
-    syncFullscreenOverlayState();
-    positionFullscreenOverlay();
-    if (fullscreenOverlayContainer_ != nullptr) {
-        fullscreenOverlayContainer_->show();
-        fullscreenOverlayContainer_->raise();
+    if (autoPictureInPictureCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(autoPictureInPictureCheckBox_);
+        autoPictureInPictureCheckBox_->setChecked(autoPictureInPictureEnabled_);
     }
-
-    fullscreenWindow_->raise();
-    fullscreenWindow_->activateWindow();
-    window->setWindowFlag(Qt::WindowStaysOnTopHint, true);
-    window->winId();
-    if (window->windowHandle() != nullptr && fullscreenWindow_->windowHandle() != nullptr) {
-        window->windowHandle()->setTransientParent(fullscreenWindow_->windowHandle());
-        if (QScreen *screen = fullscreenWindow_->windowHandle()->screen()) {
-            window->windowHandle()->setScreen(screen);
-        }
+    if (processedPlaybackCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(processedPlaybackCheckBox_);
+        processedPlaybackCheckBox_->setChecked(settings.value(kProcessedPlaybackSetting, false).toBool());
     }
-}
-
-void MainWindow::restoreAfterModalWindow()
-{
-    if (!fullscreenActive_) {
-        return;
+    if (hideStartupSwitchSummaryCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(hideStartupSwitchSummaryCheckBox_);
+        hideStartupSwitchSummaryCheckBox_->setChecked(
+            settings.value(kHideStartupSwitchSummarySetting, false).toBool());
     }
-
-    showFullscreenCursor();
-    restartFullscreenCursorHideTimer();
-    if (fullscreenWindow_ != nullptr) {
-        fullscreenWindow_->raise();
-        fullscreenWindow_->activateWindow();
+    if (disableTooltipsCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(disableTooltipsCheckBox_);
+        disableTooltipsCheckBox_->setChecked(disableTooltips_);
     }
-    if (fullscreenVideoWidget_ != nullptr) {
-        fullscreenVideoWidget_->setFocus(Qt::ActiveWindowFocusReason);
+    if (hideStartupSwitchSummaryCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(hideStartupSwitchSummaryCheckBox_);
+        hideStartupSwitchSummaryCheckBox_->setChecked(
+            settings.value(kHideStartupSwitchSummarySetting, false).toBool());
     }
-}
-
-int MainWindow::execModalDialog(QDialog *dialog, const QString &reason)
-{
-    if (dialog == nullptr) {
-        return QDialog::Rejected;
+    if (logAutoScrollCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(logAutoScrollCheckBox_);
+        logAutoScrollCheckBox_->setChecked(settings.value(kLogAutoScrollSetting, true).toBool());
     }
-
-    prepareModalWindow(dialog, reason);
-    const int result = dialog->exec();
-    restoreAfterModalWindow();
-    return result;
-}
-
-void MainWindow::showAboutDialog(const QString &title, const QString &text)
-{
-    QMessageBox dialog(QMessageBox::Information, title, text, QMessageBox::Ok, modalDialogParent());
-    dialog.setTextFormat(Qt::PlainText);
-    execModalDialog(&dialog, title);
-}
-
-void MainWindow::showInformationDialog(const QString &title, const QString &text)
-{
-    QMessageBox dialog(QMessageBox::Information, title, text, QMessageBox::Ok, modalDialogParent());
-    dialog.setTextFormat(Qt::PlainText);
-    execModalDialog(&dialog, title);
-}
-
-void MainWindow::showWarningDialog(const QString &title, const QString &text)
-{
-    QMessageBox dialog(QMessageBox::Warning, title, text, QMessageBox::Ok, modalDialogParent());
-    dialog.setTextFormat(Qt::PlainText);
-    execModalDialog(&dialog, title);
-}
-
-void MainWindow::showCriticalDialog(const QString &title, const QString &text)
-{
-    QMessageBox dialog(QMessageBox::Critical, title, text, QMessageBox::Ok, modalDialogParent());
-    dialog.setTextFormat(Qt::PlainText);
-    execModalDialog(&dialog, title);
-}
-
-QString MainWindow::promptItemSelection(const QString &title,
-                                        const QString &label,
-                                        const QStringList &items,
-                                        int current,
-                                        bool editable)
-{
-    QInputDialog dialog(modalDialogParent());
-    dialog.setWindowTitle(title);
-    dialog.setLabelText(label);
-    dialog.setComboBoxItems(items);
-    dialog.setComboBoxEditable(editable);
-    if (current >= 0 && current < items.size()) {
-        dialog.setTextValue(items.at(current));
+    if (useSchedulesDirectGuideCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(useSchedulesDirectGuideCheckBox_);
+        useSchedulesDirectGuideCheckBox_->setChecked(settings.value(kUseSchedulesDirectGuideSetting, false).toBool());
     }
-    if (execModalDialog(&dialog, title) != QDialog::Accepted) {
-        return {};
+    if (refreshGuideWhenCacheRunsOutCheckBox_ != nullptr) {
+        const QSignalBlocker blocker(refreshGuideWhenCacheRunsOutCheckBox_);
+        refreshGuideWhenCacheRunsOutCheckBox_->setChecked(
+            settings.value(kGuideRefreshWhenCacheRunsOutSetting, false).toBool());
+    }
+    if (guideRefreshIntervalCombo_ != nullptr) {
+        const QSignalBlocker blocker(guideRefreshIntervalCombo_);
+        const int selectedMinutes =
+            nearestGuideRefreshIntervalMinutes(settings.value(kGuideRefreshIntervalMinutesSetting,
+                                                              kDefaultGuideRefreshIntervalMinutes)
+                                                   .toInt());
+        const int index = guideRefreshIntervalCombo_->findData(selectedMinutes);
+        guideRefreshIntervalCombo_->setCurrentIndex(index >= 0 ? index : 0);
+    }
+    if (guideCacheRetentionCombo_ != nullptr) {
+        const QSignalBlocker blocker(guideCacheRetentionCombo_);
+        const int selectedHours =
+            nearestGuideCacheRetentionHours(settings.value(kGuideCacheRetentionHoursSetting,
+                                                           kDefaultGuideCacheRetentionHours)
+                                                .toInt());
+        const int index = guideCacheRetentionCombo_->findData(selectedHours);
+        guideCacheRetentionCombo_->setCurrentIndex(index >= 0 ? index : 0);
+    }
+    if (schedulesDirectUsernameEdit_ != nullptr) {
+        const QSignalBlocker blocker(schedulesDirectUsernameEdit_);
+        schedulesDirectUsernameEdit_->setText(settings.value(kSchedulesDirectUsernameSetting).toString().trimmed());
+    }
+    if (schedulesDirectPasswordEdit_ != nullptr) {
+        const QSignalBlocker blocker(schedulesDirectPasswordEdit_);
+        schedulesDirectPasswordEdit_->setText(settings.value(kSchedulesDirectPasswordSha1Setting).toString().trimmed());
+    }
+    if (schedulesDirectPostalCodeEdit_ != nullptr) {
+        const QSignalBlocker blocker(schedulesDirectPostalCodeEdit_);
+        schedulesDirectPostalCodeEdit_->setText(settings.value(kSchedulesDirectPostalCodeSetting).toString().trimmed());
+    }
+    applyGuideFilterSettings();
+    applyGuideRefreshIntervalSetting();
+    updateSchedulesDirectControls();
+
+    connect(scanProcess_, &QProcess::readyReadStandardOutput, this, &MainWindow::handleStdOut);
+    connect(scanProcess_, &QProcess::readyReadStandardError, this, &MainWindow::handleStdErr);
+    connect(scanProcess_, &QProcess::finished, this, &MainWindow::processFinished);
+    connect(zapProcess_, &QProcess::readyReadStandardError, this, &MainWindow::handleZapStdErr);
+    connect(zapProcess_, &QProcess::finished, this, &MainWindow::handleZapFinished);
+    connect(zapProcess_, &QProcess::errorOccurred, this, [this](QProcess::ProcessError error) {
+        appendLog(QString("zap: errorOccurred=%1 (%2)")
+                      .arg(processErrorToString(error), zapProcess_->errorString()));
+    });
+    signalMonitorProcess_->setProcessChannelMode(QProcess::MergedChannels);
+    connect(signalMonitorProcess_, &QProcess::readyReadStandardOutput, this, [this]() {
+        handleSignalMonitorOutput(QString::fromUtf8(signalMonitorProcess_->readAllStandardOutput()));
+    });
+    connect(signalMonitorProcess_, &QProcess::finished, this, &MainWindow::handleSignalMonitorFinished);
+    connect(signalMonitorProcess_, &QProcess::errorOccurred, this, [this](QProcess::ProcessError error) {
+        if (currentChannelName_.isEmpty() || userStoppedWatching_) {
+            return;
+        }
+        setSignalMonitorStatus("Signal: unavailable",
+                               QString("dvb-fe-tool error: %1 (%2)")
+                                   .arg(processErrorToString(error), signalMonitorProcess_->errorString()));
+        appendLog(QString("signal: dvb-fe-tool errorOccurred=%1 (%2)")
+                      .arg(processErrorToString(error), signalMonitorProcess_->errorString()));
+    });
+    connect(streamBridgeProcess_, &QProcess::errorOccurred, this, [this](QProcess::ProcessError error) {
+        appendLog(QString("ffmpeg bridge: errorOccurred=%1 (%2)")
+                      .arg(processErrorToString(error), streamBridgeProcess_->errorString()));
+    });
+    connect(streamBridgeProcess_, &QProcess::readyReadStandardError, this, [this]() {
+        const QString err = QString::fromUtf8(streamBridgeProcess_->readAllStandardError()).trimmed();
+        if (!err.isEmpty()) {
+            const QStringList lines = err.split('\n');
+            for (const QString &line : lines) {
+                const QString trimmed = line.trimmed();
+                if (!trimmed.isEmpty()) {
+                    const QString lowerTrimmed = trimmed.toLower();
+                    if (lowerTrimmed.contains("could not find codec parameters")
+                        || lowerTrimmed.contains("could not write header")
+                        || lowerTrimmed.contains("sample rate not set")) {
+                        bridgeSawCodecParameterFailure_ = true;
+                    }
+                    appendLog("ffmpeg: " + trimmed);
+                }
+            }
+        }
+    });
+    connect(streamBridgeProcess_, &QProcess::finished, this, [this](int exitCode, QProcess::ExitStatus status) {
+        appendLog(QString("ffmpeg bridge exited (code=%1, status=%2, error=%3)")
+                      .arg(exitCode)
+                      .arg(status == QProcess::NormalExit ? "normal" : "crash")
+                      .arg(streamBridgeProcess_->errorString()));
+        if (zapProcess_ != nullptr && zapProcess_->state() != QProcess::NotRunning) {
+            suppressZapExitReconnect_ = true;
+            stopProcess(zapProcess_, 1000);
+            suppressZapExitReconnect_ = false;
+        }
+        if (!suppressBridgeExitReconnect_ && !userStoppedWatching_ && !currentChannelName_.isEmpty()) {
+            if (tryDynamicBridgeFallback("Live stream bridge exited")) {
+                return;
+            }
+            scheduleReconnect("Live stream bridge exited");
+        }
+    });
+    connect(mediaPlayer_, &QMediaPlayer::mediaStatusChanged, this, &MainWindow::handleMediaStatusChanged);
+    connect(mediaPlayer_, &QMediaPlayer::playbackStateChanged, this, [this]() {
+        appendLog(QString("player: playbackStateChanged=%1").arg(static_cast<int>(mediaPlayer_->playbackState())));
+        playbackStatusLabel_->setText(playbackStatusText());
+        refreshLocalMediaSignalStatus();
+        syncFullscreenOverlayState();
+        refreshRecoveryAudioMuteGate();
+    });
+    connect(mediaPlayer_, &QMediaPlayer::errorChanged, this, [this]() {
+        if (mediaPlayer_->error() != QMediaPlayer::NoError) {
+            appendLog(QString("player: errorChanged code=%1 text=%2")
+                          .arg(static_cast<int>(mediaPlayer_->error()))
+                          .arg(mediaPlayer_->errorString()));
+            handlePlayerError(mediaPlayer_->errorString());
+        }
+    });
+    connect(mediaPlayer_, &QMediaPlayer::errorOccurred, this, [this](QMediaPlayer::Error error, const QString &errorString) {
+        appendLog(QString("player: errorOccurred code=%1 text=%2").arg(static_cast<int>(error)).arg(errorString));
+    });
+    connect(mediaPlayer_, &QMediaPlayer::hasVideoChanged, this, [this](bool hasVideo) {
+        appendLog(QString("player: hasVideoChanged=%1").arg(hasVideo ? "true" : "false"));
+        Q_UNUSED(hasVideo);
+        refreshLocalMediaSignalStatus();
+        refreshRecoveryAudioMuteGate();
+    });
+    connect(mediaPlayer_, &QMediaPlayer::hasAudioChanged, this, [this](bool hasAudio) {
+        const QString playbackMode = useVideoOnlyBridgeMode_
+                                         ? "video-only"
+                                         : (useResilientBridgeMode_
+                                                ? "resilient"
+                                                : (processedPlaybackActive_ ? "processed" : "normal"));
+        appendLog(QString("player: hasAudioChanged=%1 (playbackState=%2, mediaStatus=%3, mode=%4, hasVideo=%5)")
+                      .arg(hasAudio ? "true" : "false")
+                      .arg(static_cast<int>(mediaPlayer_->playbackState()))
+                      .arg(static_cast<int>(mediaPlayer_->mediaStatus()))
+                      .arg(playbackMode)
+                      .arg(mediaPlayer_->hasVideo() ? "true" : "false"));
+        if (!hasAudio
+            && !currentChannelName_.isEmpty()
+            && !currentChannelName_.startsWith("File: ")
+            && mediaPlayer_->playbackState() == QMediaPlayer::PlayingState) {
+            appendLog("player: live audio disappeared while playback continued; monitoring bridge/buffer state.");
+        }
+        if (hasAudio && mediaPlayer_->hasVideo()) {
+            bridgeSawCodecParameterFailure_ = false;
+        }
+        refreshLocalMediaSignalStatus();
+        refreshRecoveryAudioMuteGate();
+    });
+    connect(mediaPlayer_, &QMediaPlayer::metaDataChanged, this, [this]() {
+        refreshLocalMediaSignalStatus();
+    });
+    connect(mediaPlayer_, &QMediaPlayer::bufferProgressChanged, this, [this](float progress) {
+        appendLog(QString("player: bufferProgress=%1").arg(progress, 0, 'f', 3));
+    });
+    connect(mediaPlayer_, &QMediaPlayer::durationChanged, this, [this](qint64) {
+        syncPlaybackSeekUi();
+    });
+    connect(mediaPlayer_, &QMediaPlayer::positionChanged, this, [this](qint64) {
+        syncPlaybackSeekUi();
+    });
+    connect(mediaPlayer_, &QMediaPlayer::seekableChanged, this, [this](bool) {
+        syncPlaybackSeekUi();
+    });
+    connect(reconnectTimer_, &QTimer::timeout, this, &MainWindow::triggerReconnect);
+    connect(currentShowTimer_, &QTimer::timeout, this, &MainWindow::refreshCurrentShowStatus);
+    connect(playbackAttachTimer_, &QTimer::timeout, this, [this]() {
+        if (!waitingForDvrReady_ || pendingDvrPath_.isEmpty()) {
+            return;
+        }
+        appendLog("player: DVR ready signal timeout; attempting playback anyway.");
+        startPlaybackFromDvr(pendingDvrPath_);
+    });
+    connect(audioRecoveryUnmuteTimer_, &QTimer::timeout, this, [this]() {
+        if (!recoveryAudioMuted_ || !isRecoveryAudioStable()) {
+            refreshRecoveryAudioMuteGate();
+            return;
+        }
+        clearRecoveryAudioMute();
+        muteRecoveryAfterAudioRebuildFailure_ = false;
+        const bool userMuted = muteButton_ != nullptr && muteButton_->isChecked();
+        appendLog(userMuted ? "player: rebuilt audio stabilized; recovery mute released but user mute remains enabled."
+                            : "player: rebuilt audio stabilized; unmuting recovered audio.");
+        setStatusBarStateMessage(userMuted ? "Recovered audio ready (user muted)"
+                                           : "Recovered audio restored");
+    });
+    connect(scheduledSwitchTimer_, &QTimer::timeout, this, &MainWindow::processScheduledSwitches);
+    connect(fullscreenCursorHideTimer_, &QTimer::timeout, this, &MainWindow::hideFullscreenCursor);
+    connect(guideRefreshTimer_, &QTimer::timeout, this, [this]() {
+        appendLog("guide-bg: scheduled guide cache refresh triggered.");
+        refreshGuideData(false, false, [this](bool refreshed) {
+            if (refreshed) {
+                loadGuideCacheFile();
+                applyCurrentShowStatusFromGuideCache();
+                updateTvGuideDialogFromCurrentCache(false);
+            }
+        });
+    });
+    guideCachePollTimer_->setInterval(kGuideCachePollIntervalMs);
+    connect(guideCachePruneWriteTimer_, &QTimer::timeout, this, &MainWindow::writePrunedGuideCacheInBackground);
+    connect(guideCachePollTimer_, &QTimer::timeout, this, [this]() {
+        const bool guideDialogVisible = tvGuideDialog_ != nullptr && tvGuideDialog_->isVisible();
+        const bool refreshedBecauseCacheRanOut = maybeRefreshGuideWhenCacheRunsOut(guideDialogVisible);
+        if (!guideDialogVisible || refreshedBecauseCacheRanOut) {
+            return;
+        }
+        // Re-reading an unchanged file would only redo the parse; it is still re-read when the window slides.
+        if (guideCacheFileStamp(resolveGuideCachePath()) == loadedGuideCacheFileStamp_
+            && alignedGuideWindowStartUtc(QDateTime::currentDateTimeUtc()) == lastGuideWindowStartUtc_) {
+            return;
+        }
+        if (loadGuideCacheFile()) {
+            updateTvGuideDialogFromCurrentCache(false);
+        }
+    });
+    connect(volumeSlider_, &QSlider::valueChanged, this, &MainWindow::handleVolumeChanged);
+    connect(seekSlider_, &QSlider::sliderMoved, this, [this](int value) {
+        if (fullscreenSeekSlider_ != nullptr) {
+            const QSignalBlocker blocker(fullscreenSeekSlider_);
+            fullscreenSeekSlider_->setValue(value);
+        }
+        if (seekPositionLabel_ != nullptr) {
+            seekPositionLabel_->setText(playbackSeekLabelText(value));
+        }
+        if (fullscreenSeekPositionLabel_ != nullptr) {
+            fullscreenSeekPositionLabel_->setText(playbackSeekLabelText(value));
+        }
+    });
+    connect(seekSlider_, &QSlider::valueChanged, this, [this](int value) {
+        if (fullscreenSeekSlider_ != nullptr && fullscreenSeekSlider_->value() != value) {
+            const QSignalBlocker blocker(fullscreenSeekSlider_);
+            fullscreenSeekSlider_->setValue(value);
+        }
+        if (seekPositionLabel_ != nullptr) {
+            seekPositionLabel_->setText(playbackSeekLabelText(value));
+        }
+        if (fullscreenSeekPositionLabel_ != nullptr) {
+            fullscreenSeekPositionLabel_->setText(playbackSeekLabelText(value));
+        }
+        if ((seekSlider_ != nullptr && seekSlider_->isSliderDown())
+            || (QApplication::mouseButtons() & Qt::LeftButton)) {
+            applyPlaybackSeekPosition(value);
+        }
+    });
+    connect(seekSlider_, &QSlider::sliderReleased, this, [this]() {
+        if (seekSlider_ != nullptr) {
+            applyPlaybackSeekPosition(seekSlider_->value());
+        }
+    });
+    connect(muteButton_, &QPushButton::toggled, this, &MainWindow::handleMuteToggled);
+    connect(contentSplitter_, &QSplitter::splitterMoved, this, [this](int, int) {
+        saveChannelSidebarSizing();
+    });
+
+    {
+        const StartupTraceScope trace("load-favorites");
+        loadFavorites();
+        loadFavoriteShowRules();
+    }
+    {
+        const StartupTraceScope trace("apply-startup-snapshot");
+        startupSnapshotApplied_ = applyStartupSnapshot();
+    }
+    {
+        const StartupTraceScope trace("populate-views");
+        refreshFavoriteShowRuleList();
+        syncFavoriteShowRatingControls();
+        refreshQuickButtons();
+        playbackStatusLabel_->setText(playbackStatusText());
+        setSignalMonitorStatus("Signal: n/a");
+        setCurrentShowStatus("NO EIT DATA");
+        syncFullscreenOverlayState();
+    }
+    startStartupStoreLoads();
+
+    if (!pendingDisplayThemeLoadError_.trimmed().isEmpty()) {
+        appendLog(QString("display-theme: %1").arg(pendingDisplayThemeLoadError_));
+        setDisplayThemeStatusMessage("Theme file had issues; defaults were loaded.", false);
+    } else {
+        persistDisplayThemeStore("Display theme ready", false);
+    }
+
+    QTimer::singleShot(kStartupTraceTimeoutMs, this, [this]() {
+        if (!startupTraceFinished()) {
+            markStartupMilestone("first-video-frame-timeout");
+            completeStartupTrace();
+        }
+    });
+
+    QTimer::singleShot(0, this, [this]() {
+        markStartupMilestone("event-loop-started");
+    });
+}
+
+void MainWindow::resumeStartupAfterStoresLoaded()
+{
+    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
+    const bool startupGuideRefreshNeeded =
+        !guideCacheLooksCurrentForStartup(guideEntriesCache_, lastGuideWindowStartUtc_, nowUtc);
+    if (!startupGuideRefreshNeeded) {
+        const QDateTime cacheCoverageEndUtc =
+            guideCacheCoverageEndUtc_.isValid() ? guideCacheCoverageEndUtc_ : latestGuideEntryEndUtc(guideEntriesCache_);
+        appendLog(QString("guide-bg: startup guide refresh skipped; cache already covers current time through %1")
+                      .arg(cacheCoverageEndUtc.toLocalTime().toString("ddd h:mm AP")));
+    }
+    deferStartupAutoFavoriteScheduling_ = false;
+    logInteractionLazy("program", "startup.favorite-show.auto-scan", LogLevel::Info, [&]() {
+        return QString("guide-cache-loaded=%1 favorites=%2 queue-before=%3")
+            .arg(guideEntriesCache_.isEmpty() ? "false" : "true",
+                 favoriteShowRules_.join(" | "),
+                 summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
+    {
+        const StartupTraceScope trace("startup-favorite-scheduling");
+        autoScheduleFavoriteShowsFromGuideCache(false, false);
+    }
+    if (!refreshGuideWhenCacheRunsOutEnabled()) {
+        guideRefreshTimer_->start();
+    }
+    setStatusBarStateMessage(lastStatusBarMessage_);
+    restoreChannelSidebarSizing();
+    const bool startupScheduledTuneAvailable = obeyScheduledSwitches_ && hasActiveScheduledSwitchesNow();
+
+    // The stale-cache rebuild runs after playback is underway: refreshGuideData then sweeps on a spare
+    // tuner when one exists and otherwise limits itself to the live multiplex, publishing each mux as it lands.
+    if (startupGuideRefreshNeeded) {
+        const bool playbackStarting = !currentChannelName_.trimmed().isEmpty() || startupScheduledTuneAvailable;
+        appendLog(playbackStarting
+                      ? QString("guide-bg: startup guide rebuild deferred until playback has settled.")
+                      : QString("guide-bg: no startup playback; building initial guide cache."));
+        QTimer::singleShot(playbackStarting ? kStartupGuideRefreshDelayMs : 0, this, [this]() {
+            if (guideRefreshInProgress_) {
+                return;
+            }
+            appendLog("guide-bg: building initial guide cache at startup.");
+            const StartupTraceScope trace("startup-guide-refresh");
+            refreshGuideData(false, false, [this](bool refreshed) {
+                if (refreshed) {
+                    applyCurrentShowStatusFromGuideCache();
+                }
+            });
+        });
+    }
+    showStartupSwitchSummary();
+}
+
+void MainWindow::restoreStartupPlayback()
+{
+    // Runs once the channel list is in. Scheduled switches that load later arm the switch timer themselves, so
+    // an active scheduled tune then takes over from the restored channel.
+    const bool startupScheduledTuneAvailable =
+        scheduledSwitchesLoaded_ && obeyScheduledSwitches_ && hasActiveScheduledSwitchesNow();
+    if (startupScheduledTuneAvailable) {
+        appendLog("startup: active scheduled tune available; deferring to scheduled-switch timer to avoid duplicate prompts.");
+        refreshScheduledSwitchTimer();
+        QTimer::singleShot(0, this, [this]() {
+            if (!currentChannelName_.trimmed().isEmpty()) {
+                appendLog("startup: scheduled tuning already started playback before fallback check.");
+                return;
+            }
+            if (obeyScheduledSwitches_ && hasActiveScheduledSwitchesNow()) {
+                appendLog("startup: scheduled tuning still pending after startup deferral; leaving last channel restore skipped.");
+                return;
+            }
+            appendLog("startup: scheduled tuning did not start playback; restoring last channel.");
+            restoreLastPlayedChannel();
+        });
+    } else {
+        appendLog("startup: no active scheduled tune available; restoring last channel.");
+        const StartupTraceScope trace("restore-last-channel");
+        restoreLastPlayedChannel();
+    }
+}
+
+void MainWindow::startStartupStoreLoads()
+{
+    const int retentionHours = guideCacheRetentionHoursValue(guideCacheRetentionCombo_);
+    const QList<StartupStore> stores{StartupStore::ChannelHints,
+                                     StartupStore::Channels,
+                                     StartupStore::ScheduledSwitches,
+                                     StartupStore::GuideCache};
+    pendingStartupStoreLoads_ = stores.size();
+    for (const StartupStore store : stores) {
+        auto *watcher = new QFutureWatcher<StartupStoreResult>(this);
+        connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher]() {
+            const StartupStoreResult result = watcher->result();
+            watcher->deleteLater();
+            applyStartupStoreResult(result);
+        });
+        watcher->setFuture(QtConcurrent::run(&MainWindow::loadStartupStore, store, retentionHours));
+    }
+}
+
+MainWindow::StartupStoreResult MainWindow::loadStartupStore(StartupStore store, int guideRetentionHours)
+{
+    StartupStoreResult result;
+    result.store = store;
+    switch (store) {
+    case StartupStore::ChannelHints:
+        readChannelHints(result.numberByTuneKey, result.programByChannel, &result.logLines);
+        result.loaded = true;
+        break;
+    case StartupStore::Channels:
+        result.channelsFilePath = resolveChannelsFilePath();
+        result.loaded = readChannelsFileLines(result.channelsFilePath, &result.channelLines, &result.logLines);
+        break;
+    case StartupStore::ScheduledSwitches:
+        result.loaded = readScheduledSwitchesFile(resolveGuideSchedulePath(),
+                                                  &result.scheduledSwitches,
+                                                  &result.scheduledSwitchJournalEntries);
+        break;
+    case StartupStore::GuideCache: {
+        const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
+        const QString schedulesDirectExportPath = resolveSchedulesDirectExportPath();
+        const QString legacySchedulesDirectExportPath = resolveLegacySchedulesDirectExportPath();
+        result.guideCachePruned = pruneGuideCacheFile(schedulesDirectExportPath, nowUtc, guideRetentionHours);
+        if (legacySchedulesDirectExportPath != schedulesDirectExportPath) {
+            result.guideCachePruned = pruneGuideCacheFile(legacySchedulesDirectExportPath, nowUtc, guideRetentionHours)
+                                      || result.guideCachePruned;
+        }
+        result.loaded = readGuideCacheFile(resolveGuideCachePath(), nowUtc, guideRetentionHours, &result.guideCache);
+        break;
+    }
+    }
+    return result;
+}
+
+void MainWindow::applyStartupStoreResult(const StartupStoreResult &result)
+{
+    for (const QString &line : result.logLines) {
+        appendLog(line);
+    }
+
+    switch (result.store) {
+    case StartupStore::ChannelHints:
+        // Program mappings already taken from the snapshot's channel lines win, as they would in parseAndStoreLine.
+        for (auto it = result.numberByTuneKey.cbegin(); it != result.numberByTuneKey.cend(); ++it) {
+            if (!xspfNumberByTuneKey_.contains(it.key())) {
+                invalidateGuideChannelIndex();
+                xspfNumberByTuneKey_.insert(it.key(), it.value());
+            }
+        }
+        for (auto it = result.programByChannel.cbegin(); it != result.programByChannel.cend(); ++it) {
+            if (!xspfProgramByChannel_.contains(it.key())) {
+                xspfProgramByChannel_.insert(it.key(), it.value());
+            }
+        }
+        startupChannelHintsReady_ = true;
+        markStartupMilestone("channel-hints-loaded");
+        break;
+    case StartupStore::Channels:
+        if (!result.channelsFilePath.isEmpty()) {
+            channelsFilePath_ = result.channelsFilePath;
+        }
+        pendingStartupChannelsFilePath_ = result.channelsFilePath;
+        pendingStartupChannelLines_ = result.loaded ? result.channelLines : QStringList();
+        startupChannelsReady_ = true;
+        markStartupMilestone("channels-file-loaded");
+        break;
+    case StartupStore::ScheduledSwitches:
+        scheduledSwitchesLoaded_ = true;
+        if (result.loaded) {
+            applyLoadedScheduledSwitches(result.scheduledSwitches);
+        }
+        if (result.scheduledSwitchJournalEntries > 0) {
+            scheduledSwitchJournalEntries_ += result.scheduledSwitchJournalEntries;
+            compactScheduledSwitchesInBackground();
+        }
+        markStartupMilestone("scheduled-switches-loaded");
+        break;
+    case StartupStore::GuideCache:
+        if (result.guideCachePruned || result.guideCache.pruned) {
+            showTransientStatusBarMessage("Cleaning up TV Guide cache", 3000);
+        }
+        if (result.loaded) {
+            applyGuideCacheFileData(result.guideCache);
+            updateTvGuideDialogFromCurrentCache(false);
+            if (result.guideCache.pruned) {
+                scheduleGuideCachePruneWrite(result.guideCache);
+            }
+        }
+        markStartupMilestone("guide-cache-loaded");
+        break;
+    }
+
+    // Channel labels depend on the hints, so the table is only rebuilt once both stores are in.
+    const bool channelStore = result.store == StartupStore::ChannelHints || result.store == StartupStore::Channels;
+    if (channelStore && startupChannelHintsReady_ && startupChannelsReady_) {
+        if (startupSnapshotApplied_) {
+            appendLog(QString("Loaded %1 channel entries from the startup snapshot").arg(channelLines_.size()));
+        } else if (!pendingStartupChannelLines_.isEmpty()) {
+            const StartupTraceScope trace("populate-channel-table");
+            applyChannelsFileLines(pendingStartupChannelsFilePath_, pendingStartupChannelLines_);
+        }
+        pendingStartupChannelLines_.clear();
+        // Playback does not wait for the guide cache or the scheduled switches.
+        restoreStartupPlayback();
+    }
+
+    if (--pendingStartupStoreLoads_ == 0) {
+        finishStartupStoreLoads();
+    }
+}
+
+void MainWindow::finishStartupStoreLoads()
+{
+    markStartupMilestone("startup-stores-loaded");
+    refreshScheduledSwitchTimer();
+    guideCachePollTimer_->start();
+    if (!startupSnapshotApplied_) {
+        saveStartupSnapshot();
+    }
+    resumeStartupAfterStoresLoaded();
+}
+
+bool MainWindow::applyStartupSnapshot()
+{
+    const QString snapshotPath = resolveStartupSnapshotPath();
+    if (snapshotPath.isEmpty()) {
+        return false;
+    }
+
+    QFile snapshotFile(snapshotPath);
+    if (!snapshotFile.exists() || !snapshotFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return false;
+    }
+
+    QJsonParseError parseError{};
+    const QJsonDocument document = QJsonDocument::fromJson(snapshotFile.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+        return false;
+    }
+
+    const QJsonObject root = document.object();
+    if (root.value("version").toInt() != 1 || root.value("sourceStamp").toString() != startupSnapshotSourceStamp()) {
+        return false;
+    }
+    const QJsonArray channels = root.value("channels").toArray();
+    if (channels.isEmpty()) {
+        return false;
+    }
+
+    QList<ChannelTableRow> rows;
+    rows.reserve(channels.size());
+    channelLines_.clear();
+    invalidateGuideChannelIndex();
+
+    for (const QJsonValue &value : channels) {
+        const QJsonObject object = value.toObject();
+        const QString line = object.value("line").toString();
+        const QStringList parts = line.split(':');
+        if (parts.size() < 6 || parts.at(0).trimmed().isEmpty()) {
+            continue;
+        }
+
+        const QString channelName = parts.at(0).trimmed();
+        const QString displayLabel = object.value("label").toString(channelName);
+        ChannelTableRow row;
+        row.number = object.value("number").toString();
+        row.label = displayLabel;
+        row.rawLine = line;
+        row.show = kChannelTableNoShowText;
+        rows.append(row);
+        channelLines_.append(line);
+        xspfProgramByChannel_.insert(channelName, parts.at(5).trimmed());
+        if (displayLabel != channelName) {
+            xspfProgramByChannel_.insert(displayLabel, parts.at(5).trimmed());
+        }
+    }
+    const bool loaded = !rows.isEmpty();
+    channelsModel_->setRows(std::move(rows));
+    channelsFilePath_ = resolveChannelsFilePath();
+    return loaded;
+}
+
+void MainWindow::saveStartupSnapshot()
+{
+    const QString snapshotPath = resolveStartupSnapshotPath();
+    if (snapshotPath.isEmpty()) {
+        return;
+    }
+    if (channelsModel_->rowCount() == 0) {
+        QFile::remove(snapshotPath);
+        return;
+    }
+
+    QJsonArray channels;
+    for (int row = 0; row < channelsModel_->rowCount(); ++row) {
+        const ChannelTableRow &channelRow = channelsModel_->rowAt(row);
+        QJsonObject object;
+        object.insert("number", channelRow.number);
+        object.insert("label", channelRow.label);
+        object.insert("line", channelRow.rawLine);
+        channels.append(object);
+    }
+
+    QJsonObject root;
+    root.insert("version", 1);
+    root.insert("savedUtc", QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs));
+    root.insert("sourceStamp", startupSnapshotSourceStamp());
+    root.insert("channels", channels);
+
+    QSaveFile snapshotFile(snapshotPath);
+    if (!snapshotFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        appendLog("startup: could not write startup snapshot " + snapshotPath);
+        return;
+    }
+    const QByteArray payload = QJsonDocument(root).toJson(QJsonDocument::Compact);
+    if (snapshotFile.write(payload) != payload.size() || !snapshotFile.commit()) {
+        snapshotFile.cancelWriting();
+        appendLog("startup: could not write startup snapshot " + snapshotPath);
+    }
+}
+
+void MainWindow::completeStartupTrace()
+{
+    const QString summary = finishStartupTrace();
+    if (!summary.isEmpty()) {
+        appendLog(summary);
+    }
+}
+
+MainWindow::~MainWindow()
+{
+    qApp->removeEventFilter(this);
+    exitFullscreen();
+    userStoppedWatching_ = true;
+    if (reconnectTimer_ != nullptr) {
+        reconnectTimer_->stop();
+    }
+    if (currentShowTimer_ != nullptr) {
+        currentShowTimer_->stop();
+    }
+    if (playbackAttachTimer_ != nullptr) {
+        playbackAttachTimer_->stop();
+    }
+    if (guideRefreshTimer_ != nullptr) {
+        guideRefreshTimer_->stop();
+    }
+    if (guideCachePollTimer_ != nullptr) {
+        guideCachePollTimer_->stop();
+    }
+    cancelSchedulesDirectSync();
+    guideCachePruneWrite_.waitForFinished();
+    scheduledSwitchCompaction_.waitForFinished();
+    if (scheduledSwitchTimer_ != nullptr) {
+        scheduledSwitchTimer_->stop();
+    }
+    if (fullscreenCursorHideTimer_ != nullptr) {
+        fullscreenCursorHideTimer_->stop();
+    }
+    if (mediaPlayer_ != nullptr) {
+        mediaPlayer_->stop();
+        mediaPlayer_->setSource(QUrl());
+    }
+
+    if (pipWindow_ != nullptr) {
+        pipWindow_->hide();
+    }
+
+    suppressBridgeExitReconnect_ = true;
+    stopProcess(streamBridgeProcess_, 1200);
+    suppressBridgeExitReconnect_ = false;
+
+    stopProcess(signalMonitorProcess_, 1000);
+
+    suppressZapExitReconnect_ = true;
+    stopProcess(zapProcess_, 1200);
+    suppressZapExitReconnect_ = false;
+
+    stopProcess(scanProcess_, 1200);
+}
+
+void MainWindow::closeEvent(QCloseEvent *event)
+{
+    appendLog("Application closing: releasing tuner resources.");
+    cancelSchedulesDirectSync();
+    if (pipWindow_ != nullptr) {
+        pipWindow_->hide();
+    }
+    exitFullscreen();
+    saveChannelSidebarSizing();
+    stopWatching();
+    stopProcess(scanProcess_, 1200);
+    QMainWindow::closeEvent(event);
+}
+
+void MainWindow::resizeEvent(QResizeEvent *event)
+{
+    QMainWindow::resizeEvent(event);
+    QTimer::singleShot(0, this, [this]() {
+        syncConfigGroupBoxHeights();
+    });
+}
+
+bool MainWindow::eventFilter(QObject *watched, QEvent *event)
+{
+    if (!startupFirstWindowRecorded_ && event != nullptr && event->type() == QEvent::Expose
+        && watched == windowHandle() && windowHandle()->isExposed()) {
+        startupFirstWindowRecorded_ = true;
+        markStartupMilestone("first-window");
+    }
+
+    if (disableTooltips_ && event != nullptr && event->type() == QEvent::ToolTip) {
+        QToolTip::hideText();
+        event->ignore();
+        return true;
+    }
+
+    auto *watchedWidget = qobject_cast<QWidget *>(watched);
+    const bool watchedInsideFullscreenWindow =
+        fullscreenWindow_ != nullptr
+        && watchedWidget != nullptr
+        && (watchedWidget == fullscreenWindow_ || fullscreenWindow_->isAncestorOf(watchedWidget));
+    const bool watchedInsideFullscreenOverlay =
+        fullscreenOverlayContainer_ != nullptr
+        && watchedWidget != nullptr
+        && (watchedWidget == fullscreenOverlayContainer_
+            || fullscreenOverlayContainer_->isAncestorOf(watchedWidget));
+    const bool watchedInsideFullscreenRegion = watchedInsideFullscreenWindow || watchedInsideFullscreenOverlay;
+    const bool fullscreenActivityEvent =
+        fullscreenActive_
+        && event != nullptr
+        && (event->type() == QEvent::Enter
+            || event->type() == QEvent::MouseMove
+            || event->type() == QEvent::MouseButtonPress
+            || event->type() == QEvent::MouseButtonRelease
+            || event->type() == QEvent::Wheel
+            || event->type() == QEvent::HoverMove);
+
+    if (watched == videoWidget_ && event->type() == QEvent::MouseButtonDblClick) {
+        enterFullscreen();
+        return true;
+    }
+
+    if (watched == pipWindow_ && event->type() == QEvent::Close) {
+        if (videoDetachedToPip_) {
+            manualPictureInPictureRequested_ = false;
+            attachVideoFromPip();
+            appendLog("player: PiP window closed; video returned to the main window.");
+            setStatusBarStateMessage("Video returned to main window");
+        }
+        event->ignore();
+        return true;
+    }
+
+    if (watched == pipVideoWidget_ && event->type() == QEvent::MouseButtonDblClick) {
+        if (tabs_ != nullptr && watchPage_ != nullptr) {
+            tabs_->setCurrentWidget(watchPage_);
+        } else {
+            attachVideoFromPip();
+        }
+        return true;
+    }
+
+    if ((watchedInsideFullscreenRegion || watched == fullscreenVideoWidget_)
+        && event->type() == QEvent::MouseButtonDblClick) {
+        exitFullscreen();
+        return true;
+    }
+
+    if (fullscreenActivityEvent) {
+        const bool overlayHidden = fullscreenOverlayContainer_ != nullptr && !fullscreenOverlayContainer_->isVisible();
+        const QRect overlayGeometry =
+            fullscreenOverlayContainer_ != nullptr ? fullscreenOverlayContainer_->geometry() : QRect();
+        const QRect fullscreenGeometry =
+            fullscreenWindow_ != nullptr ? fullscreenWindow_->geometry() : QRect();
+
+        if (watchedInsideFullscreenRegion) {
+            if (fullscreenCursorHidden_ || overlayHidden) {
+                appendLog(QStringLiteral("fullscreen-overlay: accepted activity type=%1 watched=%2 hiddenCursor=%3 overlayVisible=%4 overlayGeom=%5,%6 %7x%8 fullscreenGeom=%9,%10 %11x%12")
+                              .arg(eventTypeName(event->type()),
+                                   describeObjectForLog(watched),
+                                   fullscreenCursorHidden_ ? QStringLiteral("true") : QStringLiteral("false"),
+                                   overlayHidden ? QStringLiteral("false") : QStringLiteral("true"))
+                              .arg(overlayGeometry.x())
+                              .arg(overlayGeometry.y())
+                              .arg(overlayGeometry.width())
+                              .arg(overlayGeometry.height())
+                              .arg(fullscreenGeometry.x())
+                              .arg(fullscreenGeometry.y())
+                              .arg(fullscreenGeometry.width())
+                              .arg(fullscreenGeometry.height()));
+            }
+            showFullscreenCursor();
+            restartFullscreenCursorHideTimer();
+        } else if (fullscreenCursorHidden_ || overlayHidden) {
+            static qint64 lastIgnoredActivityLogMs = 0;
+            const qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+            if (nowMs - lastIgnoredActivityLogMs >= 300) {
+                lastIgnoredActivityLogMs = nowMs;
+                appendLog(QStringLiteral("fullscreen-overlay: ignored activity type=%1 watched=%2 watchedIsWidget=%3 hiddenCursor=%4 overlayVisible=%5 cursor=%6,%7 fullscreenGeom=%8,%9 %10x%11")
+                              .arg(eventTypeName(event->type()),
+                                   describeObjectForLog(watched),
+                                   watchedWidget != nullptr ? QStringLiteral("true") : QStringLiteral("false"),
+                                   fullscreenCursorHidden_ ? QStringLiteral("true") : QStringLiteral("false"),
+                                   overlayHidden ? QStringLiteral("false") : QStringLiteral("true"))
+                              .arg(QCursor::pos().x())
+                              .arg(QCursor::pos().y())
+                              .arg(fullscreenGeometry.x())
+                              .arg(fullscreenGeometry.y())
+                              .arg(fullscreenGeometry.width())
+                              .arg(fullscreenGeometry.height()));
+            }
+        }
+    }
+
+    if (event != nullptr && event->type() == QEvent::KeyPress) {
+        auto *keyEvent = static_cast<QKeyEvent *>(event);
+        if (fullscreenActive_ && keyEvent->key() == Qt::Key_Escape) {
+            exitFullscreen();
+            return true;
+        }
+        if (handlePlaybackKeyBinding(keyEvent)) {
+            return true;
+        }
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void MainWindow::stopProcess(QProcess *process, int timeoutMs)
+{
+    if (process == nullptr || process->state() == QProcess::NotRunning) {
+        return;
+    }
+
+    process->terminate();
+    if (!process->waitForFinished(timeoutMs)) {
+        process->kill();
+        process->waitForFinished(timeoutMs);
+    }
+    process->close();
+}
+
+QWidget *MainWindow::modalDialogParent() const
+{
+    if (fullscreenActive_ && fullscreenWindow_ != nullptr) {
+        return fullscreenWindow_;
+    }
+    return const_cast<MainWindow *>(this);
+}
+
+void MainWindow::prepareModalWindow(QWidget *window, const QString &reason)
+{
+    if (window == nullptr || !fullscreenActive_ || fullscreenWindow_ == nullptr) {
+        return;
+    }
+
+    if (!reason.trimmed().isEmpty()) {
+        appendLog(QString("fullscreen: presenting modal UI: %1").arg(reason));
+    }
+
+    showFullscreenCursor();
+    if (fullscreenCursorHideTimer_ != nullptr) {
+        fullscreenCursorHideTimer_->stop();
+    }
+    syncFullscreenOverlayState();
+    positionFullscreenOverlay();
+    if (fullscreenOverlayContainer_ != nullptr) {
+        fullscreenOverlayContainer_->show();
+        fullscreenOverlayContainer_->raise();
+    }
+
+    fullscreenWindow_->raise();
+    fullscreenWindow_->activateWindow();
+    window->setWindowFlag(Qt::WindowStaysOnTopHint, true);
+    window->winId();
+    if (window->windowHandle() != nullptr && fullscreenWindow_->windowHandle() != nullptr) {
+        window->windowHandle()->setTransientParent(fullscreenWindow_->windowHandle());
+        if (QScreen *screen = fullscreenWindow_->windowHandle()->screen()) {
+            window->windowHandle()->setScreen(screen);
+        }
+    }
+}
+
+void MainWindow::restoreAfterModalWindow()
+{
+    if (!fullscreenActive_) {
+        return;
+    }
+
+    showFullscreenCursor();
+    restartFullscreenCursorHideTimer();
+    if (fullscreenWindow_ != nullptr) {
+        fullscreenWindow_->raise();
+        fullscreenWindow_->activateWindow();
+    }
+    if (fullscreenVideoWidget_ != nullptr) {
+        fullscreenVideoWidget_->setFocus(Qt::ActiveWindowFocusReason);
+    }
+}
+
+int MainWindow::execModalDialog(QDialog *dialog, const QString &reason)
+{
+    if (dialog == nullptr) {
+        return QDialog::Rejected;
+    }
+
+    prepareModalWindow(dialog, reason);
+    const int result = dialog->exec();
+    restoreAfterModalWindow();
+    return result;
+}
+
+void MainWindow::showAboutDialog(const QString &title, const QString &text)
+{
+    QMessageBox dialog(QMessageBox::Information, title, text, QMessageBox::Ok, modalDialogParent());
+    dialog.setTextFormat(Qt::PlainText);
+    execModalDialog(&dialog, title);
+}
+
+void MainWindow::showInformationDialog(const QString &title, const QString &text)
+{
+    QMessageBox dialog(QMessageBox::Information, title, text, QMessageBox::Ok, modalDialogParent());
+    dialog.setTextFormat(Qt::PlainText);
+    execModalDialog(&dialog, title);
+}
+
+void MainWindow::showWarningDialog(const QString &title, const QString &text)
+{
+    QMessageBox dialog(QMessageBox::Warning, title, text, QMessageBox::Ok, modalDialogParent());
+    dialog.setTextFormat(Qt::PlainText);
+    execModalDialog(&dialog, title);
+}
+
+void MainWindow::showCriticalDialog(const QString &title, const QString &text)
+{
+    QMessageBox dialog(QMessageBox::Critical, title, text, QMessageBox::Ok, modalDialogParent());
+    dialog.setTextFormat(Qt::PlainText);
+    execModalDialog(&dialog, title);
+}
+
+QString MainWindow::promptItemSelection(const QString &title,
+                                        const QString &label,
+                                        const QStringList &items,
+                                        int current,
+                                        bool editable)
+{
+    QInputDialog dialog(modalDialogParent());
+    dialog.setWindowTitle(title);
+    dialog.setLabelText(label);
+    dialog.setComboBoxItems(items);
+    dialog.setComboBoxEditable(editable);
+    if (current >= 0 && current < items.size()) {
+        dialog.setTextValue(items.at(current));
+    }
+    if (execModalDialog(&dialog, title) != QDialog::Accepted) {
+        return {};
     }
     return dialog.textValue().trimmed();
 }
@@ -5006,43 +6455,12 @@ void MainWindow::buildUi()
     configPageLayout->addWidget(configScrollArea);
 
     displayOptionsPage_ = new QWidget(tabs_);
-    auto *displayOptionsPageLayout = new QVBoxLayout(displayOptionsPage_);
-    displayOptionsPageLayout->setContentsMargins(0, 0, 0, 0);
-    displayOptionsPageLayout->setSpacing(0);
-    auto *displayOptionsScrollArea = new QScrollArea(displayOptionsPage_);
-    displayOptionsScrollArea->setWidgetResizable(true);
-    displayOptionsScrollArea->setFrameShape(QFrame::NoFrame);
-    displayOptionsScrollArea->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    auto *displayOptionsContent = new QWidget(displayOptionsScrollArea);
-    auto *displayOptionsLayout = new QVBoxLayout(displayOptionsContent);
-    displayOptionsLayout->setContentsMargins(14, 14, 14, 14);
-    displayOptionsLayout->setSpacing(12);
-    displayOptionsScrollArea->setWidget(displayOptionsContent);
-    displayOptionsPageLayout->addWidget(displayOptionsScrollArea);
-
     keyBindingsPage_ = new QWidget(tabs_);
-    auto *keyBindingsPageLayout = new QVBoxLayout(keyBindingsPage_);
-    keyBindingsPageLayout->setContentsMargins(0, 0, 0, 0);
-    keyBindingsPageLayout->setSpacing(0);
-    auto *keyBindingsScrollArea = new QScrollArea(keyBindingsPage_);
-    keyBindingsScrollArea->setWidgetResizable(true);
-    keyBindingsScrollArea->setFrameShape(QFrame::NoFrame);
-    keyBindingsScrollArea->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    auto *keyBindingsContent = new QWidget(keyBindingsScrollArea);
-    auto *keyBindingsLayout = new QVBoxLayout(keyBindingsContent);
-    keyBindingsLayout->setContentsMargins(14, 14, 14, 14);
-    keyBindingsLayout->setSpacing(12);
-    keyBindingsScrollArea->setWidget(keyBindingsContent);
-    keyBindingsPageLayout->addWidget(keyBindingsScrollArea);
 
-    auto *metaManagementPage = new QWidget(tabs_);
-    auto *metaManagementLayout = new QVBoxLayout(metaManagementPage);
-
-    auto *logsPage = new QWidget(tabs_);
-    auto *logsLayout = new QVBoxLayout(logsPage);
-
-    auto *testingBugsPage = new QWidget(tabs_);
-    auto *testingBugsLayout = new QVBoxLayout(testingBugsPage);
+    tvGuidePage_ = new QWidget(tabs_);
+    metaManagementPage_ = new QWidget(tabs_);
+    logsPage_ = new QWidget(tabs_);
+    testingBugsPage_ = new QWidget(tabs_);
 
     const QString mainPageStyle =
         "QWidget { background-color: #000000; color: #ffffff; }"
@@ -5051,7 +6469,7 @@ void MainWindow::buildUi()
         "QPushButton { background-color: #090909; color: #ffffff; border: 1px solid #343434; padding: 6px 12px; }"
         "QPushButton:disabled { color: #777777; border-color: #1e1e1e; }"
         "QScrollArea, QScrollArea > QWidget > QWidget { background-color: #000000; }"
-        "QLineEdit, QComboBox, QListWidget, QPlainTextEdit, QTableWidget, QSpinBox {"
+        "QLineEdit, QComboBox, QListView, QTableView, QSpinBox {"
         " background-color: #050505; color: #ffffff; border: 1px solid #343434; }"
         "QHeaderView::section { background-color: #000000; color: #ffffff; border: 1px solid #343434; padding: 4px; }"
         "QLabel { color: #ffffff; }";
@@ -5060,9 +6478,9 @@ void MainWindow::buildUi()
     configPage_->setStyleSheet(mainPageStyle);
     displayOptionsPage_->setStyleSheet(mainPageStyle);
     keyBindingsPage_->setStyleSheet(mainPageStyle);
-    metaManagementPage->setStyleSheet(mainPageStyle);
-    logsPage->setStyleSheet(mainPageStyle);
-    testingBugsPage->setStyleSheet(mainPageStyle);
+    metaManagementPage_->setStyleSheet(mainPageStyle);
+    logsPage_->setStyleSheet(mainPageStyle);
+    testingBugsPage_->setStyleSheet(mainPageStyle);
     menuBar()->setStyleSheet("QMenuBar, QMenu { background-color: #000000; color: #ffffff; }");
 
     auto *scanGroup = new QGroupBox("Scan Settings", tuningPage);
@@ -5214,58 +6632,17 @@ void MainWindow::buildUi()
     schedulesDirectStatusLabel_ = new QLabel(
         "Schedules Direct OTA JSON status.",
         configSchedulesDirectGroup_);
-    schedulesDirectStatusLabel_->setWordWrap(true);
-    schedulesDirectStatusLabel_->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Maximum);
-    schedulesDirectStatusLabel_->setTextInteractionFlags(Qt::TextSelectableByMouse);
-    schedulesDirectLayout->addLayout(schedulesDirectForm);
-    schedulesDirectLayout->addWidget(exportSchedulesDirectButton_, 0);
-    schedulesDirectLayout->addWidget(schedulesDirectStatusLabel_, 0);
-
-    configGuideOptionsGroup_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
-    configPlaybackOptionsGroup_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
-    configCacheOptionsGroup_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
-    configSchedulesDirectGroup_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
-
-    auto *favoriteShowsGroup = new QGroupBox("Favorite Shows", metaManagementPage);
-    auto *favoriteShowsLayout = new QVBoxLayout(favoriteShowsGroup);
-    auto *favoriteShowsAddRow = new QHBoxLayout();
-    favoriteShowRuleEdit_ = new QLineEdit(favoriteShowsGroup);
-    favoriteShowRuleEdit_->setPlaceholderText("Add favorite show name");
-    addFavoriteShowRuleButton_ = new QPushButton("Add Favorite Show", favoriteShowsGroup);
-    addFavoriteShowRuleButton_->setEnabled(false);
-    favoriteShowsAddRow->addWidget(favoriteShowRuleEdit_, 1);
-    favoriteShowsAddRow->addWidget(addFavoriteShowRuleButton_, 0);
-    favoriteShowRulesList_ = new QListWidget(favoriteShowsGroup);
-    favoriteShowRulesList_->setSelectionMode(QAbstractItemView::SingleSelection);
-    favoriteShowRulesList_->setAlternatingRowColors(true);
-    auto *favoriteShowRatingRow = new QHBoxLayout();
-    auto *favoriteShowRatingLabel = new QLabel("Priority rating:", favoriteShowsGroup);
-    favoriteShowRatingSpin_ = new QSpinBox(favoriteShowsGroup);
-    favoriteShowRatingSpin_->setRange(kDefaultFavoriteShowRating, kMaxFavoriteShowRating);
-    favoriteShowRatingSpin_->setEnabled(false);
-    auto *favoriteShowRatingHelpLabel =
-        new QLabel("1 = watch if nothing is on, 10 = keep at all costs", favoriteShowsGroup);
-    favoriteShowRatingHelpLabel->setWordWrap(true);
-    favoriteShowRatingRow->addWidget(favoriteShowRatingLabel, 0);
-    favoriteShowRatingRow->addWidget(favoriteShowRatingSpin_, 0);
-    favoriteShowRatingRow->addWidget(favoriteShowRatingHelpLabel, 1);
-    removeFavoriteShowRuleButton_ = new QPushButton("Remove Selected Favorite Show", favoriteShowsGroup);
-    removeFavoriteShowRuleButton_->setEnabled(false);
-    favoriteShowsLayout->addLayout(favoriteShowsAddRow);
-    favoriteShowsLayout->addWidget(favoriteShowRulesList_, 1);
-    favoriteShowsLayout->addLayout(favoriteShowRatingRow);
-    favoriteShowsLayout->addWidget(removeFavoriteShowRuleButton_, 0);
-
-    auto *scheduledSwitchesGroup = new QGroupBox("Scheduled Switches", metaManagementPage);
-    auto *scheduledSwitchesLayout = new QVBoxLayout(scheduledSwitchesGroup);
-    scheduledSwitchesList_ = new QListWidget(scheduledSwitchesGroup);
-    scheduledSwitchesList_->setSelectionMode(QAbstractItemView::SingleSelection);
-    scheduledSwitchesList_->setAlternatingRowColors(true);
-    scheduledSwitchesList_->setWordWrap(true);
-    removeScheduledSwitchButton_ = new QPushButton("Remove Selected Switch", scheduledSwitchesGroup);
-    removeScheduledSwitchButton_->setEnabled(false);
-    scheduledSwitchesLayout->addWidget(scheduledSwitchesList_, 1);
-    scheduledSwitchesLayout->addWidget(removeScheduledSwitchButton_, 0);
+    schedulesDirectStatusLabel_->setWordWrap(true);
+    schedulesDirectStatusLabel_->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Maximum);
+    schedulesDirectStatusLabel_->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    schedulesDirectLayout->addLayout(schedulesDirectForm);
+    schedulesDirectLayout->addWidget(exportSchedulesDirectButton_, 0);
+    schedulesDirectLayout->addWidget(schedulesDirectStatusLabel_, 0);
+
+    configGuideOptionsGroup_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
+    configPlaybackOptionsGroup_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
+    configCacheOptionsGroup_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
+    configSchedulesDirectGroup_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
 
     auto *configSectionsLayout = new QGridLayout();
     configSectionsLayout->setContentsMargins(0, 0, 0, 0);
@@ -5283,169 +6660,6 @@ void MainWindow::buildUi()
         syncConfigGroupBoxHeights();
     });
 
-    auto *themeLibraryGroup = new QGroupBox("Theme Library", displayOptionsPage_);
-    auto *themeLibraryLayout = new QVBoxLayout(themeLibraryGroup);
-    themeLibraryLayout->setContentsMargins(12, 14, 12, 12);
-    themeLibraryLayout->setSpacing(10);
-    auto *themeSelectionRow = new QHBoxLayout();
-    themeSelectionRow->setSpacing(8);
-    themeSelectionRow->addWidget(new QLabel("Saved themes:", themeLibraryGroup), 0);
-    displayThemeSavedThemesCombo_ = new QComboBox(themeLibraryGroup);
-    displayThemeLoadButton_ = new QPushButton("Load Selected", themeLibraryGroup);
-    displayThemeOverwriteButton_ = new QPushButton("Overwrite Selected", themeLibraryGroup);
-    displayThemeDeleteButton_ = new QPushButton("Delete Selected", themeLibraryGroup);
-    themeSelectionRow->addWidget(displayThemeSavedThemesCombo_, 1);
-    themeSelectionRow->addWidget(displayThemeLoadButton_, 0);
-    themeSelectionRow->addWidget(displayThemeOverwriteButton_, 0);
-    themeSelectionRow->addWidget(displayThemeDeleteButton_, 0);
-    auto *themeSaveRow = new QHBoxLayout();
-    themeSaveRow->setSpacing(8);
-    themeSaveRow->addWidget(new QLabel("Theme name:", themeLibraryGroup), 0);
-    displayThemeNameEdit_ = new QLineEdit(themeLibraryGroup);
-    displayThemeNameEdit_->setPlaceholderText("Save the current look as a named theme");
-    displayThemeSaveAsButton_ = new QPushButton("Save As New Theme", themeLibraryGroup);
-    displayThemeResetButton_ = new QPushButton("Reset Current To Defaults", themeLibraryGroup);
-    themeSaveRow->addWidget(displayThemeNameEdit_, 1);
-    themeSaveRow->addWidget(displayThemeSaveAsButton_, 0);
-    themeSaveRow->addWidget(displayThemeResetButton_, 0);
-    displayThemeFilePathLabel_ =
-        new QLabel(QString("Theme file: %1").arg(resolveDisplayThemeStorePath()), themeLibraryGroup);
-    displayThemeFilePathLabel_->setTextInteractionFlags(Qt::TextSelectableByMouse);
-    displayThemeFilePathLabel_->setWordWrap(true);
-    displayThemeStatusLabel_ = new QLabel("Editing the current theme updates the theme file immediately.", themeLibraryGroup);
-    displayThemeStatusLabel_->setWordWrap(true);
-    displayThemeStatusLabel_->setTextInteractionFlags(Qt::TextSelectableByMouse);
-    themeLibraryLayout->addLayout(themeSelectionRow);
-    themeLibraryLayout->addLayout(themeSaveRow);
-    themeLibraryLayout->addWidget(displayThemeFilePathLabel_);
-    themeLibraryLayout->addWidget(displayThemeStatusLabel_);
-
-    auto *colorsGroup = new QGroupBox("Colors", displayOptionsPage_);
-    auto *colorsLayout = new QGridLayout(colorsGroup);
-    colorsLayout->setContentsMargins(12, 14, 12, 12);
-    colorsLayout->setHorizontalSpacing(12);
-    colorsLayout->setVerticalSpacing(8);
-    colorsLayout->setColumnStretch(1, 1);
-    colorsLayout->setColumnStretch(3, 1);
-    const QList<DisplayColorRoleSpec> colorSpecs = displayColorRoleSpecs();
-    for (int index = 0; index < colorSpecs.size(); ++index) {
-        const DisplayColorRoleSpec &spec = colorSpecs.at(index);
-        auto *label = new QLabel(spec.label + ":", colorsGroup);
-        label->setWordWrap(true);
-        auto *button = new QPushButton(colorsGroup);
-        button->setMinimumWidth(160);
-        displayThemeColorButtons_.insert(spec.key, button);
-        const int row = index / 2;
-        const int column = (index % 2) * 2;
-        colorsLayout->addWidget(label, row, column);
-        colorsLayout->addWidget(button, row, column + 1);
-    }
-
-    auto *fontsGroup = new QGroupBox("Fonts", displayOptionsPage_);
-    auto *fontsLayout = new QGridLayout(fontsGroup);
-    fontsLayout->setContentsMargins(12, 14, 12, 12);
-    fontsLayout->setHorizontalSpacing(10);
-    fontsLayout->setVerticalSpacing(8);
-    fontsLayout->addWidget(new QLabel("Element", fontsGroup), 0, 0);
-    fontsLayout->addWidget(new QLabel("Family", fontsGroup), 0, 1);
-    fontsLayout->addWidget(new QLabel("Size", fontsGroup), 0, 2);
-    fontsLayout->addWidget(new QLabel("Bold", fontsGroup), 0, 3);
-    fontsLayout->addWidget(new QLabel("Italic", fontsGroup), 0, 4);
-    fontsLayout->addWidget(new QLabel("Underline", fontsGroup), 0, 5);
-    fontsLayout->setColumnStretch(1, 1);
-    const QList<DisplayFontRoleSpec> fontSpecs = displayFontRoleSpecs();
-    for (int index = 0; index < fontSpecs.size(); ++index) {
-        const DisplayFontRoleSpec &spec = fontSpecs.at(index);
-        auto *label = new QLabel(spec.label, fontsGroup);
-        auto *familyCombo = new QFontComboBox(fontsGroup);
-        familyCombo->setSizeAdjustPolicy(QComboBox::AdjustToMinimumContentsLengthWithIcon);
-        auto *sizeSpin = new QSpinBox(fontsGroup);
-        sizeSpin->setRange(6, 48);
-        auto *boldCheck = new QCheckBox(fontsGroup);
-        auto *italicCheck = new QCheckBox(fontsGroup);
-        auto *underlineCheck = new QCheckBox(fontsGroup);
-        displayThemeFontEditors_.insert(spec.key, {familyCombo, sizeSpin, boldCheck, italicCheck, underlineCheck});
-        const int row = index + 1;
-        fontsLayout->addWidget(label, row, 0);
-        fontsLayout->addWidget(familyCombo, row, 1);
-        fontsLayout->addWidget(sizeSpin, row, 2);
-        fontsLayout->addWidget(boldCheck, row, 3, Qt::AlignCenter);
-        fontsLayout->addWidget(italicCheck, row, 4, Qt::AlignCenter);
-        fontsLayout->addWidget(underlineCheck, row, 5, Qt::AlignCenter);
-    }
-
-    displayOptionsLayout->addWidget(themeLibraryGroup);
-    displayOptionsLayout->addWidget(colorsGroup);
-    displayOptionsLayout->addWidget(fontsGroup);
-    displayOptionsLayout->addStretch(1);
-
-    auto *keyBindingsGroup = new QGroupBox("Key Bindings", keyBindingsPage_);
-    auto *keyBindingsGroupLayout = new QGridLayout(keyBindingsGroup);
-    keyBindingsGroupLayout->setContentsMargins(12, 14, 12, 12);
-    keyBindingsGroupLayout->setHorizontalSpacing(10);
-    keyBindingsGroupLayout->setVerticalSpacing(8);
-    keyBindingsGroupLayout->addWidget(new QLabel("Action", keyBindingsGroup), 0, 0);
-    keyBindingsGroupLayout->addWidget(new QLabel("Shortcut", keyBindingsGroup), 0, 1);
-    keyBindingsGroupLayout->addWidget(new QLabel("Clear", keyBindingsGroup), 0, 2);
-    keyBindingsGroupLayout->addWidget(new QLabel("Status", keyBindingsGroup), 0, 3);
-    keyBindingsGroupLayout->setColumnStretch(1, 1);
-    keyBindingsGroupLayout->setColumnStretch(3, 1);
-
-    auto *keyBindingsHelpLabel = new QLabel(
-        "Each action uses one shortcut. Multi-step shortcuts and conflicting shortcuts are rejected. "
-        "Use Clear to unassign one.",
-        keyBindingsGroup);
-    keyBindingsHelpLabel->setWordWrap(true);
-    keyBindingsGroupLayout->addWidget(keyBindingsHelpLabel, 1, 0, 1, 4);
-
-    int keyBindingRow = 2;
-    for (const KeyBindingSpec &spec : keyBindingSpecs()) {
-        auto *label = new QLabel(spec.label, keyBindingsGroup);
-        auto *editor = new QKeySequenceEdit(keyBindingsGroup);
-        auto *clearButton = new QPushButton("Clear", keyBindingsGroup);
-        auto *statusLabel = new QLabel(keyBindingsGroup);
-        statusLabel->setWordWrap(true);
-        statusLabel->setStyleSheet("QLabel { color: #ff9a9a; }");
-        keyBindingEditors_.insert(spec.id, editor);
-        keyBindingConflictLabels_.insert(spec.id, statusLabel);
-        keyBindingsGroupLayout->addWidget(label, keyBindingRow, 0);
-        keyBindingsGroupLayout->addWidget(editor, keyBindingRow, 1);
-        keyBindingsGroupLayout->addWidget(clearButton, keyBindingRow, 2);
-        keyBindingsGroupLayout->addWidget(statusLabel, keyBindingRow, 3);
-        connect(editor, &QKeySequenceEdit::keySequenceChanged, this, [this, actionId = spec.id](const QKeySequence &sequence) {
-            updateKeyBinding(actionId, sequence, true);
-        });
-        connect(clearButton, &QPushButton::clicked, this, [this, actionId = spec.id]() {
-            updateKeyBinding(actionId, QKeySequence(), false);
-        });
-        ++keyBindingRow;
-    }
-
-    keyBindingsLayout->addWidget(keyBindingsGroup);
-    keyBindingsLayout->addStretch(1);
-
-    metaManagementLayout->addWidget(favoriteShowsGroup, 1);
-    metaManagementLayout->addWidget(scheduledSwitchesGroup, 1);
-
-    auto *testingBugsGroup = new QGroupBox("Testing / Bugs", testingBugsPage);
-    auto *testingBugsGroupLayout = new QVBoxLayout(testingBugsGroup);
-    auto *testingBugsEntryRow = new QHBoxLayout();
-    testingBugItemEdit_ = new QLineEdit(testingBugsGroup);
-    testingBugItemEdit_->setPlaceholderText("Add something to test or watch for");
-    saveTestingBugItemButton_ = new QPushButton("Save Item", testingBugsGroup);
-    saveTestingBugItemButton_->setEnabled(false);
-    testingBugsEntryRow->addWidget(testingBugItemEdit_, 1);
-    testingBugsEntryRow->addWidget(saveTestingBugItemButton_, 0);
-    testingBugItemsList_ = new QListWidget(testingBugsGroup);
-    testingBugItemsList_->setSelectionMode(QAbstractItemView::SingleSelection);
-    testingBugItemsList_->setAlternatingRowColors(true);
-    removeTestingBugItemButton_ = new QPushButton("Delete Selected Item", testingBugsGroup);
-    removeTestingBugItemButton_->setEnabled(false);
-    testingBugsGroupLayout->addLayout(testingBugsEntryRow);
-    testingBugsGroupLayout->addWidget(testingBugItemsList_, 1);
-    testingBugsGroupLayout->addWidget(removeTestingBugItemButton_, 0);
-    testingBugsLayout->addWidget(testingBugsGroup, 1);
-
     watchControlsContainer_ = new QWidget(watchPage_);
     auto *watchControlsLayout = new QVBoxLayout(watchControlsContainer_);
     watchControlsLayout->setContentsMargins(0, 0, 0, 0);
@@ -5600,10 +6814,10 @@ void MainWindow::buildUi()
     videoDetachedPlaceholderLabel_->setStyleSheet("QLabel { background: #000000; color: #b8b8b8; padding: 24px; }");
     videoDetachedPlaceholderLabel_->hide();
 
-    channelsTable_ = new QTableWidget(contentSplitter_);
+    channelsModel_ = new ChannelListModel(this);
+    channelsTable_ = new QTableView(contentSplitter_);
     channelsTable_->setObjectName("channelListingTable");
-    channelsTable_->setColumnCount(4);
-    channelsTable_->setHorizontalHeaderLabels({"Channel Number", "Channel", "TV Show", "Raw line"});
+    channelsTable_->setModel(channelsModel_);
     channelsTable_->horizontalHeader()->setSectionResizeMode(kChannelTableNumberColumn, QHeaderView::ResizeToContents);
     channelsTable_->horizontalHeader()->setSectionResizeMode(kChannelTableNameColumn, QHeaderView::Stretch);
     channelsTable_->horizontalHeader()->setSectionResizeMode(kChannelTableShowColumn, QHeaderView::Stretch);
@@ -5681,28 +6895,16 @@ void MainWindow::buildUi()
     pipWindowLayout_->addWidget(pipVideoWidget_, 1);
     pipWindow_->hide();
 
-    logOutput_ = new QPlainTextEdit(logsPage);
-    logOutput_->setReadOnly(true);
-    logOutput_->setMaximumBlockCount(4000);
-    logOutput_->setPlaceholderText("w_scan2 and tuning output will appear here...");
-    auto *logControlsRow = new QHBoxLayout();
-    logAutoScrollCheckBox_ = new QCheckBox("Auto-scroll logs", logsPage);
-    logAutoScrollCheckBox_->setChecked(true);
-    logControlsRow->addWidget(logAutoScrollCheckBox_);
-    logControlsRow->addStretch();
-    logsLayout->addLayout(logControlsRow);
-    logsLayout->addWidget(logOutput_);
-
-    tvGuideDialog_ = new TvGuideDialog(tabs_);
+    logLinesModel_ = new LogLinesModel(kLogViewMaxLines, this);
     tabs_->addTab(watchPage_, "Video");
-    tabs_->addTab(tvGuideDialog_, "TV Guide");
-    tabs_->addTab(metaManagementPage, "Meta Management");
+    tabs_->addTab(tvGuidePage_, "TV Guide");
+    tabs_->addTab(metaManagementPage_, "Meta Management");
     tabs_->addTab(tuningPage, "Tuning");
     tabs_->addTab(configPage_, "Config");
     tabs_->addTab(displayOptionsPage_, "Display Options");
     tabs_->addTab(keyBindingsPage_, "Key Bindings");
-    tabs_->addTab(testingBugsPage, "Testing/bugs");
-    tabs_->addTab(logsPage, "Logs");
+    tabs_->addTab(testingBugsPage_, "Testing/bugs");
+    tabs_->addTab(logsPage_, "Logs");
     mainLayout->addWidget(tabs_, 1);
     setCentralWidget(root);
     statusBar()->setStyleSheet("QStatusBar { background-color: #000000; color: #ffffff; }");
@@ -5857,18 +7059,100 @@ void MainWindow::buildUi()
         });
     });
 
-    setStableButtonWidth(fullscreenWatchButton_, {QStringLiteral("▶")});
-    setStableButtonWidth(fullscreenStopWatchButton_, {QStringLiteral("■")});
-    setStableButtonWidth(fullscreenPauseButton_, {QStringLiteral("▶"), QStringLiteral("||")});
-    configureIconOnlyButton(fullscreenMuteButton_,
-                            firstAvailableThemeIcon({QStringLiteral("audio-volume-high")},
-                                                    QApplication::style()->standardIcon(QStyle::SP_MediaVolume)),
-                            "Mute audio");
-    setUniformButtonSize({fullscreenWatchButton_, fullscreenStopWatchButton_, fullscreenMuteButton_});
-    fullscreenWatchButton_->setToolTip("Watch selected channel");
-    fullscreenStopWatchButton_->setToolTip("Stop playback");
-    fullscreenPauseButton_->setToolTip("Pause is only available for local media");
-    connect(fullscreenWatchButton_, &QPushButton::clicked, this, [this]() {
+    setStableButtonWidth(fullscreenWatchButton_, {QStringLiteral("▶")});
+    setStableButtonWidth(fullscreenStopWatchButton_, {QStringLiteral("■")});
+    setStableButtonWidth(fullscreenPauseButton_, {QStringLiteral("▶"), QStringLiteral("||")});
+    configureIconOnlyButton(fullscreenMuteButton_,
+                            firstAvailableThemeIcon({QStringLiteral("audio-volume-high")},
+                                                    QApplication::style()->standardIcon(QStyle::SP_MediaVolume)),
+                            "Mute audio");
+    setUniformButtonSize({fullscreenWatchButton_, fullscreenStopWatchButton_, fullscreenMuteButton_});
+    fullscreenWatchButton_->setToolTip("Watch selected channel");
+    fullscreenStopWatchButton_->setToolTip("Stop playback");
+    fullscreenPauseButton_->setToolTip("Pause is only available for local media");
+    connect(fullscreenWatchButton_, &QPushButton::clicked, this, [this]() {
+        if (mediaPlayer_ != nullptr && currentChannelName_.startsWith("File: ")) {
+            if (mediaPlayer_->playbackState() == QMediaPlayer::PlayingState) {
+                mediaPlayer_->pause();
+            } else {
+                mediaPlayer_->play();
+            }
+            return;
+        }
+        watchSelectedChannel();
+    });
+    connect(fullscreenStopWatchButton_, &QPushButton::clicked, this, &MainWindow::stopWatching);
+    connect(fullscreenMuteButton_, &QPushButton::toggled, this, [this](bool checked) {
+        if (muteButton_ == nullptr) {
+            return;
+        }
+        if (muteButton_->isChecked() != checked) {
+            muteButton_->setChecked(checked);
+        } else {
+            handleMuteToggled(checked);
+        }
+    });
+    connect(fullscreenVolumeSlider_, &QSlider::valueChanged, this, [this](int value) {
+        if (volumeSlider_ == nullptr) {
+            return;
+        }
+        if (volumeSlider_->value() != value) {
+            volumeSlider_->setValue(value);
+        } else {
+            handleVolumeChanged(value);
+        }
+    });
+    connect(fullscreenSeekSlider_, &QSlider::sliderMoved, this, [this](int value) {
+        if (seekSlider_ != nullptr) {
+            const QSignalBlocker blocker(seekSlider_);
+            seekSlider_->setValue(value);
+        }
+        if (seekPositionLabel_ != nullptr) {
+            seekPositionLabel_->setText(playbackSeekLabelText(value));
+        }
+        if (fullscreenSeekPositionLabel_ != nullptr) {
+            fullscreenSeekPositionLabel_->setText(playbackSeekLabelText(value));
+        }
+    });
+    connect(fullscreenSeekSlider_, &QSlider::valueChanged, this, [this](int value) {
+        if (seekSlider_ != nullptr && seekSlider_->value() != value) {
+            const QSignalBlocker blocker(seekSlider_);
+            seekSlider_->setValue(value);
+        }
+        if (seekPositionLabel_ != nullptr) {
+            seekPositionLabel_->setText(playbackSeekLabelText(value));
+        }
+        if (fullscreenSeekPositionLabel_ != nullptr) {
+            fullscreenSeekPositionLabel_->setText(playbackSeekLabelText(value));
+        }
+        if ((fullscreenSeekSlider_ != nullptr && fullscreenSeekSlider_->isSliderDown())
+            || (QApplication::mouseButtons() & Qt::LeftButton)) {
+            applyPlaybackSeekPosition(value);
+        }
+    });
+    connect(fullscreenSeekSlider_, &QSlider::sliderReleased, this, [this]() {
+        if (fullscreenSeekSlider_ != nullptr) {
+            applyPlaybackSeekPosition(fullscreenSeekSlider_->value());
+        }
+    });
+
+    setStatusBarStateMessage(QString());
+    connect(statusBar(), &QStatusBar::messageChanged, this, [this](const QString &message) {
+        if (!message.trimmed().isEmpty()) {
+            return;
+        }
+        QTimer::singleShot(0, this, [this]() {
+            if (statusBar() == nullptr || !statusBar()->currentMessage().trimmed().isEmpty()) {
+                return;
+            }
+            const QString fallback = lastStatusBarMessage_.trimmed();
+            setStatusBarStateMessage(fallback);
+        });
+    });
+
+    connect(startButton_, &QPushButton::clicked, this, &MainWindow::startScan);
+    connect(stopButton_, &QPushButton::clicked, this, &MainWindow::stopScan);
+    connect(watchButton_, &QPushButton::clicked, this, [this]() {
         if (mediaPlayer_ != nullptr && currentChannelName_.startsWith("File: ")) {
             if (mediaPlayer_->playbackState() == QMediaPlayer::PlayingState) {
                 mediaPlayer_->pause();
@@ -5879,291 +7163,620 @@ void MainWindow::buildUi()
         }
         watchSelectedChannel();
     });
-    connect(fullscreenStopWatchButton_, &QPushButton::clicked, this, &MainWindow::stopWatching);
-    connect(fullscreenMuteButton_, &QPushButton::toggled, this, [this](bool checked) {
-        if (muteButton_ == nullptr) {
+    connect(stopWatchButton_, &QPushButton::clicked, this, &MainWindow::stopWatching);
+    connect(openFileButton_, &QPushButton::clicked, this, &MainWindow::openMediaFile);
+    connect(pipToggleButton_, &QPushButton::clicked, this, [this]() {
+        if (currentChannelName_.trimmed().isEmpty()) {
             return;
         }
-        if (muteButton_->isChecked() != checked) {
-            muteButton_->setChecked(checked);
-        } else {
-            handleMuteToggled(checked);
-        }
-    });
-    connect(fullscreenVolumeSlider_, &QSlider::valueChanged, this, [this](int value) {
-        if (volumeSlider_ == nullptr) {
+        if (videoDetachedToPip_) {
+            if (pipWindow_ != nullptr) {
+                pipWindow_->show();
+                pipWindow_->raise();
+                pipWindow_->activateWindow();
+            }
+            setStatusBarStateMessage("Video is already popped out");
             return;
         }
-        if (volumeSlider_->value() != value) {
-            volumeSlider_->setValue(value);
+        manualPictureInPictureRequested_ = true;
+        detachVideoToPip();
+        appendLog("player: moved video into the floating PiP window.");
+        setStatusBarStateMessage("Video popped out to PiP");
+        syncFullscreenOverlayState();
+    });
+    connect(addFavoriteButton_, &QPushButton::clicked, this, &MainWindow::addSelectedFavorite);
+    connect(removeFavoriteButton_, &QPushButton::clicked, this, &MainWindow::removeSelectedFavorite);
+    connect(tabs_, &QTabWidget::currentChanged, this, &MainWindow::handleCurrentTabChanged);
+    connect(hideNoEitChannelsCheckBox_, &QCheckBox::toggled, this, &MainWindow::handleGuideHideNoEitToggled);
+    connect(showFavoritesOnlyCheckBox_, &QCheckBox::toggled, this, &MainWindow::handleGuideShowFavoritesOnlyToggled);
+    connect(showTodayOnlyListingsCheckBox_,
+            &QCheckBox::toggled,
+            this,
+            &MainWindow::handleGuideShowTodayOnlyListingsToggled);
+    connect(obeyScheduledSwitchesCheckBox_, &QCheckBox::toggled, this, &MainWindow::handleObeyScheduledSwitchesChanged);
+    connect(autoFavoriteShowSchedulingCheckBox_,
+            &QCheckBox::toggled,
+            this,
+            &MainWindow::handleAutoFavoriteShowSchedulingToggled);
+    connect(favoriteShowRatingsOverrideCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
+        favoriteShowRatingsOverrideEnabled_ = checked;
+        QSettings settings("tv_tuner_gui", "watcher");
+        settings.setValue(kFavoriteShowRatingsOverrideSetting, favoriteShowRatingsOverrideEnabled_);
+        QTimer::singleShot(0, this, [this, checked]() {
+            if (favoriteShowRatingsOverrideEnabled_ != checked) {
+                return;
+            }
+            applyCurrentShowStatusFromGuideCache();
+            updateTvGuideDialogFromCurrentCache(false);
+        });
+    });
+    connect(autoPictureInPictureCheckBox_, &QCheckBox::toggled, this, &MainWindow::handleAutoPictureInPictureToggled);
+    connect(processedPlaybackCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
+        QSettings settings("tv_tuner_gui", "watcher");
+        settings.setValue(kProcessedPlaybackSetting, checked);
+        const bool liveChannelActive = !currentChannelName_.isEmpty() && !currentChannelName_.startsWith("File: ");
+        appendLog(checked
+                      ? (liveChannelActive
+                             ? "player: processed live playback enabled; restarting the current live channel now."
+                             : "player: processed live playback enabled; the next live channel tune will deinterlace video while preserving channel audio unless recovery is needed.")
+                      : (liveChannelActive
+                             ? "player: processed live playback disabled; restarting the current live channel now."
+                             : "player: processed live playback disabled; the next live channel tune will use passthrough unless recovery is needed."));
+        if (liveChannelActive) {
+            const QString channelName = currentChannelName_;
+            const QString channelLine = currentChannelLine_;
+            showTransientStatusBarMessage("Retuning current channel to apply processed playback change", 4000);
+            QTimer::singleShot(0, this, [this, channelName, channelLine]() {
+                if (channelName.isEmpty() || currentChannelName_ != channelName || userStoppedWatching_) {
+                    return;
+                }
+                startWatchingChannel(channelName, false, channelLine);
+            });
         } else {
-            handleVolumeChanged(value);
+            showTransientStatusBarMessage("Processed playback change saved for the next live tune", 4000);
         }
     });
-    connect(fullscreenSeekSlider_, &QSlider::sliderMoved, this, [this](int value) {
-        if (seekSlider_ != nullptr) {
-            const QSignalBlocker blocker(seekSlider_);
-            seekSlider_->setValue(value);
+    connect(hideStartupSwitchSummaryCheckBox_,
+            &QCheckBox::toggled,
+            this,
+            &MainWindow::handleHideStartupSwitchSummaryToggled);
+    connect(disableTooltipsCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
+        disableTooltips_ = checked;
+        QSettings settings("tv_tuner_gui", "watcher");
+        settings.setValue(kDisableTooltipsSetting, disableTooltips_);
+        if (disableTooltips_) {
+            QToolTip::hideText();
         }
-        if (seekPositionLabel_ != nullptr) {
-            seekPositionLabel_->setText(playbackSeekLabelText(value));
+    });
+    connect(guideRefreshIntervalCombo_,
+            qOverload<int>(&QComboBox::currentIndexChanged),
+            this,
+            &MainWindow::handleGuideRefreshIntervalChanged);
+    connect(refreshGuideWhenCacheRunsOutCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
+        QSettings settings("tv_tuner_gui", "watcher");
+        settings.setValue(kGuideRefreshWhenCacheRunsOutSetting, checked);
+        guideCacheRunoutRefreshRetryUtc_ = QDateTime();
+        applyGuideRefreshIntervalSetting();
+        if (!checked && guideRefreshTimer_ != nullptr) {
+            guideRefreshTimer_->start();
         }
-        if (fullscreenSeekPositionLabel_ != nullptr) {
-            fullscreenSeekPositionLabel_->setText(playbackSeekLabelText(value));
+        if (checked) {
+            const bool dialogVisible = tvGuideDialog_ != nullptr && tvGuideDialog_->isVisible();
+            maybeRefreshGuideWhenCacheRunsOut(dialogVisible);
+        }
+        setStatusBarStateMessage(lastStatusBarMessage_);
+    });
+    connect(guideCacheRetentionCombo_,
+            qOverload<int>(&QComboBox::currentIndexChanged),
+            this,
+            &MainWindow::handleGuideCacheRetentionChanged);
+    connect(useSchedulesDirectGuideCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
+        QSettings settings("tv_tuner_gui", "watcher");
+        settings.setValue(kUseSchedulesDirectGuideSetting, checked);
+        updateSchedulesDirectControls();
+        const bool dialogVisible = tvGuideDialog_ != nullptr && tvGuideDialog_->isVisible();
+        refreshGuideData(false, dialogVisible, [this, dialogVisible](bool refreshed) {
+            if (refreshed) {
+                loadGuideCacheFile();
+                applyCurrentShowStatusFromGuideCache();
+            }
+            if (!dialogVisible) {
+                updateTvGuideDialogFromCurrentCache(false);
+            }
+        });
+    });
+    connect(schedulesDirectUsernameEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
+        QSettings settings("tv_tuner_gui", "watcher");
+        settings.setValue(kSchedulesDirectUsernameSetting, text.trimmed());
+        updateSchedulesDirectControls();
+    });
+    connect(schedulesDirectPostalCodeEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
+        QSettings settings("tv_tuner_gui", "watcher");
+        settings.setValue(kSchedulesDirectPostalCodeSetting, text.trimmed());
+        updateSchedulesDirectControls();
+    });
+    connect(schedulesDirectPasswordEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
+        QSettings settings("tv_tuner_gui", "watcher");
+        const QString trimmedText = text.trimmed();
+        if (trimmedText.isEmpty()) {
+            settings.remove(kSchedulesDirectPasswordSha1Setting);
+        } else if (looksLikeSha1Hex(trimmedText)) {
+            settings.setValue(kSchedulesDirectPasswordSha1Setting, trimmedText.toLower());
+        } else {
+            const QString passwordSha1 =
+                QString::fromLatin1(QCryptographicHash::hash(text.toUtf8(), QCryptographicHash::Sha1).toHex());
+            settings.setValue(kSchedulesDirectPasswordSha1Setting, passwordSha1);
+        }
+        updateSchedulesDirectControls();
+    });
+    connect(exportSchedulesDirectButton_, &QPushButton::clicked, this, &MainWindow::exportSchedulesDirectJson);
+    connect(channelsTable_, &QAbstractItemView::doubleClicked, this, [this](const QModelIndex &) {
+        watchSelectedChannel();
+    });
+    connect(fullscreenButton_, &QPushButton::clicked, this, &MainWindow::toggleFullscreen);
+    updateSchedulesDirectControls();
+}
+
+void MainWindow::ensureTabPageBuilt(QWidget *page)
+{
+    if (page == nullptr) {
+        return;
+    }
+
+    if (page == tvGuidePage_ && tvGuideDialog_ == nullptr) {
+        buildTvGuidePage();
+    } else if (page == metaManagementPage_ && !metaManagementPageBuilt_) {
+        buildMetaManagementPage();
+    } else if (page == logsPage_ && !logsPageBuilt_) {
+        buildLogsPage();
+    } else if (page == displayOptionsPage_ && !displayOptionsPageBuilt_) {
+        buildDisplayOptionsPage();
+    } else if (page == keyBindingsPage_ && !keyBindingsPageBuilt_) {
+        buildKeyBindingsPage();
+    } else if (page == testingBugsPage_ && !testingBugsPageBuilt_) {
+        buildTestingBugsPage();
+    } else {
+        return;
+    }
+    applyDisplayThemeWidgetFonts(page);
+}
+
+void MainWindow::buildTvGuidePage()
+{
+    auto *tvGuidePageLayout = new QVBoxLayout(tvGuidePage_);
+    tvGuidePageLayout->setContentsMargins(0, 0, 0, 0);
+    tvGuidePageLayout->setSpacing(0);
+    tvGuideDialog_ = new TvGuideDialog(tvGuidePage_);
+    tvGuidePageLayout->addWidget(tvGuideDialog_);
+    connect(tvGuideDialog_, &TvGuideDialog::refreshRequested, this, &MainWindow::refreshTvGuide);
+    connect(tvGuideDialog_, &TvGuideDialog::watchRequested, this, &MainWindow::handleGuideWatchRequested);
+    connect(tvGuideDialog_, &TvGuideDialog::scheduleSwitchRequested, this, &MainWindow::handleGuideScheduleToggle);
+    connect(tvGuideDialog_, &TvGuideDialog::searchScheduleRequested, this, &MainWindow::handleSearchScheduleRequested);
+    tvGuideDialog_->setDisplayTheme(currentDisplayTheme_);
+    applyGuideFilterSettings();
+    lastGuideDialogPresentationStamp_.clear();
+}
+
+void MainWindow::buildMetaManagementPage()
+{
+    metaManagementPageBuilt_ = true;
+    auto *metaManagementLayout = new QVBoxLayout(metaManagementPage_);
+
+    auto *favoriteShowsGroup = new QGroupBox("Favorite Shows", metaManagementPage_);
+    auto *favoriteShowsLayout = new QVBoxLayout(favoriteShowsGroup);
+    auto *favoriteShowsAddRow = new QHBoxLayout();
+    favoriteShowRuleEdit_ = new QLineEdit(favoriteShowsGroup);
+    favoriteShowRuleEdit_->setPlaceholderText("Add favorite show name");
+    addFavoriteShowRuleButton_ = new QPushButton("Add Favorite Show", favoriteShowsGroup);
+    addFavoriteShowRuleButton_->setEnabled(false);
+    favoriteShowsAddRow->addWidget(favoriteShowRuleEdit_, 1);
+    favoriteShowsAddRow->addWidget(addFavoriteShowRuleButton_, 0);
+    favoriteShowRulesList_ = new QListWidget(favoriteShowsGroup);
+    favoriteShowRulesList_->setSelectionMode(QAbstractItemView::SingleSelection);
+    favoriteShowRulesList_->setAlternatingRowColors(true);
+    auto *favoriteShowRatingRow = new QHBoxLayout();
+    auto *favoriteShowRatingLabel = new QLabel("Priority rating:", favoriteShowsGroup);
+    favoriteShowRatingSpin_ = new QSpinBox(favoriteShowsGroup);
+    favoriteShowRatingSpin_->setRange(kDefaultFavoriteShowRating, kMaxFavoriteShowRating);
+    favoriteShowRatingSpin_->setEnabled(false);
+    auto *favoriteShowRatingHelpLabel =
+        new QLabel("1 = watch if nothing is on, 10 = keep at all costs", favoriteShowsGroup);
+    favoriteShowRatingHelpLabel->setWordWrap(true);
+    favoriteShowRatingRow->addWidget(favoriteShowRatingLabel, 0);
+    favoriteShowRatingRow->addWidget(favoriteShowRatingSpin_, 0);
+    favoriteShowRatingRow->addWidget(favoriteShowRatingHelpLabel, 1);
+    removeFavoriteShowRuleButton_ = new QPushButton("Remove Selected Favorite Show", favoriteShowsGroup);
+    removeFavoriteShowRuleButton_->setEnabled(false);
+    favoriteShowsLayout->addLayout(favoriteShowsAddRow);
+    favoriteShowsLayout->addWidget(favoriteShowRulesList_, 1);
+    favoriteShowsLayout->addLayout(favoriteShowRatingRow);
+    favoriteShowsLayout->addWidget(removeFavoriteShowRuleButton_, 0);
+
+    auto *scheduledSwitchesGroup = new QGroupBox("Scheduled Switches", metaManagementPage_);
+    auto *scheduledSwitchesLayout = new QVBoxLayout(scheduledSwitchesGroup);
+    scheduledSwitchesList_ = new QListWidget(scheduledSwitchesGroup);
+    scheduledSwitchesList_->setSelectionMode(QAbstractItemView::SingleSelection);
+    scheduledSwitchesList_->setAlternatingRowColors(true);
+    scheduledSwitchesList_->setWordWrap(true);
+    removeScheduledSwitchButton_ = new QPushButton("Remove Selected Switch", scheduledSwitchesGroup);
+    removeScheduledSwitchButton_->setEnabled(false);
+    scheduledSwitchesLayout->addWidget(scheduledSwitchesList_, 1);
+    scheduledSwitchesLayout->addWidget(removeScheduledSwitchButton_, 0);
+
+    metaManagementLayout->addWidget(favoriteShowsGroup, 1);
+    metaManagementLayout->addWidget(scheduledSwitchesGroup, 1);
+
+    connect(favoriteShowRulesList_, &QListWidget::itemSelectionChanged, this, [this]() {
+        if (removeFavoriteShowRuleButton_ != nullptr) {
+            removeFavoriteShowRuleButton_->setEnabled(favoriteShowRulesList_ != nullptr
+                                                      && favoriteShowRulesList_->currentRow() >= 0);
         }
+        syncFavoriteShowRatingControls();
     });
-    connect(fullscreenSeekSlider_, &QSlider::valueChanged, this, [this](int value) {
-        if (seekSlider_ != nullptr && seekSlider_->value() != value) {
-            const QSignalBlocker blocker(seekSlider_);
-            seekSlider_->setValue(value);
-        }
-        if (seekPositionLabel_ != nullptr) {
-            seekPositionLabel_->setText(playbackSeekLabelText(value));
-        }
-        if (fullscreenSeekPositionLabel_ != nullptr) {
-            fullscreenSeekPositionLabel_->setText(playbackSeekLabelText(value));
+    connect(favoriteShowRatingSpin_, qOverload<int>(&QSpinBox::valueChanged), this, [this](int value) {
+        if (favoriteShowRulesList_ == nullptr) {
+            return;
         }
-        if ((fullscreenSeekSlider_ != nullptr && fullscreenSeekSlider_->isSliderDown())
-            || (QApplication::mouseButtons() & Qt::LeftButton)) {
-            applyPlaybackSeekPosition(value);
+        const int row = favoriteShowRulesList_->currentRow();
+        if (row < 0 || row >= favoriteShowRules_.size()) {
+            return;
         }
+        setFavoriteShowRating(favoriteShowRules_.at(row), value);
     });
-    connect(fullscreenSeekSlider_, &QSlider::sliderReleased, this, [this]() {
-        if (fullscreenSeekSlider_ != nullptr) {
-            applyPlaybackSeekPosition(fullscreenSeekSlider_->value());
+    connect(favoriteShowRuleEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
+        if (addFavoriteShowRuleButton_ != nullptr) {
+            addFavoriteShowRuleButton_->setEnabled(!text.simplified().isEmpty());
         }
     });
-
-    setStatusBarStateMessage(QString());
-    connect(statusBar(), &QStatusBar::messageChanged, this, [this](const QString &message) {
-        if (!message.trimmed().isEmpty()) {
+    const auto addManualFavoriteShowRule = [this]() {
+        if (favoriteShowRuleEdit_ == nullptr) {
             return;
         }
-        QTimer::singleShot(0, this, [this]() {
-            if (statusBar() == nullptr || !statusBar()->currentMessage().trimmed().isEmpty()) {
-                return;
-            }
-            const QString fallback = lastStatusBarMessage_.trimmed();
-            setStatusBarStateMessage(fallback);
-        });
-    });
 
-    connect(startButton_, &QPushButton::clicked, this, &MainWindow::startScan);
-    connect(stopButton_, &QPushButton::clicked, this, &MainWindow::stopScan);
-    connect(watchButton_, &QPushButton::clicked, this, [this]() {
-        if (mediaPlayer_ != nullptr && currentChannelName_.startsWith("File: ")) {
-            if (mediaPlayer_->playbackState() == QMediaPlayer::PlayingState) {
-                mediaPlayer_->pause();
-            } else {
-                mediaPlayer_->play();
-            }
+        const QString showName = favoriteShowRuleEdit_->text().simplified();
+        if (showName.isEmpty()) {
             return;
         }
-        watchSelectedChannel();
-    });
-    connect(stopWatchButton_, &QPushButton::clicked, this, &MainWindow::stopWatching);
-    connect(openFileButton_, &QPushButton::clicked, this, &MainWindow::openMediaFile);
-    connect(pipToggleButton_, &QPushButton::clicked, this, [this]() {
-        if (currentChannelName_.trimmed().isEmpty()) {
+
+        if (!addFavoriteShowRule(showName)) {
+            showInformationDialog("Favorite show already saved",
+                                  QString("%1 is already in your favorite show list.").arg(showName));
             return;
         }
-        if (videoDetachedToPip_) {
-            if (pipWindow_ != nullptr) {
-                pipWindow_->show();
-                pipWindow_->raise();
-                pipWindow_->activateWindow();
-            }
-            setStatusBarStateMessage("Video is already popped out");
-            return;
+
+        favoriteShowRuleEdit_->clear();
+        if (autoFavoriteShowSchedulingEnabled_) {
+            autoScheduleFavoriteShowsFromGuideCache(false, true);
+        }
+    };
+    connect(addFavoriteShowRuleButton_, &QPushButton::clicked, this, addManualFavoriteShowRule);
+    connect(favoriteShowRuleEdit_, &QLineEdit::returnPressed, this, addManualFavoriteShowRule);
+    connect(scheduledSwitchesList_, &QListWidget::itemSelectionChanged, this, [this]() {
+        if (removeScheduledSwitchButton_ != nullptr) {
+            removeScheduledSwitchButton_->setEnabled(scheduledSwitchesList_ != nullptr
+                                                     && scheduledSwitchesList_->currentRow() >= 0);
         }
-        manualPictureInPictureRequested_ = true;
-        detachVideoToPip();
-        appendLog("player: moved video into the floating PiP window.");
-        setStatusBarStateMessage("Video popped out to PiP");
-        syncFullscreenOverlayState();
     });
-    connect(addFavoriteButton_, &QPushButton::clicked, this, &MainWindow::addSelectedFavorite);
-    connect(removeFavoriteButton_, &QPushButton::clicked, this, &MainWindow::removeSelectedFavorite);
-    connect(tvGuideDialog_, &TvGuideDialog::refreshRequested, this, &MainWindow::refreshTvGuide);
-    connect(tvGuideDialog_, &TvGuideDialog::watchRequested, this, &MainWindow::handleGuideWatchRequested);
-    connect(tvGuideDialog_, &TvGuideDialog::scheduleSwitchRequested, this, &MainWindow::handleGuideScheduleToggle);
-    connect(tvGuideDialog_, &TvGuideDialog::searchScheduleRequested, this, &MainWindow::handleSearchScheduleRequested);
-    connect(tabs_, &QTabWidget::currentChanged, this, &MainWindow::handleCurrentTabChanged);
-    connect(hideNoEitChannelsCheckBox_, &QCheckBox::toggled, this, &MainWindow::handleGuideHideNoEitToggled);
-    connect(showFavoritesOnlyCheckBox_, &QCheckBox::toggled, this, &MainWindow::handleGuideShowFavoritesOnlyToggled);
-    connect(showTodayOnlyListingsCheckBox_,
-            &QCheckBox::toggled,
-            this,
-            &MainWindow::handleGuideShowTodayOnlyListingsToggled);
-    connect(obeyScheduledSwitchesCheckBox_, &QCheckBox::toggled, this, &MainWindow::handleObeyScheduledSwitchesChanged);
-    connect(autoFavoriteShowSchedulingCheckBox_,
-            &QCheckBox::toggled,
-            this,
-            &MainWindow::handleAutoFavoriteShowSchedulingToggled);
-    connect(favoriteShowRatingsOverrideCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
-        favoriteShowRatingsOverrideEnabled_ = checked;
+    connect(removeFavoriteShowRuleButton_, &QPushButton::clicked, this, &MainWindow::removeSelectedFavoriteShowRule);
+    connect(removeScheduledSwitchButton_, &QPushButton::clicked, this, &MainWindow::removeSelectedScheduledSwitch);
+    refreshFavoriteShowRuleList();
+    syncFavoriteShowRatingControls();
+    // Filled in by handleCurrentTabChanged once the list is visible.
+    scheduledSwitchListRefreshPending_ = true;
+}
+
+void MainWindow::buildLogsPage()
+{
+    logsPageBuilt_ = true;
+    auto *logsLayout = new QVBoxLayout(logsPage_);
+
+    logOutput_ = new QListView(logsPage_);
+    logOutput_->setModel(logLinesModel_);
+    logOutput_->setUniformItemSizes(true);
+    logOutput_->setWordWrap(false);
+    logOutput_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    logOutput_->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    logOutput_->setVerticalScrollMode(QAbstractItemView::ScrollPerItem);
+    logOutput_->setToolTip("w_scan2 and tuning output will appear here...");
+    auto *copyLogLinesShortcut = new QShortcut(QKeySequence::Copy, logOutput_);
+    copyLogLinesShortcut->setContext(Qt::WidgetShortcut);
+    connect(copyLogLinesShortcut, &QShortcut::activated, this, &MainWindow::copySelectedLogLines);
+    auto *logControlsRow = new QHBoxLayout();
+    logAutoScrollCheckBox_ = new QCheckBox("Auto-scroll logs", logsPage_);
+    logAutoScrollCheckBox_->setChecked(true);
+    logControlsRow->addWidget(logAutoScrollCheckBox_);
+    logControlsRow->addStretch();
+    logsLayout->addLayout(logControlsRow);
+    logsLayout->addWidget(logOutput_);
+
+    connect(logAutoScrollCheckBox_, &QCheckBox::toggled, this, [](bool checked) {
         QSettings settings("tv_tuner_gui", "watcher");
-        settings.setValue(kFavoriteShowRatingsOverrideSetting, favoriteShowRatingsOverrideEnabled_);
-        QTimer::singleShot(0, this, [this, checked]() {
-            if (favoriteShowRatingsOverrideEnabled_ != checked) {
-                return;
+        settings.setValue(kLogAutoScrollSetting, checked);
+    });
+    {
+        QSettings settings("tv_tuner_gui", "watcher");
+        const QSignalBlocker blocker(logAutoScrollCheckBox_);
+        logAutoScrollCheckBox_->setChecked(settings.value(kLogAutoScrollSetting, true).toBool());
+    }
+    logOutput_->setFont(qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_, DisplayThemeKeys::LogFont),
+                                                  font()));
+}
+
+void MainWindow::buildDisplayOptionsPage()
+{
+    displayOptionsPageBuilt_ = true;
+    auto *displayOptionsPageLayout = new QVBoxLayout(displayOptionsPage_);
+    displayOptionsPageLayout->setContentsMargins(0, 0, 0, 0);
+    displayOptionsPageLayout->setSpacing(0);
+    auto *displayOptionsScrollArea = new QScrollArea(displayOptionsPage_);
+    displayOptionsScrollArea->setWidgetResizable(true);
+    displayOptionsScrollArea->setFrameShape(QFrame::NoFrame);
+    displayOptionsScrollArea->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    auto *displayOptionsContent = new QWidget(displayOptionsScrollArea);
+    auto *displayOptionsLayout = new QVBoxLayout(displayOptionsContent);
+    displayOptionsLayout->setContentsMargins(14, 14, 14, 14);
+    displayOptionsLayout->setSpacing(12);
+
+    auto *themeLibraryGroup = new QGroupBox("Theme Library", displayOptionsPage_);
+    auto *themeLibraryLayout = new QVBoxLayout(themeLibraryGroup);
+    themeLibraryLayout->setContentsMargins(12, 14, 12, 12);
+    themeLibraryLayout->setSpacing(10);
+    auto *themeSelectionRow = new QHBoxLayout();
+    themeSelectionRow->setSpacing(8);
+    themeSelectionRow->addWidget(new QLabel("Saved themes:", themeLibraryGroup), 0);
+    displayThemeSavedThemesCombo_ = new QComboBox(themeLibraryGroup);
+    displayThemeLoadButton_ = new QPushButton("Load Selected", themeLibraryGroup);
+    displayThemeOverwriteButton_ = new QPushButton("Overwrite Selected", themeLibraryGroup);
+    displayThemeDeleteButton_ = new QPushButton("Delete Selected", themeLibraryGroup);
+    themeSelectionRow->addWidget(displayThemeSavedThemesCombo_, 1);
+    themeSelectionRow->addWidget(displayThemeLoadButton_, 0);
+    themeSelectionRow->addWidget(displayThemeOverwriteButton_, 0);
+    themeSelectionRow->addWidget(displayThemeDeleteButton_, 0);
+    auto *themeSaveRow = new QHBoxLayout();
+    themeSaveRow->setSpacing(8);
+    themeSaveRow->addWidget(new QLabel("Theme name:", themeLibraryGroup), 0);
+    displayThemeNameEdit_ = new QLineEdit(themeLibraryGroup);
+    displayThemeNameEdit_->setPlaceholderText("Save the current look as a named theme");
+    displayThemeSaveAsButton_ = new QPushButton("Save As New Theme", themeLibraryGroup);
+    displayThemeResetButton_ = new QPushButton("Reset Current To Defaults", themeLibraryGroup);
+    themeSaveRow->addWidget(displayThemeNameEdit_, 1);
+    themeSaveRow->addWidget(displayThemeSaveAsButton_, 0);
+    themeSaveRow->addWidget(displayThemeResetButton_, 0);
+    displayThemeFilePathLabel_ =
+        new QLabel(QString("Theme file: %1").arg(resolveDisplayThemeStorePath()), themeLibraryGroup);
+    displayThemeFilePathLabel_->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    displayThemeFilePathLabel_->setWordWrap(true);
+    displayThemeStatusLabel_ = new QLabel("Editing the current theme updates the theme file immediately.", themeLibraryGroup);
+    displayThemeStatusLabel_->setWordWrap(true);
+    displayThemeStatusLabel_->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    themeLibraryLayout->addLayout(themeSelectionRow);
+    themeLibraryLayout->addLayout(themeSaveRow);
+    themeLibraryLayout->addWidget(displayThemeFilePathLabel_);
+    themeLibraryLayout->addWidget(displayThemeStatusLabel_);
+
+    auto *colorsGroup = new QGroupBox("Colors", displayOptionsPage_);
+    auto *colorsLayout = new QGridLayout(colorsGroup);
+    colorsLayout->setContentsMargins(12, 14, 12, 12);
+    colorsLayout->setHorizontalSpacing(12);
+    colorsLayout->setVerticalSpacing(8);
+    colorsLayout->setColumnStretch(1, 1);
+    colorsLayout->setColumnStretch(3, 1);
+    const QList<DisplayColorRoleSpec> colorSpecs = displayColorRoleSpecs();
+    for (int index = 0; index < colorSpecs.size(); ++index) {
+        const DisplayColorRoleSpec &spec = colorSpecs.at(index);
+        auto *label = new QLabel(spec.label + ":", colorsGroup);
+        label->setWordWrap(true);
+        auto *button = new QPushButton(colorsGroup);
+        button->setMinimumWidth(160);
+        displayThemeColorButtons_.insert(spec.key, button);
+        const int row = index / 2;
+        const int column = (index % 2) * 2;
+        colorsLayout->addWidget(label, row, column);
+        colorsLayout->addWidget(button, row, column + 1);
+    }
+
+    auto *fontsGroup = new QGroupBox("Fonts", displayOptionsPage_);
+    auto *fontsLayout = new QGridLayout(fontsGroup);
+    fontsLayout->setContentsMargins(12, 14, 12, 12);
+    fontsLayout->setHorizontalSpacing(10);
+    fontsLayout->setVerticalSpacing(8);
+    fontsLayout->addWidget(new QLabel("Element", fontsGroup), 0, 0);
+    fontsLayout->addWidget(new QLabel("Family", fontsGroup), 0, 1);
+    fontsLayout->addWidget(new QLabel("Size", fontsGroup), 0, 2);
+    fontsLayout->addWidget(new QLabel("Bold", fontsGroup), 0, 3);
+    fontsLayout->addWidget(new QLabel("Italic", fontsGroup), 0, 4);
+    fontsLayout->addWidget(new QLabel("Underline", fontsGroup), 0, 5);
+    fontsLayout->setColumnStretch(1, 1);
+    const QList<DisplayFontRoleSpec> fontSpecs = displayFontRoleSpecs();
+    for (int index = 0; index < fontSpecs.size(); ++index) {
+        const DisplayFontRoleSpec &spec = fontSpecs.at(index);
+        auto *label = new QLabel(spec.label, fontsGroup);
+        auto *familyCombo = new QFontComboBox(fontsGroup);
+        familyCombo->setSizeAdjustPolicy(QComboBox::AdjustToMinimumContentsLengthWithIcon);
+        auto *sizeSpin = new QSpinBox(fontsGroup);
+        sizeSpin->setRange(6, 48);
+        auto *boldCheck = new QCheckBox(fontsGroup);
+        auto *italicCheck = new QCheckBox(fontsGroup);
+        auto *underlineCheck = new QCheckBox(fontsGroup);
+        displayThemeFontEditors_.insert(spec.key, {familyCombo, sizeSpin, boldCheck, italicCheck, underlineCheck});
+        const int row = index + 1;
+        fontsLayout->addWidget(label, row, 0);
+        fontsLayout->addWidget(familyCombo, row, 1);
+        fontsLayout->addWidget(sizeSpin, row, 2);
+        fontsLayout->addWidget(boldCheck, row, 3, Qt::AlignCenter);
+        fontsLayout->addWidget(italicCheck, row, 4, Qt::AlignCenter);
+        fontsLayout->addWidget(underlineCheck, row, 5, Qt::AlignCenter);
+    }
+
+    displayOptionsLayout->addWidget(themeLibraryGroup);
+    displayOptionsLayout->addWidget(colorsGroup);
+    displayOptionsLayout->addWidget(fontsGroup);
+    displayOptionsLayout->addStretch(1);
+    displayOptionsScrollArea->setWidget(displayOptionsContent);
+    displayOptionsPageLayout->addWidget(displayOptionsScrollArea);
+
+    if (!displayThemeStatusText_.isEmpty()) {
+        displayThemeStatusLabel_->setText(displayThemeStatusText_);
+    }
+
+    if (displayThemeLoadButton_ != nullptr) {
+        connect(displayThemeLoadButton_, &QPushButton::clicked, this, &MainWindow::loadSelectedDisplayTheme);
+    }
+    if (displayThemeSaveAsButton_ != nullptr) {
+        connect(displayThemeSaveAsButton_, &QPushButton::clicked, this, &MainWindow::saveCurrentDisplayThemeAsNew);
+    }
+    if (displayThemeOverwriteButton_ != nullptr) {
+        connect(displayThemeOverwriteButton_, &QPushButton::clicked, this, &MainWindow::overwriteSelectedDisplayTheme);
+    }
+    if (displayThemeDeleteButton_ != nullptr) {
+        connect(displayThemeDeleteButton_, &QPushButton::clicked, this, &MainWindow::deleteSelectedDisplayTheme);
+    }
+    if (displayThemeResetButton_ != nullptr) {
+        connect(displayThemeResetButton_, &QPushButton::clicked, this, &MainWindow::resetCurrentDisplayThemeToDefaults);
+    }
+    if (displayThemeNameEdit_ != nullptr) {
+        connect(displayThemeNameEdit_, &QLineEdit::returnPressed, this, &MainWindow::saveCurrentDisplayThemeAsNew);
+        connect(displayThemeNameEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
+            if (displayThemeSaveAsButton_ != nullptr) {
+                displayThemeSaveAsButton_->setEnabled(!text.simplified().isEmpty());
             }
-            applyCurrentShowStatusFromGuideCache();
-            updateTvGuideDialogFromCurrentCache(false);
         });
-    });
-    connect(autoPictureInPictureCheckBox_, &QCheckBox::toggled, this, &MainWindow::handleAutoPictureInPictureToggled);
-    connect(processedPlaybackCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
-        QSettings settings("tv_tuner_gui", "watcher");
-        settings.setValue(kProcessedPlaybackSetting, checked);
-        const bool liveChannelActive = !currentChannelName_.isEmpty() && !currentChannelName_.startsWith("File: ");
-        appendLog(checked
-                      ? (liveChannelActive
-                             ? "player: processed live playback enabled; restarting the current live channel now."
-                             : "player: processed live playback enabled; the next live channel tune will deinterlace video while preserving channel audio unless recovery is needed.")
-                      : (liveChannelActive
-                             ? "player: processed live playback disabled; restarting the current live channel now."
-                             : "player: processed live playback disabled; the next live channel tune will use passthrough unless recovery is needed."));
-        if (liveChannelActive) {
-            const QString channelName = currentChannelName_;
-            const QString channelLine = currentChannelLine_;
-            showTransientStatusBarMessage("Retuning current channel to apply processed playback change", 4000);
-            QTimer::singleShot(0, this, [this, channelName, channelLine]() {
-                if (channelName.isEmpty() || currentChannelName_ != channelName || userStoppedWatching_) {
-                    return;
-                }
-                startWatchingChannel(channelName, false, channelLine);
+    }
+    for (auto it = displayThemeColorButtons_.begin(); it != displayThemeColorButtons_.end(); ++it) {
+        const QString roleKey = it.key();
+        if (it.value() != nullptr) {
+            connect(it.value(), &QPushButton::clicked, this, [this, roleKey]() {
+                chooseDisplayThemeColor(roleKey);
             });
-        } else {
-            showTransientStatusBarMessage("Processed playback change saved for the next live tune", 4000);
-        }
-    });
-    connect(hideStartupSwitchSummaryCheckBox_,
-            &QCheckBox::toggled,
-            this,
-            &MainWindow::handleHideStartupSwitchSummaryToggled);
-    connect(disableTooltipsCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
-        disableTooltips_ = checked;
-        QSettings settings("tv_tuner_gui", "watcher");
-        settings.setValue(kDisableTooltipsSetting, disableTooltips_);
-        if (disableTooltips_) {
-            QToolTip::hideText();
-        }
-    });
-    connect(guideRefreshIntervalCombo_,
-            qOverload<int>(&QComboBox::currentIndexChanged),
-            this,
-            &MainWindow::handleGuideRefreshIntervalChanged);
-    connect(refreshGuideWhenCacheRunsOutCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
-        QSettings settings("tv_tuner_gui", "watcher");
-        settings.setValue(kGuideRefreshWhenCacheRunsOutSetting, checked);
-        guideCacheRunoutRefreshRetryUtc_ = QDateTime();
-        applyGuideRefreshIntervalSetting();
-        if (!checked && guideRefreshTimer_ != nullptr) {
-            guideRefreshTimer_->start();
-        }
-        if (checked) {
-            const bool dialogVisible = tvGuideDialog_ != nullptr && tvGuideDialog_->isVisible();
-            maybeRefreshGuideWhenCacheRunsOut(dialogVisible);
-        }
-        setStatusBarStateMessage(lastStatusBarMessage_);
-    });
-    connect(guideCacheRetentionCombo_,
-            qOverload<int>(&QComboBox::currentIndexChanged),
-            this,
-            &MainWindow::handleGuideCacheRetentionChanged);
-    connect(useSchedulesDirectGuideCheckBox_, &QCheckBox::toggled, this, [this](bool checked) {
-        QSettings settings("tv_tuner_gui", "watcher");
-        settings.setValue(kUseSchedulesDirectGuideSetting, checked);
-        updateSchedulesDirectControls();
-        const bool dialogVisible = tvGuideDialog_ != nullptr && tvGuideDialog_->isVisible();
-        if (refreshGuideData(false, dialogVisible)) {
-            loadGuideCacheFile();
-            applyCurrentShowStatusFromGuideCache();
-        }
-        if (!dialogVisible) {
-            updateTvGuideDialogFromCurrentCache(false);
-        }
-    });
-    connect(schedulesDirectUsernameEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
-        QSettings settings("tv_tuner_gui", "watcher");
-        settings.setValue(kSchedulesDirectUsernameSetting, text.trimmed());
-        updateSchedulesDirectControls();
-    });
-    connect(schedulesDirectPostalCodeEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
-        QSettings settings("tv_tuner_gui", "watcher");
-        settings.setValue(kSchedulesDirectPostalCodeSetting, text.trimmed());
-        updateSchedulesDirectControls();
-    });
-    connect(schedulesDirectPasswordEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
-        QSettings settings("tv_tuner_gui", "watcher");
-        const QString trimmedText = text.trimmed();
-        if (trimmedText.isEmpty()) {
-            settings.remove(kSchedulesDirectPasswordSha1Setting);
-        } else if (looksLikeSha1Hex(trimmedText)) {
-            settings.setValue(kSchedulesDirectPasswordSha1Setting, trimmedText.toLower());
-        } else {
-            const QString passwordSha1 =
-                QString::fromLatin1(QCryptographicHash::hash(text.toUtf8(), QCryptographicHash::Sha1).toHex());
-            settings.setValue(kSchedulesDirectPasswordSha1Setting, passwordSha1);
         }
-        updateSchedulesDirectControls();
-    });
-    connect(exportSchedulesDirectButton_, &QPushButton::clicked, this, &MainWindow::exportSchedulesDirectJson);
-    connect(channelsTable_, &QTableWidget::cellDoubleClicked, this, [this](int, int) {
-        watchSelectedChannel();
-    });
-    connect(favoriteShowRulesList_, &QListWidget::itemSelectionChanged, this, [this]() {
-        if (removeFavoriteShowRuleButton_ != nullptr) {
-            removeFavoriteShowRuleButton_->setEnabled(favoriteShowRulesList_ != nullptr
-                                                      && favoriteShowRulesList_->currentRow() >= 0);
+    }
+    for (auto it = displayThemeFontEditors_.begin(); it != displayThemeFontEditors_.end(); ++it) {
+        const QString roleKey = it.key();
+        const DisplayFontEditorWidgets widgets = it.value();
+        if (widgets.family != nullptr) {
+            connect(widgets.family,
+                    &QFontComboBox::currentFontChanged,
+                    this,
+                    [this, roleKey](const QFont &) { handleDisplayThemeFontEdited(roleKey); });
         }
-        syncFavoriteShowRatingControls();
-    });
-    connect(favoriteShowRatingSpin_, qOverload<int>(&QSpinBox::valueChanged), this, [this](int value) {
-        if (favoriteShowRulesList_ == nullptr) {
-            return;
+        if (widgets.size != nullptr) {
+            connect(widgets.size,
+                    qOverload<int>(&QSpinBox::valueChanged),
+                    this,
+                    [this, roleKey](int) { handleDisplayThemeFontEdited(roleKey); });
         }
-        const int row = favoriteShowRulesList_->currentRow();
-        if (row < 0 || row >= favoriteShowRules_.size()) {
-            return;
+        if (widgets.bold != nullptr) {
+            connect(widgets.bold, &QCheckBox::toggled, this, [this, roleKey](bool) {
+                handleDisplayThemeFontEdited(roleKey);
+            });
         }
-        setFavoriteShowRating(favoriteShowRules_.at(row), value);
-    });
-    connect(favoriteShowRuleEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
-        if (addFavoriteShowRuleButton_ != nullptr) {
-            addFavoriteShowRuleButton_->setEnabled(!text.simplified().isEmpty());
+        if (widgets.italic != nullptr) {
+            connect(widgets.italic, &QCheckBox::toggled, this, [this, roleKey](bool) {
+                handleDisplayThemeFontEdited(roleKey);
+            });
         }
-    });
-    const auto addManualFavoriteShowRule = [this]() {
-        if (favoriteShowRuleEdit_ == nullptr) {
-            return;
+        if (widgets.underline != nullptr) {
+            connect(widgets.underline, &QCheckBox::toggled, this, [this, roleKey](bool) {
+                handleDisplayThemeFontEdited(roleKey);
+            });
         }
+    }
+    refreshSavedDisplayThemeList(currentDisplayTheme_.name);
+    if (displayThemeNameEdit_ != nullptr) {
+        displayThemeNameEdit_->setText(currentDisplayTheme_.name);
+    }
+    refreshDisplayThemeControls();
+}
 
-        const QString showName = favoriteShowRuleEdit_->text().simplified();
-        if (showName.isEmpty()) {
-            return;
-        }
+void MainWindow::buildKeyBindingsPage()
+{
+    keyBindingsPageBuilt_ = true;
+    auto *keyBindingsPageLayout = new QVBoxLayout(keyBindingsPage_);
+    keyBindingsPageLayout->setContentsMargins(0, 0, 0, 0);
+    keyBindingsPageLayout->setSpacing(0);
+    auto *keyBindingsScrollArea = new QScrollArea(keyBindingsPage_);
+    keyBindingsScrollArea->setWidgetResizable(true);
+    keyBindingsScrollArea->setFrameShape(QFrame::NoFrame);
+    keyBindingsScrollArea->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    auto *keyBindingsContent = new QWidget(keyBindingsScrollArea);
+    auto *keyBindingsLayout = new QVBoxLayout(keyBindingsContent);
+    keyBindingsLayout->setContentsMargins(14, 14, 14, 14);
+    keyBindingsLayout->setSpacing(12);
 
-        if (!addFavoriteShowRule(showName)) {
-            showInformationDialog("Favorite show already saved",
-                                  QString("%1 is already in your favorite show list.").arg(showName));
-            return;
-        }
+    auto *keyBindingsGroup = new QGroupBox("Key Bindings", keyBindingsPage_);
+    auto *keyBindingsGroupLayout = new QGridLayout(keyBindingsGroup);
+    keyBindingsGroupLayout->setContentsMargins(12, 14, 12, 12);
+    keyBindingsGroupLayout->setHorizontalSpacing(10);
+    keyBindingsGroupLayout->setVerticalSpacing(8);
+    keyBindingsGroupLayout->addWidget(new QLabel("Action", keyBindingsGroup), 0, 0);
+    keyBindingsGroupLayout->addWidget(new QLabel("Shortcut", keyBindingsGroup), 0, 1);
+    keyBindingsGroupLayout->addWidget(new QLabel("Clear", keyBindingsGroup), 0, 2);
+    keyBindingsGroupLayout->addWidget(new QLabel("Status", keyBindingsGroup), 0, 3);
+    keyBindingsGroupLayout->setColumnStretch(1, 1);
+    keyBindingsGroupLayout->setColumnStretch(3, 1);
+
+    auto *keyBindingsHelpLabel = new QLabel(
+        "Each action uses one shortcut. Multi-step shortcuts and conflicting shortcuts are rejected. "
+        "Use Clear to unassign one.",
+        keyBindingsGroup);
+    keyBindingsHelpLabel->setWordWrap(true);
+    keyBindingsGroupLayout->addWidget(keyBindingsHelpLabel, 1, 0, 1, 4);
+
+    int keyBindingRow = 2;
+    for (const KeyBindingSpec &spec : keyBindingSpecs()) {
+        auto *label = new QLabel(spec.label, keyBindingsGroup);
+        auto *editor = new QKeySequenceEdit(keyBindingsGroup);
+        auto *clearButton = new QPushButton("Clear", keyBindingsGroup);
+        auto *statusLabel = new QLabel(keyBindingsGroup);
+        statusLabel->setWordWrap(true);
+        statusLabel->setStyleSheet("QLabel { color: #ff9a9a; }");
+        keyBindingEditors_.insert(spec.id, editor);
+        keyBindingConflictLabels_.insert(spec.id, statusLabel);
+        keyBindingsGroupLayout->addWidget(label, keyBindingRow, 0);
+        keyBindingsGroupLayout->addWidget(editor, keyBindingRow, 1);
+        keyBindingsGroupLayout->addWidget(clearButton, keyBindingRow, 2);
+        keyBindingsGroupLayout->addWidget(statusLabel, keyBindingRow, 3);
+        connect(editor, &QKeySequenceEdit::keySequenceChanged, this, [this, actionId = spec.id](const QKeySequence &sequence) {
+            updateKeyBinding(actionId, sequence, true);
+        });
+        connect(clearButton, &QPushButton::clicked, this, [this, actionId = spec.id]() {
+            updateKeyBinding(actionId, QKeySequence(), false);
+        });
+        ++keyBindingRow;
+    }
+
+    keyBindingsLayout->addWidget(keyBindingsGroup);
+    keyBindingsLayout->addStretch(1);
+    keyBindingsScrollArea->setWidget(keyBindingsContent);
+    keyBindingsPageLayout->addWidget(keyBindingsScrollArea);
+
+    refreshKeyBindingEditors();
+}
+
+void MainWindow::buildTestingBugsPage()
+{
+    testingBugsPageBuilt_ = true;
+    auto *testingBugsLayout = new QVBoxLayout(testingBugsPage_);
+
+    auto *testingBugsGroup = new QGroupBox("Testing / Bugs", testingBugsPage_);
+    auto *testingBugsGroupLayout = new QVBoxLayout(testingBugsGroup);
+    auto *testingBugsEntryRow = new QHBoxLayout();
+    testingBugItemEdit_ = new QLineEdit(testingBugsGroup);
+    testingBugItemEdit_->setPlaceholderText("Add something to test or watch for");
+    saveTestingBugItemButton_ = new QPushButton("Save Item", testingBugsGroup);
+    saveTestingBugItemButton_->setEnabled(false);
+    testingBugsEntryRow->addWidget(testingBugItemEdit_, 1);
+    testingBugsEntryRow->addWidget(saveTestingBugItemButton_, 0);
+    testingBugItemsList_ = new QListWidget(testingBugsGroup);
+    testingBugItemsList_->setSelectionMode(QAbstractItemView::SingleSelection);
+    testingBugItemsList_->setAlternatingRowColors(true);
+    removeTestingBugItemButton_ = new QPushButton("Delete Selected Item", testingBugsGroup);
+    removeTestingBugItemButton_->setEnabled(false);
+    testingBugsGroupLayout->addLayout(testingBugsEntryRow);
+    testingBugsGroupLayout->addWidget(testingBugItemsList_, 1);
+    testingBugsGroupLayout->addWidget(removeTestingBugItemButton_, 0);
+    testingBugsLayout->addWidget(testingBugsGroup, 1);
 
-        favoriteShowRuleEdit_->clear();
-        if (autoFavoriteShowSchedulingEnabled_) {
-            autoScheduleFavoriteShowsFromGuideCache(false, true);
-        }
-    };
-    connect(addFavoriteShowRuleButton_, &QPushButton::clicked, this, addManualFavoriteShowRule);
-    connect(favoriteShowRuleEdit_, &QLineEdit::returnPressed, this, addManualFavoriteShowRule);
-    connect(scheduledSwitchesList_, &QListWidget::itemSelectionChanged, this, [this]() {
-        if (removeScheduledSwitchButton_ != nullptr) {
-            removeScheduledSwitchButton_->setEnabled(scheduledSwitchesList_ != nullptr
-                                                     && scheduledSwitchesList_->currentRow() >= 0);
-        }
-    });
     connect(testingBugItemEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
         if (saveTestingBugItemButton_ != nullptr) {
             saveTestingBugItemButton_->setEnabled(!text.simplified().isEmpty());
@@ -6181,82 +7794,14 @@ void MainWindow::buildUi()
         saveTestingBugItems();
     });
     connect(removeTestingBugItemButton_, &QPushButton::clicked, this, &MainWindow::removeSelectedTestingBugItem);
-    connect(removeFavoriteShowRuleButton_, &QPushButton::clicked, this, &MainWindow::removeSelectedFavoriteShowRule);
-    connect(removeScheduledSwitchButton_, &QPushButton::clicked, this, &MainWindow::removeSelectedScheduledSwitch);
-    connect(fullscreenButton_, &QPushButton::clicked, this, &MainWindow::toggleFullscreen);
-    if (displayThemeLoadButton_ != nullptr) {
-        connect(displayThemeLoadButton_, &QPushButton::clicked, this, &MainWindow::loadSelectedDisplayTheme);
-    }
-    if (displayThemeSaveAsButton_ != nullptr) {
-        connect(displayThemeSaveAsButton_, &QPushButton::clicked, this, &MainWindow::saveCurrentDisplayThemeAsNew);
-    }
-    if (displayThemeOverwriteButton_ != nullptr) {
-        connect(displayThemeOverwriteButton_, &QPushButton::clicked, this, &MainWindow::overwriteSelectedDisplayTheme);
-    }
-    if (displayThemeDeleteButton_ != nullptr) {
-        connect(displayThemeDeleteButton_, &QPushButton::clicked, this, &MainWindow::deleteSelectedDisplayTheme);
-    }
-    if (displayThemeResetButton_ != nullptr) {
-        connect(displayThemeResetButton_, &QPushButton::clicked, this, &MainWindow::resetCurrentDisplayThemeToDefaults);
-    }
-    if (displayThemeNameEdit_ != nullptr) {
-        connect(displayThemeNameEdit_, &QLineEdit::returnPressed, this, &MainWindow::saveCurrentDisplayThemeAsNew);
-        connect(displayThemeNameEdit_, &QLineEdit::textChanged, this, [this](const QString &text) {
-            if (displayThemeSaveAsButton_ != nullptr) {
-                displayThemeSaveAsButton_->setEnabled(!text.simplified().isEmpty());
-            }
-        });
-    }
-    for (auto it = displayThemeColorButtons_.begin(); it != displayThemeColorButtons_.end(); ++it) {
-        const QString roleKey = it.key();
-        if (it.value() != nullptr) {
-            connect(it.value(), &QPushButton::clicked, this, [this, roleKey]() {
-                chooseDisplayThemeColor(roleKey);
-            });
-        }
-    }
-    for (auto it = displayThemeFontEditors_.begin(); it != displayThemeFontEditors_.end(); ++it) {
-        const QString roleKey = it.key();
-        const DisplayFontEditorWidgets widgets = it.value();
-        if (widgets.family != nullptr) {
-            connect(widgets.family,
-                    &QFontComboBox::currentFontChanged,
-                    this,
-                    [this, roleKey](const QFont &) { handleDisplayThemeFontEdited(roleKey); });
-        }
-        if (widgets.size != nullptr) {
-            connect(widgets.size,
-                    qOverload<int>(&QSpinBox::valueChanged),
-                    this,
-                    [this, roleKey](int) { handleDisplayThemeFontEdited(roleKey); });
-        }
-        if (widgets.bold != nullptr) {
-            connect(widgets.bold, &QCheckBox::toggled, this, [this, roleKey](bool) {
-                handleDisplayThemeFontEdited(roleKey);
-            });
-        }
-        if (widgets.italic != nullptr) {
-            connect(widgets.italic, &QCheckBox::toggled, this, [this, roleKey](bool) {
-                handleDisplayThemeFontEdited(roleKey);
-            });
-        }
-        if (widgets.underline != nullptr) {
-            connect(widgets.underline, &QCheckBox::toggled, this, [this, roleKey](bool) {
-                handleDisplayThemeFontEdited(roleKey);
-            });
-        }
-    }
-    refreshSavedDisplayThemeList(currentDisplayTheme_.name);
-    if (displayThemeNameEdit_ != nullptr) {
-        displayThemeNameEdit_->setText(currentDisplayTheme_.name);
-    }
-    refreshDisplayThemeControls();
-    updateSchedulesDirectControls();
+
+    loadTestingBugItems();
 }
 
 void MainWindow::setDisplayThemeStatusMessage(const QString &text, bool appendToLog)
 {
     const QString trimmed = text.trimmed();
+    displayThemeStatusText_ = trimmed;
     if (displayThemeStatusLabel_ != nullptr) {
         displayThemeStatusLabel_->setText(trimmed);
     }
@@ -6425,63 +7970,73 @@ void MainWindow::applyDisplayTheme(bool persistCurrentTheme)
     currentDisplayTheme_ = normalizedDisplayTheme(currentDisplayTheme_);
     displayThemeStore_.currentTheme = currentDisplayTheme_;
 
-    const auto color = [this](const char *key) {
-        return colorCss(displayThemeColor(currentDisplayTheme_, QString::fromLatin1(key)));
+    // Only widget groups that use a changed role are restyled; the app font is the fallback for every other font,
+    // so changing it restyles everything.
+    const QSet<QString> changedRoles = displayThemeApplied_
+                                           ? changedDisplayThemeRoles(appliedDisplayTheme_, currentDisplayTheme_)
+                                           : QSet<QString>();
+    const bool applyAll = !displayThemeApplied_ || changedRoles.contains(DisplayThemeKeys::AppFont);
+    const auto affected = [&changedRoles, applyAll](std::initializer_list<const char *> roleKeys) {
+        return applyAll || anyDisplayThemeRoleChanged(changedRoles, roleKeys);
     };
+    appliedDisplayTheme_ = currentDisplayTheme_;
+    displayThemeApplied_ = true;
 
-    qApp->setFont(qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_, DisplayThemeKeys::AppFont),
-                                            qApp->font()));
-    qApp->setPalette(buildApplicationPalette(currentDisplayTheme_, qApp->palette()));
-    qApp->setStyleSheet(buildScrollBarStyleSheet(currentDisplayTheme_) + buildSliderStyleSheet(currentDisplayTheme_));
-
-    const QString tabFontCss =
-        styleSheetFontFragment(displayThemeFontStyle(currentDisplayTheme_, DisplayThemeKeys::TabFont));
-    const QString checkBoxFontCss =
-        styleSheetFontFragment(displayThemeFontStyle(currentDisplayTheme_, DisplayThemeKeys::ButtonFont));
-
-    const QString mainPageStyle =
-        QString(
-            "QWidget { background-color: %1; color: %2; }"
-            "QGroupBox { border: 1px solid %3; margin-top: 12px; padding-top: 8px; }"
-            "QGroupBox::title { subcontrol-origin: margin; left: 10px; padding: 0 4px; color: %2; }"
-            "QPushButton { background-color: %4; color: %5; border: 1px solid %6; padding: 6px 12px; }"
-            "QPushButton:disabled { color: %7; border-color: %8; }"
-            "QCheckBox { color: %2; spacing: 6px; %18 }"
-            "QCheckBox::indicator { width: 16px; height: 16px; background-color: %19; border: 1px solid %20; }"
-            "QCheckBox::indicator:checked { background-color: %21; border: 1px solid %20; image: none; }"
-            "QCheckBox::indicator:unchecked { background-color: %19; border: 1px solid %20; image: none; }"
-            "QScrollArea, QScrollArea > QWidget > QWidget { background-color: %1; }"
-            "QLineEdit, QComboBox, QListWidget, QPlainTextEdit, QTableWidget, QSpinBox, QFontComboBox {"
-            " background-color: %9; color: %10; border: 1px solid %11; selection-background-color: %12; selection-color: %13; }"
-            "QTableWidget#channelListingTable { gridline-color: %22; }"
-            "QHeaderView::section { background-color: %14; color: %15; border: 1px solid %16; padding: 4px; }"
-            "QLabel { color: %17; }"
-            "QToolTip { background-color: %1; color: %2; border: 1px solid %3; }")
-            .arg(color(DisplayThemeKeys::WindowBackground),
-                 color(DisplayThemeKeys::WindowText),
-                 color(DisplayThemeKeys::GroupBorder),
-                 color(DisplayThemeKeys::ButtonBackground),
-                 color(DisplayThemeKeys::ButtonText),
-                 color(DisplayThemeKeys::ButtonBorder),
-                 color(DisplayThemeKeys::ButtonDisabledText),
-                 color(DisplayThemeKeys::ButtonDisabledBorder),
-                 color(DisplayThemeKeys::InputBackground),
-                 color(DisplayThemeKeys::InputText),
-                 color(DisplayThemeKeys::InputBorder),
-                 color(DisplayThemeKeys::Highlight),
-                 color(DisplayThemeKeys::HighlightText),
-                 color(DisplayThemeKeys::HeaderBackground),
-                 color(DisplayThemeKeys::HeaderText),
-                 color(DisplayThemeKeys::HeaderBorder),
-                 color(DisplayThemeKeys::LabelText),
-                 checkBoxFontCss,
-                 color(DisplayThemeKeys::CheckBoxIndicatorBackground),
-                 color(DisplayThemeKeys::CheckBoxIndicatorBorder),
-                 color(DisplayThemeKeys::CheckBoxIndicatorChecked),
-                 color(DisplayThemeKeys::ChannelListGridLine));
+    // currentDisplayTheme_ is normalized above, so roles are read directly instead of re-normalizing per lookup.
+    const auto color = [this](const char *key) {
+        return colorCss(currentDisplayTheme_.colors.value(QString::fromLatin1(key)));
+    };
+    const auto fontStyle = [this](const char *key) {
+        return currentDisplayTheme_.fonts.value(QString::fromLatin1(key));
+    };
 
-    if (tabs_ != nullptr) {
-        tabs_->setStyleSheet(
+    if (affected({DisplayThemeKeys::AppFont})) {
+        const QFont appFont = qFontFromDisplayFontStyle(fontStyle(DisplayThemeKeys::AppFont), qApp->font());
+        if (appFont != qApp->font()) {
+            qApp->setFont(appFont);
+        }
+    }
+    if (affected({DisplayThemeKeys::WindowBackground,
+                  DisplayThemeKeys::WindowText,
+                  DisplayThemeKeys::InputBackground,
+                  DisplayThemeKeys::InputText,
+                  DisplayThemeKeys::ButtonBackground,
+                  DisplayThemeKeys::ButtonText,
+                  DisplayThemeKeys::ButtonDisabledText,
+                  DisplayThemeKeys::Accent,
+                  DisplayThemeKeys::Highlight,
+                  DisplayThemeKeys::HighlightText,
+                  DisplayThemeKeys::MutedText})) {
+        const QPalette palette = buildApplicationPalette(currentDisplayTheme_, qApp->palette());
+        if (palette != qApp->palette()) {
+            qApp->setPalette(palette);
+        }
+    }
+    if (affected({DisplayThemeKeys::ScrollbarTrack,
+                  DisplayThemeKeys::ScrollbarThumb,
+                  DisplayThemeKeys::ScrollbarThumbHover,
+                  DisplayThemeKeys::ScrollbarBorder,
+                  DisplayThemeKeys::SliderTrack,
+                  DisplayThemeKeys::SliderFilledTrack,
+                  DisplayThemeKeys::SliderHandle,
+                  DisplayThemeKeys::SliderHandleHover,
+                  DisplayThemeKeys::SliderHandleBorder})) {
+        const QString appStyleSheet =
+            buildScrollBarStyleSheet(currentDisplayTheme_) + buildSliderStyleSheet(currentDisplayTheme_);
+        if (appStyleSheet != qApp->styleSheet()) {
+            qApp->setStyleSheet(appStyleSheet);
+        }
+    }
+
+    if (tabs_ != nullptr
+        && affected({DisplayThemeKeys::WindowBackground,
+                     DisplayThemeKeys::TabBackground,
+                     DisplayThemeKeys::TabText,
+                     DisplayThemeKeys::TabBorder,
+                     DisplayThemeKeys::TabSelectedBackground,
+                     DisplayThemeKeys::TabFont})) {
+        setStyleSheetIfChanged(
+            tabs_,
             QString("QTabWidget::pane { border: 0; background-color: %1; }"
                     "QTabBar::tab { background-color: %2; color: %3; border: 1px solid %4; padding: 8px 14px; %6 }"
                     "QTabBar::tab:selected { background-color: %5; }")
@@ -6490,58 +8045,124 @@ void MainWindow::applyDisplayTheme(bool persistCurrentTheme)
                      color(DisplayThemeKeys::TabText),
                      color(DisplayThemeKeys::TabBorder),
                      color(DisplayThemeKeys::TabSelectedBackground),
-                     tabFontCss));
+                     styleSheetFontFragment(fontStyle(DisplayThemeKeys::TabFont))));
         if (tabs_->tabBar() != nullptr) {
-            tabs_->tabBar()->setFont(qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_,
-                                                                                     DisplayThemeKeys::TabFont),
-                                                               tabs_->tabBar()->font()));
-        }
+            tabs_->tabBar()->setFont(
+                qFontFromDisplayFontStyle(fontStyle(DisplayThemeKeys::TabFont), tabs_->tabBar()->font()));
+        }
+    }
+
+    if (tabs_ != nullptr
+        && affected({DisplayThemeKeys::WindowBackground,
+                     DisplayThemeKeys::WindowText,
+                     DisplayThemeKeys::GroupBorder,
+                     DisplayThemeKeys::ButtonBackground,
+                     DisplayThemeKeys::ButtonText,
+                     DisplayThemeKeys::ButtonBorder,
+                     DisplayThemeKeys::ButtonDisabledText,
+                     DisplayThemeKeys::ButtonDisabledBorder,
+                     DisplayThemeKeys::InputBackground,
+                     DisplayThemeKeys::InputText,
+                     DisplayThemeKeys::InputBorder,
+                     DisplayThemeKeys::Highlight,
+                     DisplayThemeKeys::HighlightText,
+                     DisplayThemeKeys::HeaderBackground,
+                     DisplayThemeKeys::HeaderText,
+                     DisplayThemeKeys::HeaderBorder,
+                     DisplayThemeKeys::LabelText,
+                     DisplayThemeKeys::ButtonFont,
+                     DisplayThemeKeys::CheckBoxIndicatorBackground,
+                     DisplayThemeKeys::CheckBoxIndicatorBorder,
+                     DisplayThemeKeys::CheckBoxIndicatorChecked,
+                     DisplayThemeKeys::ChannelListGridLine})) {
+        const QString mainPageStyle =
+            QString(
+                "QWidget { background-color: %1; color: %2; }"
+                "QGroupBox { border: 1px solid %3; margin-top: 12px; padding-top: 8px; }"
+                "QGroupBox::title { subcontrol-origin: margin; left: 10px; padding: 0 4px; color: %2; }"
+                "QPushButton { background-color: %4; color: %5; border: 1px solid %6; padding: 6px 12px; }"
+                "QPushButton:disabled { color: %7; border-color: %8; }"
+                "QCheckBox { color: %2; spacing: 6px; %18 }"
+                "QCheckBox::indicator { width: 16px; height: 16px; background-color: %19; border: 1px solid %20; }"
+                "QCheckBox::indicator:checked { background-color: %21; border: 1px solid %20; image: none; }"
+                "QCheckBox::indicator:unchecked { background-color: %19; border: 1px solid %20; image: none; }"
+                "QScrollArea, QScrollArea > QWidget > QWidget { background-color: %1; }"
+                "QLineEdit, QComboBox, QListView, QTableView, QSpinBox, QFontComboBox {"
+                " background-color: %9; color: %10; border: 1px solid %11; selection-background-color: %12; selection-color: %13; }"
+                "QTableView#channelListingTable { gridline-color: %22; }"
+                "QHeaderView::section { background-color: %14; color: %15; border: 1px solid %16; padding: 4px; }"
+                "QLabel { color: %17; }"
+                "QToolTip { background-color: %1; color: %2; border: 1px solid %3; }")
+                .arg(color(DisplayThemeKeys::WindowBackground),
+                     color(DisplayThemeKeys::WindowText),
+                     color(DisplayThemeKeys::GroupBorder),
+                     color(DisplayThemeKeys::ButtonBackground),
+                     color(DisplayThemeKeys::ButtonText),
+                     color(DisplayThemeKeys::ButtonBorder),
+                     color(DisplayThemeKeys::ButtonDisabledText),
+                     color(DisplayThemeKeys::ButtonDisabledBorder),
+                     color(DisplayThemeKeys::InputBackground),
+                     color(DisplayThemeKeys::InputText),
+                     color(DisplayThemeKeys::InputBorder),
+                     color(DisplayThemeKeys::Highlight),
+                     color(DisplayThemeKeys::HighlightText),
+                     color(DisplayThemeKeys::HeaderBackground),
+                     color(DisplayThemeKeys::HeaderText),
+                     color(DisplayThemeKeys::HeaderBorder),
+                     color(DisplayThemeKeys::LabelText),
+                     styleSheetFontFragment(fontStyle(DisplayThemeKeys::ButtonFont)),
+                     color(DisplayThemeKeys::CheckBoxIndicatorBackground),
+                     color(DisplayThemeKeys::CheckBoxIndicatorBorder),
+                     color(DisplayThemeKeys::CheckBoxIndicatorChecked),
+                     color(DisplayThemeKeys::ChannelListGridLine));
         for (int index = 0; index < tabs_->count(); ++index) {
             QWidget *page = tabs_->widget(index);
-            if (page != nullptr && page != tvGuideDialog_) {
-                page->setStyleSheet(mainPageStyle);
+            if (page != nullptr && page != tvGuidePage_) {
+                setStyleSheetIfChanged(page, mainPageStyle);
             }
         }
     }
 
-    if (menuBar() != nullptr) {
-        menuBar()->setStyleSheet(QString("QMenuBar, QMenu { background-color: %1; color: %2; }")
-                                     .arg(color(DisplayThemeKeys::MenuBackground), color(DisplayThemeKeys::MenuText)));
-        menuBar()->setFont(qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_,
-                                                                           DisplayThemeKeys::MenuFont),
-                                                     menuBar()->font()));
+    if (menuBar() != nullptr
+        && affected({DisplayThemeKeys::MenuBackground, DisplayThemeKeys::MenuText, DisplayThemeKeys::MenuFont})) {
+        setStyleSheetIfChanged(menuBar(),
+                               QString("QMenuBar, QMenu { background-color: %1; color: %2; }")
+                                   .arg(color(DisplayThemeKeys::MenuBackground), color(DisplayThemeKeys::MenuText)));
+        menuBar()->setFont(qFontFromDisplayFontStyle(fontStyle(DisplayThemeKeys::MenuFont), menuBar()->font()));
     }
 
-    if (statusBar() != nullptr) {
-        statusBar()->setStyleSheet(QString("QStatusBar { background-color: %1; color: %2; }")
-                                       .arg(color(DisplayThemeKeys::StatusBackground),
-                                            color(DisplayThemeKeys::StatusText)));
-        statusBar()->setFont(qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_,
-                                                                             DisplayThemeKeys::StatusFont),
-                                                       statusBar()->font()));
+    if (statusBar() != nullptr
+        && affected({DisplayThemeKeys::StatusBackground, DisplayThemeKeys::StatusText, DisplayThemeKeys::StatusFont})) {
+        setStyleSheetIfChanged(statusBar(),
+                               QString("QStatusBar { background-color: %1; color: %2; }")
+                                   .arg(color(DisplayThemeKeys::StatusBackground),
+                                        color(DisplayThemeKeys::StatusText)));
+        statusBar()->setFont(qFontFromDisplayFontStyle(fontStyle(DisplayThemeKeys::StatusFont), statusBar()->font()));
     }
 
-    if (pipWindow_ != nullptr) {
-        pipWindow_->setStyleSheet(QString("background: %1;").arg(color(DisplayThemeKeys::WindowBackground)));
-    }
-    if (fullscreenWindow_ != nullptr) {
-        fullscreenWindow_->setStyleSheet(QString("background: %1;").arg(color(DisplayThemeKeys::WindowBackground)));
+    if (affected({DisplayThemeKeys::WindowBackground})) {
+        const QString windowStyle = QString("background: %1;").arg(color(DisplayThemeKeys::WindowBackground));
+        setStyleSheetIfChanged(pipWindow_, windowStyle);
+        setStyleSheetIfChanged(fullscreenWindow_, windowStyle);
     }
-    if (videoDetachedPlaceholderLabel_ != nullptr) {
-        videoDetachedPlaceholderLabel_->setStyleSheet(
-            QString("QLabel { background: %1; color: %2; padding: 24px; }")
-                .arg(color(DisplayThemeKeys::WindowBackground), color(DisplayThemeKeys::MutedText)));
-    }
-    if (currentShowSynopsisLabel_ != nullptr) {
-        currentShowSynopsisLabel_->setStyleSheet(
-            QString("QLabel { color: %1; }").arg(color(DisplayThemeKeys::MutedText)));
+    if (affected({DisplayThemeKeys::WindowBackground, DisplayThemeKeys::MutedText})) {
+        setStyleSheetIfChanged(videoDetachedPlaceholderLabel_,
+                               QString("QLabel { background: %1; color: %2; padding: 24px; }")
+                                   .arg(color(DisplayThemeKeys::WindowBackground),
+                                        color(DisplayThemeKeys::MutedText)));
     }
-    if (fullscreenCurrentShowSynopsisLabel_ != nullptr) {
-        fullscreenCurrentShowSynopsisLabel_->setStyleSheet(
-            QString("QLabel { color: %1; }").arg(color(DisplayThemeKeys::MutedText)));
+    if (affected({DisplayThemeKeys::MutedText})) {
+        const QString synopsisStyle = QString("QLabel { color: %1; }").arg(color(DisplayThemeKeys::MutedText));
+        setStyleSheetIfChanged(currentShowSynopsisLabel_, synopsisStyle);
+        setStyleSheetIfChanged(fullscreenCurrentShowSynopsisLabel_, synopsisStyle);
     }
-    if (fullscreenOverlayContainer_ != nullptr) {
-        fullscreenOverlayContainer_->setStyleSheet(
+    if (affected({DisplayThemeKeys::FullscreenOverlayBackground,
+                  DisplayThemeKeys::ButtonBackground,
+                  DisplayThemeKeys::ButtonText,
+                  DisplayThemeKeys::ButtonBorder,
+                  DisplayThemeKeys::FullscreenOverlayText})) {
+        setStyleSheetIfChanged(
+            fullscreenOverlayContainer_,
             QString(
                 "QWidget#fullscreenOverlayContainer { background: %1; }"
                 "QPushButton { min-height: 34px; background-color: %2; color: %3; border: 1px solid %4; padding: 6px 12px; }"
@@ -6553,6 +8174,90 @@ void MainWindow::applyDisplayTheme(bool persistCurrentTheme)
                      color(DisplayThemeKeys::FullscreenOverlayText)));
     }
 
+    QSet<QString> widgetFontRoles;
+    for (const char *roleKey : {DisplayThemeKeys::LabelFont, DisplayThemeKeys::ButtonFont, DisplayThemeKeys::InputFont}) {
+        if (affected({roleKey})) {
+            widgetFontRoles.insert(QString::fromLatin1(roleKey));
+        }
+    }
+    applyDisplayThemeWidgetFonts(this, widgetFontRoles);
+
+    if (logOutput_ != nullptr && affected({DisplayThemeKeys::LogFont})) {
+        logOutput_->setFont(qFontFromDisplayFontStyle(fontStyle(DisplayThemeKeys::LogFont), font()));
+    }
+    if (affected({DisplayThemeKeys::StatusFont, DisplayThemeKeys::LabelFont})) {
+        const QFont statusFont = qFontFromDisplayFontStyle(fontStyle(DisplayThemeKeys::StatusFont), font());
+        for (QLabel *label : {playbackStatusLabel_,
+                              signalMonitorLabel_,
+                              fullscreenPlaybackStatusLabel_,
+                              fullscreenSignalMonitorLabel_}) {
+            if (label != nullptr) {
+                label->setFont(statusFont);
+            }
+        }
+    }
+    // The status and overlay labels were just given the label font, so their own fonts go on again.
+    if (fullscreenOverlayContainer_ != nullptr
+        && affected({DisplayThemeKeys::OverlayFont, DisplayThemeKeys::LabelFont, DisplayThemeKeys::ButtonFont})) {
+        const QFont overlayFont = qFontFromDisplayFontStyle(fontStyle(DisplayThemeKeys::OverlayFont), font());
+        for (QLabel *label : fullscreenOverlayContainer_->findChildren<QLabel *>()) {
+            if (label != nullptr) {
+                label->setFont(overlayFont);
+            }
+        }
+        for (QPushButton *button : fullscreenOverlayContainer_->findChildren<QPushButton *>()) {
+            if (button != nullptr) {
+                button->setFont(overlayFont);
+            }
+        }
+    }
+
+    const bool guideAffected =
+        applyAll
+        || std::any_of(changedRoles.cbegin(), changedRoles.cend(), [](const QString &roleKey) {
+               return roleKey.startsWith(QStringLiteral("guide"));
+           })
+        || anyDisplayThemeRoleChanged(changedRoles,
+                                      {DisplayThemeKeys::ButtonDisabledBorder,
+                                       DisplayThemeKeys::ButtonDisabledText,
+                                       DisplayThemeKeys::InputBackground,
+                                       DisplayThemeKeys::InputText,
+                                       DisplayThemeKeys::LabelFont,
+                                       DisplayThemeKeys::ButtonFont,
+                                       DisplayThemeKeys::InputFont,
+                                       DisplayThemeKeys::TabFont,
+                                       DisplayThemeKeys::LogFont});
+    if (tvGuideDialog_ != nullptr && guideAffected) {
+        tvGuideDialog_->setDisplayTheme(currentDisplayTheme_);
+    }
+
+    if (applyAll || !changedRoles.isEmpty()) {
+        syncConfigGroupBoxHeights();
+    }
+    refreshDisplayThemeControls();
+    if (persistCurrentTheme) {
+        persistDisplayThemeStore("Current theme saved.", false);
+    }
+}
+
+void MainWindow::applyDisplayThemeWidgetFonts(QWidget *root)
+{
+    applyDisplayThemeWidgetFonts(
+        root,
+        {QString::fromLatin1(DisplayThemeKeys::LabelFont),
+         QString::fromLatin1(DisplayThemeKeys::ButtonFont),
+         QString::fromLatin1(DisplayThemeKeys::InputFont)});
+}
+
+void MainWindow::applyDisplayThemeWidgetFonts(QWidget *root, const QSet<QString> &fontRoles)
+{
+    if (root == nullptr || fontRoles.isEmpty()) {
+        return;
+    }
+
+    const bool applyLabelFont = fontRoles.contains(DisplayThemeKeys::LabelFont);
+    const bool applyButtonFont = fontRoles.contains(DisplayThemeKeys::ButtonFont);
+    const bool applyInputFont = fontRoles.contains(DisplayThemeKeys::InputFont);
     const QFont labelFont =
         qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_, DisplayThemeKeys::LabelFont),
                                   font());
@@ -6562,108 +8267,74 @@ void MainWindow::applyDisplayTheme(bool persistCurrentTheme)
     const QFont inputFont =
         qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_, DisplayThemeKeys::InputFont),
                                   font());
-    const QFont logFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_, DisplayThemeKeys::LogFont), font());
-    const QFont overlayFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_, DisplayThemeKeys::OverlayFont),
-                                  font());
-    const QFont statusFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme_, DisplayThemeKeys::StatusFont),
-                                  font());
 
-    for (QLabel *label : findChildren<QLabel *>()) {
-        if (label != nullptr) {
-            label->setFont(labelFont);
+    if (applyLabelFont) {
+        for (QLabel *label : root->findChildren<QLabel *>()) {
+            if (label != nullptr) {
+                label->setFont(labelFont);
+            }
         }
-    }
-    for (QGroupBox *groupBox : findChildren<QGroupBox *>()) {
-        if (groupBox != nullptr) {
-            groupBox->setFont(labelFont);
+        for (QGroupBox *groupBox : root->findChildren<QGroupBox *>()) {
+            if (groupBox != nullptr) {
+                groupBox->setFont(labelFont);
+            }
         }
     }
-    for (QPushButton *button : findChildren<QPushButton *>()) {
-        if (button != nullptr) {
-            button->setFont(buttonFont);
+    if (applyButtonFont) {
+        for (QPushButton *button : root->findChildren<QPushButton *>()) {
+            if (button != nullptr) {
+                button->setFont(buttonFont);
+            }
         }
-    }
-    for (QCheckBox *checkBox : findChildren<QCheckBox *>()) {
-        if (checkBox != nullptr) {
-            checkBox->setFont(buttonFont);
+        for (QCheckBox *checkBox : root->findChildren<QCheckBox *>()) {
+            if (checkBox != nullptr) {
+                checkBox->setFont(buttonFont);
+            }
         }
     }
-    for (QLineEdit *lineEdit : findChildren<QLineEdit *>()) {
-        if (lineEdit != nullptr) {
-            lineEdit->setFont(inputFont);
+    if (applyInputFont) {
+        for (QLineEdit *lineEdit : root->findChildren<QLineEdit *>()) {
+            if (lineEdit != nullptr) {
+                lineEdit->setFont(inputFont);
+            }
         }
-    }
-    for (QComboBox *comboBox : findChildren<QComboBox *>()) {
-        if (comboBox != nullptr) {
-            comboBox->setFont(inputFont);
+        for (QComboBox *comboBox : root->findChildren<QComboBox *>()) {
+            if (comboBox != nullptr) {
+                comboBox->setFont(inputFont);
+            }
         }
-    }
-    for (QFontComboBox *fontComboBox : findChildren<QFontComboBox *>()) {
-        if (fontComboBox != nullptr) {
-            fontComboBox->setFont(inputFont);
+        for (QFontComboBox *fontComboBox : root->findChildren<QFontComboBox *>()) {
+            if (fontComboBox != nullptr) {
+                fontComboBox->setFont(inputFont);
+            }
         }
-    }
-    for (QSpinBox *spinBox : findChildren<QSpinBox *>()) {
-        if (spinBox != nullptr) {
-            spinBox->setFont(inputFont);
+        for (QSpinBox *spinBox : root->findChildren<QSpinBox *>()) {
+            if (spinBox != nullptr) {
+                spinBox->setFont(inputFont);
+            }
         }
-    }
-    for (QListWidget *listWidget : findChildren<QListWidget *>()) {
-        if (listWidget != nullptr) {
-            listWidget->setFont(inputFont);
+        for (QListWidget *listWidget : root->findChildren<QListWidget *>()) {
+            if (listWidget != nullptr) {
+                listWidget->setFont(inputFont);
+            }
         }
     }
-    for (QTableWidget *tableWidget : findChildren<QTableWidget *>()) {
-        if (tableWidget != nullptr) {
-            tableWidget->setFont(inputFont);
-            if (tableWidget->horizontalHeader() != nullptr) {
-                tableWidget->horizontalHeader()->setFont(labelFont);
+    if (applyLabelFont || applyInputFont) {
+        for (QTableView *tableView : root->findChildren<QTableView *>()) {
+            if (tableView == nullptr) {
+                continue;
             }
-            if (tableWidget->verticalHeader() != nullptr) {
-                tableWidget->verticalHeader()->setFont(labelFont);
+            if (applyInputFont) {
+                tableView->setFont(inputFont);
             }
-        }
-    }
-    if (logOutput_ != nullptr) {
-        logOutput_->setFont(logFont);
-    }
-    if (playbackStatusLabel_ != nullptr) {
-        playbackStatusLabel_->setFont(statusFont);
-    }
-    if (signalMonitorLabel_ != nullptr) {
-        signalMonitorLabel_->setFont(statusFont);
-    }
-    if (fullscreenPlaybackStatusLabel_ != nullptr) {
-        fullscreenPlaybackStatusLabel_->setFont(statusFont);
-    }
-    if (fullscreenSignalMonitorLabel_ != nullptr) {
-        fullscreenSignalMonitorLabel_->setFont(statusFont);
-    }
-    if (fullscreenOverlayContainer_ != nullptr) {
-        for (QLabel *label : fullscreenOverlayContainer_->findChildren<QLabel *>()) {
-            if (label != nullptr) {
-                label->setFont(overlayFont);
+            if (applyLabelFont && tableView->horizontalHeader() != nullptr) {
+                tableView->horizontalHeader()->setFont(labelFont);
             }
-        }
-        for (QPushButton *button : fullscreenOverlayContainer_->findChildren<QPushButton *>()) {
-            if (button != nullptr) {
-                button->setFont(overlayFont);
+            if (applyLabelFont && tableView->verticalHeader() != nullptr) {
+                tableView->verticalHeader()->setFont(labelFont);
             }
         }
     }
-
-    if (tvGuideDialog_ != nullptr) {
-        tvGuideDialog_->setDisplayTheme(currentDisplayTheme_);
-    }
-
-    syncConfigGroupBoxHeights();
-    refreshDisplayThemeControls();
-    if (persistCurrentTheme) {
-        persistDisplayThemeStore("Current theme saved.", false);
-    }
 }
 
 void MainWindow::chooseDisplayThemeColor(const QString &roleKey)
@@ -6942,8 +8613,9 @@ void MainWindow::handleGuideCacheRetentionChanged(int)
     QSettings settings("tv_tuner_gui", "watcher");
     settings.setValue(kGuideCacheRetentionHoursSetting, hours);
     setStatusBarStateMessage("Cleaning up TV Guide cache");
-    const bool removed = purgeExpiredGuideCacheFiles(true, true);
+    const bool removedExports = purgeExpiredSchedulesDirectExports();
     loadGuideCacheFile();
+    const bool removed = removedExports || guideCachePruneWriteTimer_->isActive();
     applyCurrentShowStatusFromGuideCache();
     updateTvGuideDialogFromCurrentCache(false);
     setStatusBarStateMessage(removed ? "TV Guide cache cleaned up"
@@ -6997,21 +8669,26 @@ bool MainWindow::maybeRefreshGuideWhenCacheRunsOut(bool updateDialog)
     }
 
     appendLog("guide-bg: cached guide no longer covers current time; refreshing.");
-    if (!refreshGuideData(false, updateDialog)) {
-        guideCacheRunoutRefreshRetryUtc_ = nowUtc.addSecs(kGuideRunoutRefreshRetryMinutes * 60);
-        appendLog(QString("guide-bg: runout refresh failed; retry after %1")
-                      .arg(guideRefreshDateTimeText(guideCacheRunoutRefreshRetryUtc_.toLocalTime())));
-        setStatusBarStateMessage(lastStatusBarMessage_);
-        return false;
-    }
+    // A Schedules Direct refresh finishes later; the retry time is set from its outcome so a failed download
+    // is not started again on every poll.
+    refreshGuideData(false, updateDialog, [this, updateDialog](bool refreshed) {
+        if (!refreshed) {
+            guideCacheRunoutRefreshRetryUtc_ =
+                QDateTime::currentDateTimeUtc().addSecs(kGuideRunoutRefreshRetryMinutes * 60);
+            appendLog(QString("guide-bg: runout refresh failed; retry after %1")
+                          .arg(guideRefreshDateTimeText(guideCacheRunoutRefreshRetryUtc_.toLocalTime())));
+            setStatusBarStateMessage(lastStatusBarMessage_);
+            return;
+        }
 
-    guideCacheRunoutRefreshRetryUtc_ = QDateTime();
-    loadGuideCacheFile();
-    applyCurrentShowStatusFromGuideCache();
-    if (updateDialog) {
-        updateTvGuideDialogFromCurrentCache(false);
-    }
-    setStatusBarStateMessage(lastStatusBarMessage_);
+        guideCacheRunoutRefreshRetryUtc_ = QDateTime();
+        loadGuideCacheFile();
+        applyCurrentShowStatusFromGuideCache();
+        if (updateDialog) {
+            updateTvGuideDialogFromCurrentCache(false);
+        }
+        setStatusBarStateMessage(lastStatusBarMessage_);
+    });
     return true;
 }
 
@@ -7064,19 +8741,26 @@ void MainWindow::updateSchedulesDirectControls()
     }
 }
 
-bool MainWindow::ensureSchedulesDirectJson(bool allowCachedExport,
-                                           bool *usedCachedExport,
-                                           QString *summary,
-                                           QString *errorText)
+void MainWindow::setSchedulesDirectSyncStatus(const QString &text, const QString &statusBarText)
 {
-    if (usedCachedExport != nullptr) {
-        *usedCachedExport = false;
-    }
-    if (summary != nullptr) {
-        summary->clear();
+    if (schedulesDirectStatusLabel_ != nullptr) {
+        schedulesDirectStatusLabel_->setText(text);
     }
-    if (errorText != nullptr) {
-        errorText->clear();
+    syncConfigGroupBoxHeights();
+    setStatusBarStateMessage(statusBarText.isEmpty() ? text : statusBarText);
+}
+
+void MainWindow::startSchedulesDirectSync(bool allowCachedExport, SchedulesDirectSyncCallback onFinished)
+{
+    // The UI stays live while a download runs, so guide polls or the export button can ask for a second one.
+    if (schedulesDirectSync_ != nullptr) {
+        SchedulesDirectSyncResult result;
+        result.errorText = "A Schedules Direct download is already in progress.";
+        appendLog(QString("schedules-direct: %1").arg(result.errorText));
+        if (onFinished) {
+            onFinished(result);
+        }
+        return;
     }
 
     QSettings settings("tv_tuner_gui", "watcher");
@@ -7089,12 +8773,6 @@ bool MainWindow::ensureSchedulesDirectJson(bool allowCachedExport,
     QString passwordInput = schedulesDirectPasswordEdit_ != nullptr
                                 ? schedulesDirectPasswordEdit_->text().trimmed()
                                 : settings.value(kSchedulesDirectPasswordSha1Setting).toString().trimmed();
-    const auto setSchedulesDirectStatusText = [this](const QString &text) {
-        if (schedulesDirectStatusLabel_ != nullptr) {
-            schedulesDirectStatusLabel_->setText(text);
-        }
-        syncConfigGroupBoxHeights();
-    };
     const QString exportPath = resolveSchedulesDirectExportPath();
     const QString legacyExportPath = resolveLegacySchedulesDirectExportPath();
     const QString cachedExportPath = QFileInfo::exists(exportPath)
@@ -7105,57 +8783,50 @@ bool MainWindow::ensureSchedulesDirectJson(bool allowCachedExport,
     const bool cachedExportLooksCurrent =
         !cachedExportPath.isEmpty() && guideJsonFileLooksCurrent(cachedExportPath, nowUtc, retentionHours);
 
-    const auto finishWithCachedExport = [&](const QString &reason) {
-        if (usedCachedExport != nullptr) {
-            *usedCachedExport = true;
-        }
-        const QString message = QString("%1 Using cached Schedules Direct JSON from %2.")
-                                    .arg(reason.trimmed(), cachedExportPath);
-        if (summary != nullptr) {
-            *summary = message;
-        }
-        appendLog(QString("schedules-direct: %1").arg(message));
-        setSchedulesDirectStatusText("Using cached Schedules Direct OTA JSON.");
-        setStatusBarStateMessage("Using cached Schedules Direct JSON");
-        return true;
-    };
+    schedulesDirectSync_ = std::make_unique<SchedulesDirectSync>();
+    SchedulesDirectSync &sync = *schedulesDirectSync_;
+    sync.onFinished = std::move(onFinished);
+    sync.allowCachedExport = allowCachedExport;
+    sync.username = username;
+    sync.postalCode = postalCode;
+    sync.exportPath = exportPath;
+    sync.cachedExportPath = cachedExportPath;
+    sync.retentionHours = retentionHours;
 
     if (username.isEmpty() || passwordInput.isEmpty() || postalCode.isEmpty()) {
         if (allowCachedExport && cachedExportLooksCurrent) {
-            return finishWithCachedExport("Schedules Direct credentials are incomplete.");
-        }
-        const QString message = !cachedExportPath.isEmpty()
-                                    ? "Cached Schedules Direct JSON is stale. Enter your username, password, and ZIP/postal code to refresh it."
-                                    : "Enter your Schedules Direct username, password, and ZIP/postal code first.";
-        if (errorText != nullptr) {
-            *errorText = message;
+            completeSchedulesDirectSync(cachedSchedulesDirectExportResult("Schedules Direct credentials are incomplete."));
+            return;
         }
-        appendLog(QString("schedules-direct: %1").arg(message));
-        setSchedulesDirectStatusText("Enter Schedules Direct username, password, and ZIP first.");
-        setStatusBarStateMessage("Schedules Direct download not configured");
-        return false;
+        SchedulesDirectSyncResult result;
+        result.errorText = !cachedExportPath.isEmpty()
+                               ? "Cached Schedules Direct JSON is stale. Enter your username, password, and ZIP/postal code to refresh it."
+                               : "Enter your Schedules Direct username, password, and ZIP/postal code first.";
+        appendLog(QString("schedules-direct: %1").arg(result.errorText));
+        setSchedulesDirectSyncStatus("Enter Schedules Direct username, password, and ZIP first.",
+                                     "Schedules Direct download not configured");
+        completeSchedulesDirectSync(result);
+        return;
     }
 
     if (exportPath.isEmpty()) {
-        const QString message = "Could not resolve the app data folder for schedules_direct.org.json.";
-        if (errorText != nullptr) {
-            *errorText = message;
-        }
-        setSchedulesDirectStatusText("Could not resolve the Schedules Direct export folder. See Logs.");
-        setStatusBarStateMessage("Schedules Direct download failed");
-        return false;
+        SchedulesDirectSyncResult result;
+        result.errorText = "Could not resolve the app data folder for schedules_direct.org.json.";
+        setSchedulesDirectSyncStatus("Could not resolve the Schedules Direct export folder. See Logs.",
+                                     "Schedules Direct download failed");
+        completeSchedulesDirectSync(result);
+        return;
     }
 
     QFileInfo exportInfo(exportPath);
     QDir exportDir = exportInfo.dir();
     if (!exportDir.exists() && !exportDir.mkpath(".")) {
-        const QString message = QString("Could not create the export folder for %1.").arg(exportPath);
-        if (errorText != nullptr) {
-            *errorText = message;
-        }
-        setSchedulesDirectStatusText("Could not create the Schedules Direct export folder. See Logs.");
-        setStatusBarStateMessage("Schedules Direct download failed");
-        return false;
+        SchedulesDirectSyncResult result;
+        result.errorText = QString("Could not create the export folder for %1.").arg(exportPath);
+        setSchedulesDirectSyncStatus("Could not create the Schedules Direct export folder. See Logs.",
+                                     "Schedules Direct download failed");
+        completeSchedulesDirectSync(result);
+        return;
     }
 
     QString passwordSha1 = passwordInput;
@@ -7167,14 +8838,7 @@ bool MainWindow::ensureSchedulesDirectJson(bool allowCachedExport,
     settings.setValue(kSchedulesDirectPasswordSha1Setting, passwordSha1);
     settings.setValue(kSchedulesDirectPostalCodeSetting, postalCode);
 
-    const auto updateStatus = [this, &setSchedulesDirectStatusText](const QString &text,
-                                                                    const QString &statusBarText = QString()) {
-        setSchedulesDirectStatusText(text);
-        setStatusBarStateMessage(statusBarText.isEmpty() ? text : statusBarText);
-        QCoreApplication::processEvents(QEventLoop::AllEvents, 50);
-    };
-
-    updateStatus("Connecting to Schedules Direct...", "Schedules Direct download in progress");
+    setSchedulesDirectSyncStatus("Connecting to Schedules Direct...", "Schedules Direct download in progress");
     logInteraction("program",
                    "schedules-direct.export.start",
                    QString("username=%1 postal=%2 source=%3")
@@ -7183,413 +8847,591 @@ bool MainWindow::ensureSchedulesDirectJson(bool allowCachedExport,
                             useSchedulesDirectGuideSource() ? "guide-timer" : "manual"));
 
     const QString userAgent = QString("tv_tuner_gui/%1").arg(QStringLiteral(TV_TUNER_GUI_VERSION));
-    QNetworkAccessManager networkManager;
-
-    const auto failExport = [&](const QString &failureSummary, const QString &details) {
-        QString message = failureSummary.trimmed();
-        if (!details.trimmed().isEmpty()) {
-            message += QString(" %1").arg(details.trimmed());
-        }
-        message.replace('\n', ' ');
-        appendLog(QString("schedules-direct: %1").arg(message));
-        logInteraction("program",
-                       "schedules-direct.export.failed",
-                       message);
-        if (allowCachedExport && !cachedExportPath.isEmpty()) {
-            return finishWithCachedExport(message);
-        }
-        setSchedulesDirectStatusText("Schedules Direct export failed. See Logs.");
-        if (errorText != nullptr) {
-            *errorText = message;
-        }
-        setStatusBarStateMessage("Schedules Direct export failed");
-        return false;
-    };
+    sync.client = new SchedulesDirectClient(userAgent, this);
+    sync.client->setMaxConcurrentRequests(
+        std::clamp(settings.value(kSchedulesDirectConcurrentRequestsSetting, kSchedulesDirectDefaultConcurrentRequests)
+                       .toInt(),
+                   1,
+                   kSchedulesDirectMaxConcurrentRequests));
+    connect(sync.client,
+            &SchedulesDirectClient::progress,
+            this,
+            [this](int finishedRequests, int totalRequests, qint64 bytesReceived) {
+                setStatusBarStateMessage(QString("Schedules Direct download in progress (%1/%2 requests, %3 KiB)")
+                                             .arg(finishedRequests)
+                                             .arg(totalRequests)
+                                             .arg((bytesReceived + 1023) / 1024));
+            });
 
     QJsonObject tokenRequestBody;
     tokenRequestBody.insert("username", username);
     tokenRequestBody.insert("password", passwordSha1);
-    const JsonRequestResult tokenResult =
-        performJsonRequest(networkManager,
-                           userAgent,
-                           QUrl("https://json.schedulesdirect.org/20141201/token"),
-                           QString(),
-                           QJsonDocument(tokenRequestBody));
-    if (!tokenResult.ok() || !tokenResult.document.isObject()) {
-        return failExport("Schedules Direct login failed.", tokenResult.errorText);
-    }
-
-    const QJsonObject tokenObject = tokenResult.document.object();
-    const QString token = tokenObject.value("token").toString().trimmed();
-    if (token.isEmpty()) {
-        return failExport("Schedules Direct login failed.", "The token response did not include a usable token.");
-    }
-
-    updateStatus("Fetching account status...");
-
-    const JsonRequestResult statusResult =
-        performJsonRequest(networkManager,
-                           userAgent,
-                           QUrl("https://json.schedulesdirect.org/20141201/status"),
-                           token);
-    if (!statusResult.ok() || !statusResult.document.isObject()) {
-        return failExport("Schedules Direct status lookup failed.", statusResult.errorText);
-    }
+    sync.client->enqueue({schedulesDirectApiUrl("/token"), QJsonDocument(tokenRequestBody)},
+                         [this](const SchedulesDirectClient::Reply &tokenResult) {
+                             if (schedulesDirectSync_ == nullptr) {
+                                 return;
+                             }
+                             if (!tokenResult.ok() || !tokenResult.document.isObject()) {
+                                 failSchedulesDirectSync("Schedules Direct login failed.", tokenResult.errorText);
+                                 return;
+                             }
+
+                             const QJsonObject tokenObject = tokenResult.document.object();
+                             const QString token = tokenObject.value("token").toString().trimmed();
+                             if (token.isEmpty()) {
+                                 failSchedulesDirectSync("Schedules Direct login failed.",
+                                                         "The token response did not include a usable token.");
+                                 return;
+                             }
+                             schedulesDirectSync_->tokenObject = tokenObject;
+                             schedulesDirectSync_->client->setToken(token);
+                             fetchSchedulesDirectAccountStatus();
+                         });
+}
+
+void MainWindow::fetchSchedulesDirectAccountStatus()
+{
+    setSchedulesDirectSyncStatus("Fetching account status...");
+    schedulesDirectSync_->client->enqueue(
+        {schedulesDirectApiUrl("/status")},
+        [this](const SchedulesDirectClient::Reply &statusResult) {
+            if (schedulesDirectSync_ == nullptr) {
+                return;
+            }
+            if (!statusResult.ok() || !statusResult.document.isObject()) {
+                failSchedulesDirectSync("Schedules Direct status lookup failed.", statusResult.errorText);
+                return;
+            }
+            schedulesDirectSync_->statusObject = statusResult.document.object();
+            fetchSchedulesDirectHeadends();
+        });
+}
 
-    updateStatus(QString("Fetching headends for %1...").arg(postalCode));
+void MainWindow::fetchSchedulesDirectHeadends()
+{
+    const QString postalCode = schedulesDirectSync_->postalCode;
+    setSchedulesDirectSyncStatus(QString("Fetching headends for %1...").arg(postalCode));
 
-    QUrl headendsUrl("https://json.schedulesdirect.org/20141201/headends");
+    QUrl headendsUrl = schedulesDirectApiUrl("/headends");
     QUrlQuery headendsQuery;
     headendsQuery.addQueryItem("country", "USA");
     headendsQuery.addQueryItem("postalcode", postalCode);
     headendsUrl.setQuery(headendsQuery);
-    const JsonRequestResult headendsResult =
-        performJsonRequest(networkManager,
-                           userAgent,
-                           headendsUrl,
-                           token);
-    if (!headendsResult.ok() || !headendsResult.document.isArray()) {
-        return failExport("Schedules Direct headend lookup failed.", headendsResult.errorText);
-    }
+    schedulesDirectSync_->client->enqueue(
+        {headendsUrl},
+        [this, postalCode](const SchedulesDirectClient::Reply &headendsResult) {
+            if (schedulesDirectSync_ == nullptr) {
+                return;
+            }
+            if (!headendsResult.ok() || !headendsResult.document.isArray()) {
+                failSchedulesDirectSync("Schedules Direct headend lookup failed.", headendsResult.errorText);
+                return;
+            }
 
-    const QJsonArray headends = headendsResult.document.array();
-    QJsonArray otaHeadends;
-    QStringList otaLineupIds;
-    for (const QJsonValue &value : headends) {
-        if (!value.isObject()) {
-            continue;
-        }
+            SchedulesDirectSync &sync = *schedulesDirectSync_;
+            const QJsonArray headends = headendsResult.document.array();
+            for (const QJsonValue &value : headends) {
+                if (!value.isObject()) {
+                    continue;
+                }
 
-        const QJsonObject headend = value.toObject();
-        if (headend.value("transport").toString().trimmed().compare("Antenna", Qt::CaseInsensitive) != 0) {
-            continue;
-        }
+                const QJsonObject headend = value.toObject();
+                if (headend.value("transport").toString().trimmed().compare("Antenna", Qt::CaseInsensitive) != 0) {
+                    continue;
+                }
+
+                sync.otaHeadends.append(headend);
+                const QJsonArray lineups = headend.value("lineups").toArray();
+                for (const QJsonValue &lineupValue : lineups) {
+                    const QString lineupId = lineupValue.toObject().value("lineup").toString().trimmed();
+                    if (!lineupId.isEmpty() && !sync.otaLineupIds.contains(lineupId)) {
+                        sync.otaLineupIds.append(lineupId);
+                    }
+                }
+            }
+            if (sync.otaLineupIds.isEmpty()) {
+                failSchedulesDirectSync(QString("No OTA lineup was found for %1.").arg(postalCode),
+                                        "Schedules Direct returned no Antenna lineups for the current ZIP/postal code.");
+                return;
+            }
 
-        otaHeadends.append(headend);
-        const QJsonArray lineups = headend.value("lineups").toArray();
-        for (const QJsonValue &lineupValue : lineups) {
-            const QString lineupId = lineupValue.toObject().value("lineup").toString().trimmed();
-            if (!lineupId.isEmpty() && !otaLineupIds.contains(lineupId)) {
-                otaLineupIds.append(lineupId);
+            const QJsonArray statusLineups = sync.statusObject.value("lineups").toArray();
+            for (const QJsonValue &value : statusLineups) {
+                const QString lineupId = value.toObject().value("lineup").toString().trimmed();
+                if (!lineupId.isEmpty()) {
+                    sync.accountLineupIds.insert(lineupId);
+                }
             }
-        }
-    }
-    if (otaLineupIds.isEmpty()) {
-        return failExport(QString("No OTA lineup was found for %1.").arg(postalCode),
-                          "Schedules Direct returned no Antenna lineups for the current ZIP/postal code.");
+
+            sync.rawDumpPath = requestedSchedulesDirectRawDumpPath();
+            sync.syncCachePath = resolveSchedulesDirectSyncCachePath();
+            loadSchedulesDirectSyncCache(sync.syncCachePath, &sync.syncCache);
+            syncNextSchedulesDirectLineup();
+        });
+}
+
+void MainWindow::syncNextSchedulesDirectLineup()
+{
+    SchedulesDirectSync &sync = *schedulesDirectSync_;
+    if (sync.lineupIndex >= sync.otaLineupIds.size()) {
+        finishSchedulesDirectSync();
+        return;
     }
 
-    QSet<QString> accountLineupIds;
-    const QJsonArray statusLineups = statusResult.document.object().value("lineups").toArray();
-    for (const QJsonValue &value : statusLineups) {
-        const QString lineupId = value.toObject().value("lineup").toString().trimmed();
-        if (!lineupId.isEmpty()) {
-            accountLineupIds.insert(lineupId);
-        }
+    sync.lineup = SchedulesDirectSync::Lineup();
+    sync.lineup.id = sync.otaLineupIds.at(sync.lineupIndex);
+    sync.lineup.url =
+        schedulesDirectApiUrl(QString("/lineups/%1").arg(QString::fromUtf8(QUrl::toPercentEncoding(sync.lineup.id))));
+    if (sync.accountLineupIds.contains(sync.lineup.id)) {
+        fetchSchedulesDirectLineup();
+        return;
     }
 
-    QJsonArray addedLineups;
-    QJsonArray exportedLineups;
-    int totalChannels = 0;
-    int totalScheduleEntries = 0;
-    int totalResolvedPrograms = 0;
-
-    constexpr int kSchedulesDirectTimeoutMs = 120000;
-    constexpr int kProgramChunkSize = 500;
-
-    for (int index = 0; index < otaLineupIds.size(); ++index) {
-        const QString &lineupId = otaLineupIds.at(index);
-        const QString encodedLineupId = QString::fromUtf8(QUrl::toPercentEncoding(lineupId));
-
-        if (!accountLineupIds.contains(lineupId)) {
-            updateStatus(QString("Adding OTA lineup %1/%2...")
-                             .arg(index + 1)
-                             .arg(otaLineupIds.size()));
-
-            const JsonRequestResult addLineupResult =
-                performJsonRequest(networkManager,
-                                   userAgent,
-                                   QUrl(QString("https://json.schedulesdirect.org/20141201/lineups/%1")
-                                            .arg(encodedLineupId)),
-                                   token,
-                                   QJsonDocument(),
-                                   "PUT",
-                                   kSchedulesDirectTimeoutMs);
+    setSchedulesDirectSyncStatus(QString("Adding OTA lineup %1/%2...")
+                                     .arg(sync.lineupIndex + 1)
+                                     .arg(sync.otaLineupIds.size()));
+    sync.client->enqueue(
+        {sync.lineup.url, QJsonDocument(), "PUT", kSchedulesDirectRequestTimeoutMs},
+        [this](const SchedulesDirectClient::Reply &addLineupResult) {
+            if (schedulesDirectSync_ == nullptr) {
+                return;
+            }
+            SchedulesDirectSync &sync = *schedulesDirectSync_;
             if (!addLineupResult.ok() || !addLineupResult.document.isObject()) {
-                return failExport(QString("Could not add OTA lineup %1 to the Schedules Direct account.").arg(lineupId),
-                                  addLineupResult.errorText);
+                failSchedulesDirectSync(
+                    QString("Could not add OTA lineup %1 to the Schedules Direct account.").arg(sync.lineup.id),
+                    addLineupResult.errorText);
+                return;
             }
 
-            addedLineups.append(addLineupResult.document.object());
-            accountLineupIds.insert(lineupId);
-        }
-
-        updateStatus(QString("Fetching OTA lineup %1/%2...")
-                         .arg(index + 1)
-                         .arg(otaLineupIds.size()));
-
-        const JsonRequestResult lineupResult =
-            performJsonRequest(networkManager,
-                               userAgent,
-                               QUrl(QString("https://json.schedulesdirect.org/20141201/lineups/%1")
-                                        .arg(encodedLineupId)),
-                               token,
-                               QJsonDocument(),
-                               QByteArray(),
-                               kSchedulesDirectTimeoutMs);
-        if (!lineupResult.ok() || !lineupResult.document.isObject()) {
-            return failExport(QString("Could not fetch OTA lineup %1.").arg(lineupId), lineupResult.errorText);
-        }
+            sync.addedLineups.append(addLineupResult.document.object());
+            sync.accountLineupIds.insert(sync.lineup.id);
+            fetchSchedulesDirectLineup();
+        });
+}
 
-        const QJsonObject lineupObject = lineupResult.document.object();
-        const QJsonArray stationMap = lineupObject.value("map").toArray();
-        const QJsonArray stations = lineupObject.value("stations").toArray();
-        if (stationMap.isEmpty()) {
-            return failExport(QString("OTA lineup %1 returned no channel map.").arg(lineupId),
-                              "The lineup request succeeded but did not include any mapped OTA stations.");
-        }
+void MainWindow::fetchSchedulesDirectLineup()
+{
+    SchedulesDirectSync &sync = *schedulesDirectSync_;
+    setSchedulesDirectSyncStatus(QString("Fetching OTA lineup %1/%2...")
+                                     .arg(sync.lineupIndex + 1)
+                                     .arg(sync.otaLineupIds.size()));
+    sync.client->enqueue(
+        {sync.lineup.url, QJsonDocument(), QByteArray(), kSchedulesDirectRequestTimeoutMs},
+        [this](const SchedulesDirectClient::Reply &lineupResult) {
+            if (schedulesDirectSync_ == nullptr) {
+                return;
+            }
+            SchedulesDirectSync::Lineup &lineup = schedulesDirectSync_->lineup;
+            if (!lineupResult.ok() || !lineupResult.document.isObject()) {
+                failSchedulesDirectSync(QString("Could not fetch OTA lineup %1.").arg(lineup.id),
+                                        lineupResult.errorText);
+                return;
+            }
 
-        QHash<QString, QJsonObject> stationById;
-        for (const QJsonValue &stationValue : stations) {
-            const QJsonObject stationObject = stationValue.toObject();
-            const QString stationId = stationObject.value("stationID").toString().trimmed();
-            if (!stationId.isEmpty()) {
-                stationById.insert(stationId, stationObject);
+            lineup.object = lineupResult.document.object();
+            const QJsonArray stationMap = lineup.object.value("map").toArray();
+            const QJsonArray stations = lineup.object.value("stations").toArray();
+            if (stationMap.isEmpty()) {
+                failSchedulesDirectSync(QString("OTA lineup %1 returned no channel map.").arg(lineup.id),
+                                        "The lineup request succeeded but did not include any mapped OTA stations.");
+                return;
             }
-        }
 
-        QSet<QString> stationIdSet;
-        QJsonArray schedulesRequestArray;
-        for (const QJsonValue &mapValue : stationMap) {
-            const QString stationId = mapValue.toObject().value("stationID").toString().trimmed();
-            if (stationId.isEmpty() || stationIdSet.contains(stationId)) {
-                continue;
+            for (const QJsonValue &stationValue : stations) {
+                const QJsonObject stationObject = stationValue.toObject();
+                const QString stationId = stationObject.value("stationID").toString().trimmed();
+                if (!stationId.isEmpty()) {
+                    lineup.stationById.insert(stationId, stationObject);
+                }
             }
-            stationIdSet.insert(stationId);
-            QJsonObject scheduleRequestObject;
-            scheduleRequestObject.insert("stationID", stationId);
-            schedulesRequestArray.append(scheduleRequestObject);
-        }
 
-        updateStatus(QString("Fetching OTA schedules %1/%2...")
-                         .arg(index + 1)
-                         .arg(otaLineupIds.size()));
+            for (const QJsonValue &mapValue : stationMap) {
+                const QString stationId = mapValue.toObject().value("stationID").toString().trimmed();
+                if (stationId.isEmpty() || lineup.stationIdSet.contains(stationId)) {
+                    continue;
+                }
+                lineup.stationIdSet.insert(stationId);
+                QJsonObject scheduleRequestObject;
+                scheduleRequestObject.insert("stationID", stationId);
+                lineup.schedulesRequestArray.append(scheduleRequestObject);
+            }
+            fetchSchedulesDirectScheduleMd5s();
+        });
+}
 
-        const JsonRequestResult schedulesResult =
-            performJsonRequest(networkManager,
-                               userAgent,
-                               QUrl("https://json.schedulesdirect.org/20141201/schedules"),
-                               token,
-                               QJsonDocument(schedulesRequestArray),
-                               QByteArray(),
-                               kSchedulesDirectTimeoutMs);
-        if (!schedulesResult.ok() || !schedulesResult.document.isArray()) {
-            return failExport(QString("Could not fetch OTA schedules for %1.").arg(lineupId),
-                              schedulesResult.errorText);
-        }
+void MainWindow::fetchSchedulesDirectScheduleMd5s()
+{
+    SchedulesDirectSync &sync = *schedulesDirectSync_;
+    setSchedulesDirectSyncStatus(QString("Checking OTA schedules %1/%2...")
+                                     .arg(sync.lineupIndex + 1)
+                                     .arg(sync.otaLineupIds.size()));
 
-        const QJsonArray scheduleDays = schedulesResult.document.array();
-        QHash<QString, QJsonArray> scheduleDaysByStation;
-        QStringList uniqueProgramIds;
-        QSet<QString> seenProgramIds;
-        int lineupScheduleEntries = 0;
-        for (const QJsonValue &scheduleDayValue : scheduleDays) {
-            if (!scheduleDayValue.isObject()) {
-                continue;
+    // Station-days whose MD5 matches the cached copy are reused. Stations without MD5s are fetched in full.
+    sync.client->enqueue(
+        {schedulesDirectApiUrl("/schedules/md5"),
+         QJsonDocument(sync.lineup.schedulesRequestArray),
+         QByteArray(),
+         kSchedulesDirectRequestTimeoutMs},
+        [this](const SchedulesDirectClient::Reply &md5Result) {
+            if (schedulesDirectSync_ == nullptr) {
+                return;
             }
-
-            const QJsonObject scheduleDayObject = scheduleDayValue.toObject();
-            const QString stationId = scheduleDayObject.value("stationID").toString().trimmed();
-            if (stationId.isEmpty()) {
-                continue;
+            SchedulesDirectSync &sync = *schedulesDirectSync_;
+            SchedulesDirectSync::Lineup &lineup = sync.lineup;
+            sync.syncDownloadedBytes += md5Result.body.size();
+            if (md5Result.ok() && md5Result.document.isObject()) {
+                const QJsonObject md5Object = md5Result.document.object();
+                for (auto stationIt = md5Object.begin(); stationIt != md5Object.end(); ++stationIt) {
+                    QHash<QString, QString> &dayMd5s = lineup.remoteDayMd5sByStation[stationIt.key()];
+                    const QJsonObject datesObject = stationIt.value().toObject();
+                    for (auto dateIt = datesObject.begin(); dateIt != datesObject.end(); ++dateIt) {
+                        const QString md5 = dateIt.value().toObject().value("md5").toString().trimmed();
+                        if (!md5.isEmpty()) {
+                            dayMd5s.insert(dateIt.key(), md5);
+                        }
+                    }
+                }
+            } else {
+                appendLog(QString("schedules-direct: schedule MD5 lookup failed for %1; fetching full schedules. %2")
+                              .arg(lineup.id, md5Result.errorText));
             }
 
-            QJsonArray stationScheduleDays = scheduleDaysByStation.value(stationId);
-            stationScheduleDays.append(scheduleDayObject);
-            scheduleDaysByStation.insert(stationId, stationScheduleDays);
+            for (const QJsonValue &requestValue : std::as_const(lineup.schedulesRequestArray)) {
+                const QString stationId = requestValue.toObject().value("stationID").toString();
+                sync.syncedStationIds.insert(stationId);
+                const auto remoteIt = lineup.remoteDayMd5sByStation.constFind(stationId);
+                if (remoteIt == lineup.remoteDayMd5sByStation.cend() || remoteIt->isEmpty()) {
+                    lineup.fullScheduleStationIds.insert(stationId);
+                    lineup.changedSchedulesRequestArray.append(requestValue);
+                    continue;
+                }
 
-            const QJsonArray dailyPrograms = scheduleDayObject.value("programs").toArray();
-            for (const QJsonValue &programValue : dailyPrograms) {
-                const QString programId = programValue.toObject().value("programID").toString().trimmed();
-                if (!programId.isEmpty() && !seenProgramIds.contains(programId)) {
-                    seenProgramIds.insert(programId);
-                    uniqueProgramIds.append(programId);
+                const QHash<QString, QJsonObject> cachedDays = sync.syncCache.scheduleDaysByStation.value(stationId);
+                QJsonArray changedDates;
+                for (auto dayIt = remoteIt->cbegin(); dayIt != remoteIt->cend(); ++dayIt) {
+                    const auto cachedIt = cachedDays.constFind(dayIt.key());
+                    if (cachedIt != cachedDays.cend()
+                        && schedulesDirectScheduleDayMd5(cachedIt.value()) == dayIt.value()) {
+                        ++sync.reusedScheduleDays;
+                    } else {
+                        changedDates.append(dayIt.key());
+                    }
                 }
-                if (!programId.isEmpty()) {
-                    ++lineupScheduleEntries;
+                if (!changedDates.isEmpty()) {
+                    QJsonObject changedRequestObject;
+                    changedRequestObject.insert("stationID", stationId);
+                    changedRequestObject.insert("date", changedDates);
+                    lineup.changedSchedulesRequestArray.append(changedRequestObject);
                 }
             }
-        }
+            fetchSchedulesDirectSchedules();
+        });
+}
+
+void MainWindow::fetchSchedulesDirectSchedules()
+{
+    SchedulesDirectSync &sync = *schedulesDirectSync_;
+    if (sync.lineup.changedSchedulesRequestArray.isEmpty()) {
+        fetchSchedulesDirectPrograms();
+        return;
+    }
 
-        QJsonObject programsById;
-        for (int start = 0; start < uniqueProgramIds.size(); start += kProgramChunkSize) {
-            const int chunkNumber = (start / kProgramChunkSize) + 1;
-            const int chunkCount = std::max(1, static_cast<int>(std::ceil(uniqueProgramIds.size()
-                                                                          / static_cast<double>(kProgramChunkSize))));
-            updateStatus(QString("Fetching OTA program details %1/%2 for %3...")
-                             .arg(chunkNumber)
-                             .arg(chunkCount)
-                             .arg(lineupId));
+    setSchedulesDirectSyncStatus(QString("Fetching OTA schedules %1/%2...")
+                                     .arg(sync.lineupIndex + 1)
+                                     .arg(sync.otaLineupIds.size()));
+    sync.client->enqueue(
+        {schedulesDirectApiUrl("/schedules"),
+         QJsonDocument(sync.lineup.changedSchedulesRequestArray),
+         QByteArray(),
+         kSchedulesDirectRequestTimeoutMs},
+        [this](const SchedulesDirectClient::Reply &schedulesResult) {
+            if (schedulesDirectSync_ == nullptr) {
+                return;
+            }
+            SchedulesDirectSync &sync = *schedulesDirectSync_;
+            sync.syncDownloadedBytes += schedulesResult.body.size();
+            if (!schedulesResult.ok() || !schedulesResult.document.isArray()) {
+                failSchedulesDirectSync(QString("Could not fetch OTA schedules for %1.").arg(sync.lineup.id),
+                                        schedulesResult.errorText);
+                return;
+            }
 
-            QJsonArray programsRequestArray;
-            const int end = std::min(start + kProgramChunkSize, static_cast<int>(uniqueProgramIds.size()));
-            for (int programIndex = start; programIndex < end; ++programIndex) {
-                programsRequestArray.append(uniqueProgramIds.at(programIndex));
+            QSet<QString> replacedStationIds;
+            for (const QJsonValue &scheduleDayValue : schedulesResult.document.array()) {
+                const QJsonObject scheduleDayObject = scheduleDayValue.toObject();
+                const QString stationId = scheduleDayObject.value("stationID").toString().trimmed();
+                const QString date = schedulesDirectScheduleDayDate(scheduleDayObject);
+                if (stationId.isEmpty() || date.isEmpty() || !scheduleDayObject.contains("programs")) {
+                    continue;
+                }
+                if (sync.lineup.fullScheduleStationIds.contains(stationId) && !replacedStationIds.contains(stationId)) {
+                    sync.syncCache.scheduleDaysByStation.remove(stationId);
+                    replacedStationIds.insert(stationId);
+                }
+                sync.syncCache.scheduleDaysByStation[stationId].insert(date, scheduleDayObject);
             }
+            fetchSchedulesDirectPrograms();
+        });
+}
+
+void MainWindow::fetchSchedulesDirectPrograms()
+{
+    SchedulesDirectSync &sync = *schedulesDirectSync_;
+    SchedulesDirectSync::Lineup &lineup = sync.lineup;
 
-            const JsonRequestResult programsResult =
-                performJsonRequest(networkManager,
-                                   userAgent,
-                                   QUrl("https://json.schedulesdirect.org/20141201/programs"),
-                                   token,
-                                   QJsonDocument(programsRequestArray),
-                                   QByteArray(),
-                                   kSchedulesDirectTimeoutMs);
-            if (!programsResult.ok() || !programsResult.document.isArray()) {
-                return failExport(QString("Could not fetch OTA program details for %1.").arg(lineupId),
-                                  programsResult.errorText);
+    // Days the MD5 listing no longer mentions have aged out of the schedule window.
+    for (auto remoteIt = lineup.remoteDayMd5sByStation.cbegin(); remoteIt != lineup.remoteDayMd5sByStation.cend();
+         ++remoteIt) {
+        auto cachedIt = sync.syncCache.scheduleDaysByStation.find(remoteIt.key());
+        if (cachedIt == sync.syncCache.scheduleDaysByStation.end() || remoteIt->isEmpty()) {
+            continue;
+        }
+        for (auto dayIt = cachedIt->begin(); dayIt != cachedIt->end();) {
+            if (remoteIt->contains(dayIt.key())) {
+                ++dayIt;
+            } else {
+                dayIt = cachedIt->erase(dayIt);
             }
+        }
+    }
 
-            for (const QJsonValue &programValue : programsResult.document.array()) {
-                if (!programValue.isObject()) {
+    QSet<QString> seenProgramIds;
+    QHash<QString, QString> programMd5ById;
+    for (const QString &stationId : std::as_const(lineup.stationIdSet)) {
+        const auto daysIt = sync.syncCache.scheduleDaysByStation.constFind(stationId);
+        if (daysIt == sync.syncCache.scheduleDaysByStation.cend()) {
+            continue;
+        }
+        lineup.scheduleDays += daysIt->size();
+        for (const QJsonObject &scheduleDayObject : daysIt.value()) {
+            const QJsonArray dailyPrograms = scheduleDayObject.value("programs").toArray();
+            for (const QJsonValue &programValue : dailyPrograms) {
+                const QJsonObject scheduledProgram = programValue.toObject();
+                const QString programId = scheduledProgram.value("programID").toString().trimmed();
+                if (programId.isEmpty()) {
                     continue;
                 }
-                const QJsonObject programObject = programValue.toObject();
-                const QString programId = programObject.value("programID").toString().trimmed();
-                if (!programId.isEmpty()) {
-                    programsById.insert(programId, programObject);
+                ++lineup.scheduleEntries;
+                if (!seenProgramIds.contains(programId)) {
+                    seenProgramIds.insert(programId);
+                    lineup.uniqueProgramIds.append(programId);
+                    programMd5ById.insert(programId, scheduledProgram.value("md5").toString().trimmed());
                 }
             }
         }
+    }
+
+    QStringList changedProgramIds;
+    for (const QString &programId : std::as_const(lineup.uniqueProgramIds)) {
+        sync.referencedProgramIds.insert(programId);
+        const auto cachedIt = sync.syncCache.programsById.constFind(programId);
+        const QString remoteMd5 = programMd5ById.value(programId);
+        if (cachedIt != sync.syncCache.programsById.cend() && !remoteMd5.isEmpty()
+            && cachedIt->value("md5").toString().trimmed() == remoteMd5) {
+            ++sync.reusedPrograms;
+        } else {
+            changedProgramIds.append(programId);
+        }
+    }
 
-        QJsonArray channels;
-        for (const QJsonValue &mapValue : stationMap) {
-            const QJsonObject mapObject = mapValue.toObject();
-            const QString stationId = mapObject.value("stationID").toString().trimmed();
+    lineup.programChunkCount = static_cast<int>((changedProgramIds.size() + kSchedulesDirectProgramChunkSize - 1)
+                                                / kSchedulesDirectProgramChunkSize);
+    if (lineup.programChunkCount == 0) {
+        finishSchedulesDirectLineup();
+        return;
+    }
 
-            QJsonObject channelObject = mapObject;
-            if (stationById.contains(stationId)) {
-                channelObject.insert("station", stationById.value(stationId));
-            }
+    // Every chunk is queued up front; the client keeps several of them in flight and the last one to land
+    // moves the sync on to the next lineup.
+    setSchedulesDirectSyncStatus(
+        QString("Fetching OTA program details 0/%1 for %2...").arg(lineup.programChunkCount).arg(lineup.id));
+    for (int start = 0; start < changedProgramIds.size(); start += kSchedulesDirectProgramChunkSize) {
+        QJsonArray programsRequestArray;
+        const int end = std::min(start + kSchedulesDirectProgramChunkSize, static_cast<int>(changedProgramIds.size()));
+        for (int programIndex = start; programIndex < end; ++programIndex) {
+            programsRequestArray.append(changedProgramIds.at(programIndex));
+        }
 
-            QJsonArray enrichedScheduleDays;
-            int channelScheduleEntries = 0;
-            const QJsonArray stationScheduleDays = scheduleDaysByStation.value(stationId);
-            for (const QJsonValue &scheduleDayValue : stationScheduleDays) {
-                const QJsonObject scheduleDayObject = scheduleDayValue.toObject();
-                QJsonObject enrichedScheduleDay = scheduleDayObject;
-                QJsonArray enrichedPrograms;
-
-                const QJsonArray dailyPrograms = scheduleDayObject.value("programs").toArray();
-                for (const QJsonValue &programValue : dailyPrograms) {
-                    QJsonObject enrichedProgram = programValue.toObject();
-                    const QString programId = enrichedProgram.value("programID").toString().trimmed();
-                    const QJsonObject programObject = programsById.value(programId).toObject();
-                    if (!programObject.isEmpty()) {
-                        const QString title = firstProgramTitle(programObject);
-                        const QString episodeTitle = programObject.value("episodeTitle150").toString().trimmed();
-                        const QString description = bestProgramDescription(programObject);
-                        const QString showType = programObject.value("showType").toString().trimmed();
-                        const QString entityType = programObject.value("entityType").toString().trimmed();
-                        const QString originalAirDate = programObject.value("originalAirDate").toString().trimmed();
-
-                        if (!title.isEmpty()) {
-                            enrichedProgram.insert("title", title);
-                        }
-                        if (!episodeTitle.isEmpty()) {
-                            enrichedProgram.insert("episode", episodeTitle);
-                            enrichedProgram.insert("episodeTitle", episodeTitle);
-                        }
-                        if (!description.isEmpty()) {
-                            enrichedProgram.insert("description", description);
-                        }
-                        if (!showType.isEmpty()) {
-                            enrichedProgram.insert("showType", showType);
-                        }
-                        if (!entityType.isEmpty()) {
-                            enrichedProgram.insert("entityType", entityType);
-                        }
-                        if (!originalAirDate.isEmpty()) {
-                            enrichedProgram.insert("originalAirDate", originalAirDate);
-                        }
+        sync.client->enqueue(
+            {schedulesDirectApiUrl("/programs"),
+             QJsonDocument(programsRequestArray),
+             QByteArray(),
+             kSchedulesDirectRequestTimeoutMs},
+            [this](const SchedulesDirectClient::Reply &programsResult) {
+                if (schedulesDirectSync_ == nullptr) {
+                    return;
+                }
+                SchedulesDirectSync &sync = *schedulesDirectSync_;
+                SchedulesDirectSync::Lineup &lineup = sync.lineup;
+                sync.syncDownloadedBytes += programsResult.body.size();
+                if (!programsResult.ok() || !programsResult.document.isArray()) {
+                    failSchedulesDirectSync(QString("Could not fetch OTA program details for %1.").arg(lineup.id),
+                                            programsResult.errorText.trimmed().isEmpty()
+                                                ? QString("Unexpected program details response.")
+                                                : programsResult.errorText);
+                    return;
+                }
 
-                        const QJsonArray genres = programObject.value("genres").toArray();
-                        if (!genres.isEmpty()) {
-                            enrichedProgram.insert("genres", genres);
-                        }
+                for (const QJsonValue &programValue : programsResult.document.array()) {
+                    if (!programValue.isObject()) {
+                        continue;
+                    }
+                    const QJsonObject programObject = programValue.toObject();
+                    const QString programId = programObject.value("programID").toString().trimmed();
+                    if (!programId.isEmpty()) {
+                        sync.syncCache.programsById.insert(programId, programObject);
                     }
-
-                    enrichedPrograms.append(enrichedProgram);
-                    ++channelScheduleEntries;
                 }
+                ++lineup.finishedProgramChunks;
+                setSchedulesDirectSyncStatus(QString("Fetching OTA program details %1/%2 for %3...")
+                                                 .arg(lineup.finishedProgramChunks)
+                                                 .arg(lineup.programChunkCount)
+                                                 .arg(lineup.id));
+                if (lineup.finishedProgramChunks == lineup.programChunkCount) {
+                    finishSchedulesDirectLineup();
+                }
+            });
+    }
+}
 
-                enrichedScheduleDay.insert("programs", enrichedPrograms);
-                enrichedScheduleDays.append(enrichedScheduleDay);
-            }
+void MainWindow::finishSchedulesDirectLineup()
+{
+    SchedulesDirectSync &sync = *schedulesDirectSync_;
+    const SchedulesDirectSync::Lineup &lineup = sync.lineup;
+
+    // Airings go straight from the synced schedule days and program details into compact guide entries.
+    int lineupResolvedPrograms = 0;
+    for (const QString &programId : lineup.uniqueProgramIds) {
+        if (sync.syncCache.programsById.contains(programId)) {
+            ++lineupResolvedPrograms;
+        }
+    }
+    const QJsonArray stationMap = lineup.object.value("map").toArray();
+    for (const QJsonValue &mapValue : stationMap) {
+        const QJsonObject mapObject = mapValue.toObject();
+        const QString stationId = mapObject.value("stationID").toString().trimmed();
+        SchedulesDirectChannelPayload channel =
+            schedulesDirectChannelPayload(mapObject, lineup.stationById.value(stationId));
+
+        const QHash<QString, QJsonObject> days = sync.syncCache.scheduleDaysByStation.value(stationId);
+        QStringList dates = days.keys();
+        dates.sort();
+        for (const QString &date : std::as_const(dates)) {
+            sync.totalScheduleEntries +=
+                appendSchedulesDirectScheduleDay(&channel.entries, days.value(date), sync.syncCache.programsById);
+        }
+        sync.sdChannels.append(schedulesDirectChannelToJson(channel));
+        ++sync.totalChannels;
+    }
+    sync.totalResolvedPrograms += lineupResolvedPrograms;
 
-            channelObject.insert("schedule", enrichedScheduleDays);
-            channelObject.insert("scheduleEntryCount", channelScheduleEntries);
-            channels.append(channelObject);
-            ++totalChannels;
-            totalScheduleEntries += channelScheduleEntries;
+    QJsonObject exportedLineup;
+    exportedLineup.insert("lineup", lineup.id);
+    exportedLineup.insert("metadata", lineup.object.value("metadata").toObject());
+    exportedLineup.insert("stationCount", lineup.object.value("stations").toArray().size());
+    exportedLineup.insert("channelCount", stationMap.size());
+    exportedLineup.insert("scheduleDayCount", lineup.scheduleDays);
+    exportedLineup.insert("scheduleEntryCount", lineup.scheduleEntries);
+    exportedLineup.insert("programCount", lineupResolvedPrograms);
+    sync.exportedLineups.append(exportedLineup);
+
+    if (!sync.rawDumpPath.isEmpty()) {
+        QJsonArray rawScheduleDays;
+        for (const QString &stationId : lineup.stationIdSet) {
+            const QHash<QString, QJsonObject> days = sync.syncCache.scheduleDaysByStation.value(stationId);
+            for (const QJsonObject &scheduleDayObject : days) {
+                rawScheduleDays.append(scheduleDayObject);
+            }
         }
+        QJsonObject rawPrograms;
+        for (const QString &programId : lineup.uniqueProgramIds) {
+            const auto programIt = sync.syncCache.programsById.constFind(programId);
+            if (programIt != sync.syncCache.programsById.cend()) {
+                rawPrograms.insert(programId, programIt.value());
+            }
+        }
+        QJsonObject rawLineup = lineup.object;
+        rawLineup.insert("lineup", lineup.id);
+        rawLineup.insert("schedules", rawScheduleDays);
+        rawLineup.insert("programs", rawPrograms);
+        sync.rawDumpLineups.append(rawLineup);
+    }
+
+    ++sync.lineupIndex;
+    syncNextSchedulesDirectLineup();
+}
+
+void MainWindow::finishSchedulesDirectSync()
+{
+    SchedulesDirectSync &sync = *schedulesDirectSync_;
+    SchedulesDirectSyncCache &syncCache = sync.syncCache;
+    const QString &exportPath = sync.exportPath;
+
+    // Drop stations and programs this refresh no longer references so the cache stays bounded.
+    for (auto it = syncCache.scheduleDaysByStation.begin(); it != syncCache.scheduleDaysByStation.end();) {
+        it = sync.syncedStationIds.contains(it.key()) ? std::next(it) : syncCache.scheduleDaysByStation.erase(it);
+    }
+    for (auto it = syncCache.programsById.begin(); it != syncCache.programsById.end();) {
+        it = sync.referencedProgramIds.contains(it.key()) ? std::next(it) : syncCache.programsById.erase(it);
+    }
+    QString syncCacheError;
+    if (!sync.syncCachePath.isEmpty() && !saveSchedulesDirectSyncCache(sync.syncCachePath, syncCache, &syncCacheError)) {
+        appendLog(QString("schedules-direct: %1").arg(syncCacheError));
+    }
+    appendLog(QString("schedules-direct: sync downloaded %1 KiB of schedules and programs; reused %2 cached "
+                      "station-days and %3 cached programs.")
+                  .arg((sync.syncDownloadedBytes + 1023) / 1024)
+                  .arg(sync.reusedScheduleDays)
+                  .arg(sync.reusedPrograms));
 
-        totalResolvedPrograms += programsById.size();
+    if (!sync.rawDumpPath.isEmpty()) {
+        QJsonObject rawDumpObject;
+        rawDumpObject.insert("generatedUtc", QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs));
+        rawDumpObject.insert("status", sync.statusObject);
+        rawDumpObject.insert("otaHeadends", sync.otaHeadends);
+        rawDumpObject.insert("addedLineups", sync.addedLineups);
+        rawDumpObject.insert("lineups", sync.rawDumpLineups);
+        sync.rawDumpLineups = QJsonArray();
 
-        QJsonObject exportedLineup;
-        exportedLineup.insert("lineup", lineupId);
-        exportedLineup.insert("metadata", lineupObject.value("metadata").toObject());
-        exportedLineup.insert("stationCount", stations.size());
-        exportedLineup.insert("channelCount", channels.size());
-        exportedLineup.insert("scheduleDayCount", scheduleDays.size());
-        exportedLineup.insert("scheduleEntryCount", lineupScheduleEntries);
-        exportedLineup.insert("programCount", programsById.size());
-        exportedLineup.insert("channels", channels);
-        exportedLineups.append(exportedLineup);
+        QSaveFile rawDumpFile(sync.rawDumpPath);
+        const QByteArray rawDumpPayload = QJsonDocument(rawDumpObject).toJson(QJsonDocument::Indented);
+        if (rawDumpFile.open(QIODevice::WriteOnly | QIODevice::Truncate)
+            && rawDumpFile.write(rawDumpPayload) == rawDumpPayload.size() && rawDumpFile.commit()) {
+            appendLog(QString("schedules-direct: saved raw debug dump to %1").arg(sync.rawDumpPath));
+        } else {
+            appendLog(QString("schedules-direct: could not save raw debug dump to %1: %2")
+                          .arg(sync.rawDumpPath, rawDumpFile.errorString()));
+        }
     }
 
     QJsonObject exportObject;
-    exportObject.insert("version", 2);
+    exportObject.insert("version", 4);
     exportObject.insert("generatedUtc", QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs));
     exportObject.insert("source", "Schedules Direct sdJSON");
     exportObject.insert("transport", "Antenna");
     exportObject.insert("country", "USA");
-    exportObject.insert("postalCode", postalCode);
-    exportObject.insert("username", username);
-    exportObject.insert("tokenExpires", tokenObject.value("tokenExpires").toInt());
-    exportObject.insert("status", statusResult.document.object());
-    exportObject.insert("otaHeadends", otaHeadends);
-    exportObject.insert("addedLineups", addedLineups);
-    exportObject.insert("lineups", exportedLineups);
-    exportObject.insert("totalChannels", totalChannels);
-    exportObject.insert("totalScheduleEntries", totalScheduleEntries);
-    exportObject.insert("totalProgramRecords", totalResolvedPrograms);
-
-    QSaveFile exportFile(exportPath);
-    if (!exportFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-        return failExport("Schedules Direct export failed.",
-                          QString("Could not open %1 for writing.").arg(exportPath));
-    }
-
-    const QByteArray payload = QJsonDocument(exportObject).toJson(QJsonDocument::Indented);
-    if (exportFile.write(payload) != payload.size()) {
-        exportFile.cancelWriting();
-        return failExport("Schedules Direct export failed.",
-                          QString("Could not write the JSON payload to %1.").arg(exportPath));
-    }
-    if (!exportFile.commit()) {
-        return failExport("Schedules Direct export failed.",
-                          QString("Could not finalize %1.").arg(exportPath));
-    }
+    exportObject.insert("postalCode", sync.postalCode);
+    exportObject.insert("username", sync.username);
+    exportObject.insert("tokenExpires", sync.tokenObject.value("tokenExpires").toInt());
+    exportObject.insert("lineupSummaries", sync.exportedLineups);
+    exportObject.insert("totalChannels", sync.totalChannels);
+    exportObject.insert("totalScheduleEntries", sync.totalScheduleEntries);
+    exportObject.insert("totalProgramRecords", sync.totalResolvedPrograms);
+    exportObject.insert("sdChannels", sync.sdChannels);
+    sync.sdChannels = QJsonArray();
 
+    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
     QHash<QString, QList<TvGuideEntry>> guideLikeEntries;
     QStringList importedChannels;
     QStringList unmatchedChannels;
     QStringList skippedChannels;
     int importedEntryCount = 0;
     QDateTime latestEndUtc = nowUtc.addSecs(6 * 3600);
-    applySchedulesDirectGuideFallback(guideLikeEntries,
-                                      retentionHours,
+    applySchedulesDirectGuideFallback(exportObject,
+                                      exportPath,
+                                      guideLikeEntries,
+                                      sync.retentionHours,
                                       nowUtc,
                                       &latestEndUtc,
                                       &importedChannels,
@@ -7599,7 +9441,7 @@ bool MainWindow::ensureSchedulesDirectJson(bool allowCachedExport,
 
     QStringList channelOrder;
     QSet<QString> seenChannelNames;
-    const QVector<GuideChannelInfo> localChannels = parseGuideChannels(channelLines_, &xspfNumberByTuneKey_);
+    const QVector<GuideChannelInfo> localChannels = guideChannelIndex().channels;
     for (const GuideChannelInfo &channel : localChannels) {
         if (!channel.name.trimmed().isEmpty() && !seenChannelNames.contains(channel.name)) {
             seenChannelNames.insert(channel.name);
@@ -7642,7 +9484,6 @@ bool MainWindow::ensureSchedulesDirectJson(bool allowCachedExport,
         guideLikeStatusText += QString("\nSkipped duplicate local channel names: %1").arg(skippedChannels.join(", "));
     }
 
-    exportObject.insert("version", 3);
     exportObject.insert("windowStartUtc", windowStartUtc.toString(Qt::ISODateWithMs));
     exportObject.insert("slotMinutes", slotMinutes);
     exportObject.insert("slotCount", slotCount);
@@ -7653,48 +9494,105 @@ bool MainWindow::ensureSchedulesDirectJson(bool allowCachedExport,
     exportObject.insert("unmatchedChannels", QJsonArray::fromStringList(unmatchedChannels));
     exportObject.insert("skippedChannels", QJsonArray::fromStringList(skippedChannels));
 
-    QSaveFile guideLikeExportFile(exportPath);
-    if (!guideLikeExportFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-        return failExport("Schedules Direct export failed.",
-                          QString("Could not reopen %1 for guide-shaped JSON output.").arg(exportPath));
+    QSaveFile exportFile(exportPath);
+    if (!exportFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        failSchedulesDirectSync("Schedules Direct export failed.",
+                                QString("Could not open %1 for writing.").arg(exportPath));
+        return;
     }
 
-    const QByteArray guideLikePayload = QJsonDocument(exportObject).toJson(QJsonDocument::Indented);
-    if (guideLikeExportFile.write(guideLikePayload) != guideLikePayload.size()) {
-        guideLikeExportFile.cancelWriting();
-        return failExport("Schedules Direct export failed.",
-                          QString("Could not write the guide-shaped JSON payload to %1.").arg(exportPath));
+    const QByteArray payload = QJsonDocument(exportObject).toJson(QJsonDocument::Compact);
+    if (exportFile.write(payload) != payload.size()) {
+        exportFile.cancelWriting();
+        failSchedulesDirectSync("Schedules Direct export failed.",
+                                QString("Could not write the JSON payload to %1.").arg(exportPath));
+        return;
     }
-    if (!guideLikeExportFile.commit()) {
-        return failExport("Schedules Direct export failed.",
-                          QString("Could not finalize the guide-shaped JSON payload at %1.").arg(exportPath));
+    if (!exportFile.commit()) {
+        failSchedulesDirectSync("Schedules Direct export failed.", QString("Could not finalize %1.").arg(exportPath));
+        return;
     }
 
-    const QString summaryText = QString("Saved %1 OTA lineup%2 with %3 channels and %4 show entries to %5")
-                                .arg(exportedLineups.size())
-                                .arg(exportedLineups.size() == 1 ? QString() : QString("s"))
-                                .arg(totalChannels)
-                                .arg(totalScheduleEntries)
-                                .arg(exportPath);
-    appendLog(QString("schedules-direct: %1").arg(summaryText));
+    SchedulesDirectSyncResult result;
+    result.ok = true;
+    result.exportRoot = exportObject;
+    result.summary = QString("Saved %1 OTA lineup%2 with %3 channels and %4 show entries to %5")
+                         .arg(sync.exportedLineups.size())
+                         .arg(sync.exportedLineups.size() == 1 ? QString() : QString("s"))
+                         .arg(sync.totalChannels)
+                         .arg(sync.totalScheduleEntries)
+                         .arg(exportPath);
+    appendLog(QString("schedules-direct: %1").arg(result.summary));
     logInteraction("program",
                    "schedules-direct.export.complete",
                    QString("postal=%1 ota-lineups=%2 channels=%3 schedule-entries=%4 path=%5")
-                       .arg(postalCode)
-                       .arg(exportedLineups.size())
-                       .arg(totalChannels)
-                       .arg(totalScheduleEntries)
+                       .arg(sync.postalCode)
+                       .arg(sync.exportedLineups.size())
+                       .arg(sync.totalChannels)
+                       .arg(sync.totalScheduleEntries)
                        .arg(exportPath));
-    if (schedulesDirectStatusLabel_ != nullptr) {
-        schedulesDirectStatusLabel_->setText(
-            QString("Saved OTA JSON: %1 channels, %2 shows.").arg(totalChannels).arg(totalScheduleEntries));
-        syncConfigGroupBoxHeights();
+    setSchedulesDirectSyncStatus(
+        QString("Saved OTA JSON: %1 channels, %2 shows.").arg(sync.totalChannels).arg(sync.totalScheduleEntries),
+        "Schedules Direct export complete");
+    completeSchedulesDirectSync(result);
+}
+
+MainWindow::SchedulesDirectSyncResult MainWindow::cachedSchedulesDirectExportResult(const QString &reason)
+{
+    SchedulesDirectSyncResult result;
+    result.ok = true;
+    result.usedCachedExport = true;
+    result.summary = QString("%1 Using cached Schedules Direct JSON from %2.")
+                         .arg(reason.trimmed(), schedulesDirectSync_->cachedExportPath);
+    appendLog(QString("schedules-direct: %1").arg(result.summary));
+    setSchedulesDirectSyncStatus("Using cached Schedules Direct OTA JSON.", "Using cached Schedules Direct JSON");
+    return result;
+}
+
+void MainWindow::failSchedulesDirectSync(const QString &failureSummary, const QString &details)
+{
+    QString message = failureSummary.trimmed();
+    if (!details.trimmed().isEmpty()) {
+        message += QString(" %1").arg(details.trimmed());
     }
-    setStatusBarStateMessage("Schedules Direct export complete");
-    if (summary != nullptr) {
-        *summary = summaryText;
+    message.replace('\n', ' ');
+    appendLog(QString("schedules-direct: %1").arg(message));
+    logInteraction("program",
+                   "schedules-direct.export.failed",
+                   message);
+    if (schedulesDirectSync_->allowCachedExport && !schedulesDirectSync_->cachedExportPath.isEmpty()) {
+        completeSchedulesDirectSync(cachedSchedulesDirectExportResult(message));
+        return;
     }
-    return true;
+
+    SchedulesDirectSyncResult result;
+    result.errorText = message;
+    setSchedulesDirectSyncStatus("Schedules Direct export failed. See Logs.", "Schedules Direct export failed");
+    completeSchedulesDirectSync(result);
+}
+
+void MainWindow::completeSchedulesDirectSync(const SchedulesDirectSyncResult &result)
+{
+    SchedulesDirectSyncCallback onFinished;
+    if (schedulesDirectSync_ != nullptr) {
+        onFinished = std::move(schedulesDirectSync_->onFinished);
+    }
+    cancelSchedulesDirectSync();
+    if (onFinished) {
+        onFinished(result);
+    }
+}
+
+void MainWindow::cancelSchedulesDirectSync()
+{
+    // The sync is detached first, so callbacks that cancel() finishes below find no sync and return.
+    const std::unique_ptr<SchedulesDirectSync> sync = std::move(schedulesDirectSync_);
+    if (sync == nullptr || sync->client == nullptr) {
+        return;
+    }
+    sync->client->disconnect(this);
+    sync->client->cancel();
+    sync->client->deleteLater();
 }
 
 void MainWindow::exportSchedulesDirectJson()
@@ -7702,36 +9600,114 @@ void MainWindow::exportSchedulesDirectJson()
     if (exportSchedulesDirectButton_ != nullptr) {
         exportSchedulesDirectButton_->setEnabled(false);
     }
-    struct ExportGuard {
-        std::function<void()> onExit;
-        ~ExportGuard()
-        {
-            if (onExit) {
-                onExit();
-            }
+    startSchedulesDirectSync(false, [this](const SchedulesDirectSyncResult &) {
+        if (exportSchedulesDirectButton_ != nullptr) {
+            const bool ready = schedulesDirectUsernameEdit_ != nullptr
+                               && schedulesDirectPasswordEdit_ != nullptr
+                               && schedulesDirectPostalCodeEdit_ != nullptr
+                               && !schedulesDirectUsernameEdit_->text().trimmed().isEmpty()
+                               && !schedulesDirectPasswordEdit_->text().trimmed().isEmpty()
+                               && !schedulesDirectPostalCodeEdit_->text().trimmed().isEmpty();
+            exportSchedulesDirectButton_->setEnabled(ready);
+        }
+    });
+}
+
+void MainWindow::invalidateGuideChannelIndex()
+{
+    ++guideChannelIndexGeneration_;
+}
+
+MainWindow::GuideChannelIndex &MainWindow::guideChannelIndex()
+{
+    if (guideChannelIndex_ == nullptr) {
+        guideChannelIndex_ = std::make_unique<GuideChannelIndex>();
+    } else if (guideChannelIndex_->generation == guideChannelIndexGeneration_) {
+        return *guideChannelIndex_;
+    }
+
+    GuideChannelIndex index;
+    index.generation = guideChannelIndexGeneration_;
+    index.channels = parseGuideChannels(channelLines_, &xspfNumberByTuneKey_);
+    index.identities.reserve(index.channels.size());
+    for (const GuideChannelInfo &channel : std::as_const(index.channels)) {
+        index.nameCounts[channel.name] += 1;
+        index.channelsByFrequency[channel.frequencyHz].append(channel);
+        index.namesByServiceIdByFrequency[channel.frequencyHz][channel.serviceId].append(channel.name);
+
+        GuideChannelIdentity identity;
+        identity.rfChannel = atscRfChannelForFrequencyHz(channel.frequencyHz);
+        const QString xspfNumberHint =
+            xspfNumberByTuneKey_.value(tuneKey(QString::number(channel.frequencyHz),
+                                              QString::number(channel.serviceId))).trimmed();
+        parseLocalVirtualChannelHint(xspfNumberHint, channel.serviceId, identity.virtualMajor, identity.virtualMinor);
+        const QString localName = channel.name.trimmed();
+        identity.normalizedName =
+            normalizeGuideMatchText(channel.baseName.trimmed().isEmpty() ? localName : channel.baseName.trimmed());
+        index.identities.append(identity);
+    }
+    *guideChannelIndex_ = std::move(index);
+    return *guideChannelIndex_;
+}
+
+void MainWindow::invalidateFavoriteShowIndex()
+{
+    ++favoriteShowIndexGeneration_;
+}
+
+MainWindow::FavoriteShowIndex &MainWindow::favoriteShowIndex()
+{
+    if (favoriteShowIndex_ == nullptr) {
+        favoriteShowIndex_ = std::make_unique<FavoriteShowIndex>();
+    } else if (favoriteShowIndex_->generation == favoriteShowIndexGeneration_) {
+        return *favoriteShowIndex_;
+    }
+
+    const QHash<QString, QList<TvGuideEntry>> &entriesByChannel =
+        guideEntriesFullCache_.isEmpty() ? guideEntriesCache_ : guideEntriesFullCache_;
+    QStringList orderedChannels = lastGuideChannelOrder_;
+    const QSet<QString> orderedChannelSet(orderedChannels.cbegin(), orderedChannels.cend());
+    for (auto it = entriesByChannel.cbegin(); it != entriesByChannel.cend(); ++it) {
+        if (!orderedChannelSet.contains(it.key())) {
+            orderedChannels.append(it.key());
+        }
+    }
+
+    FavoriteShowIndex &index = *favoriteShowIndex_;
+    index.generation = favoriteShowIndexGeneration_;
+    index.occurrencesByTitle.clear();
+    QSet<QString> occurrenceKeys;
+    for (const QString &channelName : std::as_const(orderedChannels)) {
+        const auto entriesIt = entriesByChannel.constFind(channelName);
+        if (entriesIt == entriesByChannel.cend()) {
+            continue;
         }
-    } exportGuard{[this]() {
-        if (exportSchedulesDirectButton_ != nullptr) {
-            const bool ready = schedulesDirectUsernameEdit_ != nullptr
-                               && schedulesDirectPasswordEdit_ != nullptr
-                               && schedulesDirectPostalCodeEdit_ != nullptr
-                               && !schedulesDirectUsernameEdit_->text().trimmed().isEmpty()
-                               && !schedulesDirectPasswordEdit_->text().trimmed().isEmpty()
-                               && !schedulesDirectPostalCodeEdit_->text().trimmed().isEmpty();
-            exportSchedulesDirectButton_->setEnabled(ready);
+        for (const TvGuideEntry &entry : entriesIt.value()) {
+            const TvGuideScheduledSwitch occurrence = scheduledSwitchFromGuideEntry(channelName, entry);
+            if (occurrence.channelName.isEmpty()
+                || !occurrence.startUtc.isValid()
+                || !occurrence.endUtc.isValid()
+                || occurrence.endUtc <= occurrence.startUtc) {
+                continue;
+            }
+            const QString normalizedTitle = normalizeFavoriteShowRule(occurrence.title);
+            if (normalizedTitle.isEmpty()) {
+                continue;
+            }
+            const QString occurrenceKey = favoriteShowOccurrenceKey(occurrence, normalizedTitle);
+            if (occurrenceKeys.contains(occurrenceKey)) {
+                continue;
+            }
+            occurrenceKeys.insert(occurrenceKey);
+            index.occurrencesByTitle[normalizedTitle].append(occurrence);
         }
-    }};
-
-    QString summaryText;
-    QString errorText;
-    bool usedCachedExport = false;
-    const bool ok = ensureSchedulesDirectJson(false, &usedCachedExport, &summaryText, &errorText);
-    if (!ok) {
-        return;
     }
+    return index;
 }
 
-bool MainWindow::applySchedulesDirectGuideFallback(QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
+bool MainWindow::applySchedulesDirectGuideFallback(const QJsonObject &rootObject,
+                                                   const QString &exportPath,
+                                                   QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
                                                    int retentionHours,
                                                    const QDateTime &nowUtc,
                                                    QDateTime *latestEndUtc,
@@ -7767,33 +9743,7 @@ bool MainWindow::applySchedulesDirectGuideFallback(QHash<QString, QList<TvGuideE
         return false;
     }
 
-    QString exportPath = resolveSchedulesDirectExportPath();
-    if (exportPath.isEmpty()) {
-        return false;
-    }
-    if (!QFileInfo::exists(exportPath)) {
-        const QString legacyExportPath = resolveLegacySchedulesDirectExportPath();
-        if (QFileInfo::exists(legacyExportPath)) {
-            exportPath = legacyExportPath;
-        }
-    }
-
-    QFile exportFile(exportPath);
-    if (!exportFile.exists() || !exportFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        return false;
-    }
-
-    QJsonParseError parseError{};
-    const QJsonDocument document = QJsonDocument::fromJson(exportFile.readAll(), &parseError);
-    if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
-        appendLog(QString("guide-sd: could not parse %1 (%2)")
-                      .arg(exportPath, parseError.errorString()));
-        return false;
-    }
-
-    const QJsonObject rootObject = document.object();
-    const QVector<SchedulesDirectChannelPayload> sdChannels =
-        parseSchedulesDirectExportChannels(rootObject);
+    const QVector<SchedulesDirectChannelPayload> sdChannels = schedulesDirectChannelsFromExport(rootObject);
     const QJsonObject embeddedEntriesObject = rootObject.value("entriesByChannel").toObject();
     if (sdChannels.isEmpty() && !embeddedEntriesObject.isEmpty()) {
         int importedEntries = 0;
@@ -7842,26 +9792,30 @@ bool MainWindow::applySchedulesDirectGuideFallback(QHash<QString, QList<TvGuideE
         return false;
     }
 
-    const QVector<GuideChannelInfo> localChannels = parseGuideChannels(channelLines_, &xspfNumberByTuneKey_);
+    GuideChannelIndex &channelIndex = guideChannelIndex();
+    const QVector<GuideChannelInfo> localChannels = channelIndex.channels;
     if (localChannels.isEmpty()) {
         return false;
     }
 
-    QHash<QString, int> localNameCounts;
-    for (const GuideChannelInfo &channel : localChannels) {
-        localNameCounts[channel.name] += 1;
+    // Matches are reused across refreshes until the local channels or the Schedules Direct lineup change.
+    const SchedulesDirectChannelLookup lookup = buildSchedulesDirectChannelLookup(sdChannels);
+    if (channelIndex.schedulesDirectStamp != lookup.stamp) {
+        channelIndex.schedulesDirectStamp = lookup.stamp;
+        channelIndex.schedulesDirectMatchByName.clear();
     }
 
     int importedEntries = 0;
     int matchedChannels = 0;
-    for (const GuideChannelInfo &channel : localChannels) {
+    for (int localIndex = 0; localIndex < localChannels.size(); ++localIndex) {
+        const GuideChannelInfo &channel = localChannels.at(localIndex);
         const QString localName = channel.name.trimmed();
         const QString localMatchName = channel.baseName.trimmed().isEmpty() ? localName : channel.baseName.trimmed();
         if (localName.isEmpty() || localMatchName.isEmpty()) {
             continue;
         }
 
-        if (localNameCounts.value(localName) > 1) {
+        if (channelIndex.nameCounts.value(localName) > 1) {
             appendUnique(skippedChannels, localName);
             continue;
         }
@@ -7870,103 +9824,22 @@ bool MainWindow::applySchedulesDirectGuideFallback(QHash<QString, QList<TvGuideE
             continue;
         }
 
-        SchedulesDirectLocalChannelHint hint;
-        hint.name = localName;
-        hint.frequencyHz = channel.frequencyHz;
-        hint.serviceId = channel.serviceId;
-        hint.rfChannel = atscRfChannelForFrequencyHz(channel.frequencyHz);
-
-        const QString xspfNumberHint =
-            xspfNumberByTuneKey_.value(tuneKey(QString::number(channel.frequencyHz),
-                                              QString::number(channel.serviceId))).trimmed();
-        parseLocalVirtualChannelHint(xspfNumberHint, channel.serviceId, hint.virtualMajor, hint.virtualMinor);
-
-        const SchedulesDirectChannelPayload *matchedChannel = nullptr;
-
-        if (hint.virtualMajor > 0 && hint.virtualMinor > 0) {
-            for (const SchedulesDirectChannelPayload &candidate : sdChannels) {
-                if (candidate.virtualMajor == hint.virtualMajor
-                    && candidate.virtualMinor == hint.virtualMinor) {
-                    matchedChannel = &candidate;
-                    break;
-                }
-            }
-        }
-
-        if (matchedChannel == nullptr && hint.rfChannel > 0 && hint.virtualMinor > 0) {
-            const SchedulesDirectChannelPayload *uniqueRfMinorMatch = nullptr;
-            for (const SchedulesDirectChannelPayload &candidate : sdChannels) {
-                if (candidate.rfChannel != hint.rfChannel || candidate.virtualMinor != hint.virtualMinor) {
-                    continue;
-                }
-                if (uniqueRfMinorMatch != nullptr) {
-                    uniqueRfMinorMatch = nullptr;
-                    break;
-                }
-                uniqueRfMinorMatch = &candidate;
-            }
-            matchedChannel = uniqueRfMinorMatch;
-        }
-
-        const bool hasSpecificVirtualMinor = hint.virtualMinor > 0;
-        if (matchedChannel == nullptr && hasSpecificVirtualMinor) {
-            appendUnique(unmatchedChannels, localName);
-            appendLog(QString("guide-sd: no exact subchannel match for %1; skipping loose fallback mapping.")
-                          .arg(localName));
-            continue;
-        }
-
-        if (matchedChannel == nullptr && hint.rfChannel > 0) {
-            const SchedulesDirectChannelPayload *uniqueRfNameMatch = nullptr;
-            for (const SchedulesDirectChannelPayload &candidate : sdChannels) {
-                if (candidate.rfChannel != hint.rfChannel
-                    || !schedulesDirectLocalNameMatches(localMatchName, candidate)) {
-                    continue;
-                }
-                if (uniqueRfNameMatch != nullptr) {
-                    uniqueRfNameMatch = nullptr;
-                    break;
-                }
-                uniqueRfNameMatch = &candidate;
-            }
-            matchedChannel = uniqueRfNameMatch;
-        }
-
-        if (matchedChannel == nullptr && hint.virtualMajor > 0) {
-            const SchedulesDirectChannelPayload *uniqueMajorNameMatch = nullptr;
-            for (const SchedulesDirectChannelPayload &candidate : sdChannels) {
-                if (candidate.virtualMajor != hint.virtualMajor
-                    || !schedulesDirectLocalNameMatches(localMatchName, candidate)) {
-                    continue;
-                }
-                if (uniqueMajorNameMatch != nullptr) {
-                    uniqueMajorNameMatch = nullptr;
-                    break;
-                }
-                uniqueMajorNameMatch = &candidate;
-            }
-            matchedChannel = uniqueMajorNameMatch;
-        }
-
-        if (matchedChannel == nullptr && hint.rfChannel > 0) {
-            const SchedulesDirectChannelPayload *onlyRfMatch = nullptr;
-            for (const SchedulesDirectChannelPayload &candidate : sdChannels) {
-                if (candidate.rfChannel != hint.rfChannel) {
-                    continue;
-                }
-                if (onlyRfMatch != nullptr) {
-                    onlyRfMatch = nullptr;
-                    break;
-                }
-                onlyRfMatch = &candidate;
+        auto cachedMatchIt = channelIndex.schedulesDirectMatchByName.constFind(localName);
+        if (cachedMatchIt == channelIndex.schedulesDirectMatchByName.cend()) {
+            bool missingExactSubchannel = false;
+            const int match =
+                matchSchedulesDirectChannel(lookup, channelIndex.identities.at(localIndex), &missingExactSubchannel);
+            if (missingExactSubchannel) {
+                appendLog(QString("guide-sd: no exact subchannel match for %1; skipping loose fallback mapping.")
+                              .arg(localName));
             }
-            matchedChannel = onlyRfMatch;
+            cachedMatchIt = channelIndex.schedulesDirectMatchByName.insert(localName, match);
         }
-
-        if (matchedChannel == nullptr) {
+        if (cachedMatchIt.value() < 0) {
             appendUnique(unmatchedChannels, localName);
             continue;
         }
+        const SchedulesDirectChannelPayload *matchedChannel = &sdChannels.at(cachedMatchIt.value());
 
         const QList<TvGuideEntry> cleanedEntries =
             cleanGuideEntries(matchedChannel->entries, nowUtc, retentionHours, latestEndUtc);
@@ -8080,6 +9953,7 @@ void MainWindow::applyGuideRefreshIntervalSetting()
 void MainWindow::clearLoadedGuideCache()
 {
     guideEntriesCache_.clear();
+    invalidateFavoriteShowIndex();
     guideEntriesFullCache_.clear();
     guideCacheCoverageEndUtc_ = QDateTime();
     lastGuideChannelOrder_.clear();
@@ -8360,25 +10234,19 @@ bool MainWindow::handlePlaybackKeyBinding(QKeyEvent *keyEvent)
 
 bool MainWindow::stepChannelSelection(int direction)
 {
-    if (channelsTable_ == nullptr || direction == 0 || channelsTable_->rowCount() <= 0) {
+    const int rowCount = channelsModel_ != nullptr ? channelsModel_->rowCount() : 0;
+    if (channelsTable_ == nullptr || direction == 0 || rowCount <= 0) {
         return false;
     }
 
     int currentRow = -1;
     const QString normalizedCurrentLine = normalizeZapLine(currentChannelLine_).trimmed();
     if (!normalizedCurrentLine.isEmpty()) {
-        for (int row = 0; row < channelsTable_->rowCount(); ++row) {
-            QTableWidgetItem *rawLineItem = channelsTable_->item(row, kChannelTableRawLineColumn);
-            if (rawLineItem != nullptr
-                && normalizeZapLine(rawLineItem->text()).trimmed() == normalizedCurrentLine) {
-                currentRow = row;
-                break;
-            }
-        }
+        currentRow = channelsModel_->rowForLine(normalizedCurrentLine);
     }
 
     if (currentRow < 0) {
-        currentRow = channelsTable_->currentRow();
+        currentRow = channelsTable_->currentIndex().row();
     }
     if (currentRow < 0 && channelsTable_->selectionModel() != nullptr) {
         const QModelIndexList rows = channelsTable_->selectionModel()->selectedRows();
@@ -8389,9 +10257,9 @@ bool MainWindow::stepChannelSelection(int direction)
 
     int targetRow = currentRow;
     if (targetRow < 0) {
-        targetRow = direction > 0 ? 0 : channelsTable_->rowCount() - 1;
+        targetRow = direction > 0 ? 0 : rowCount - 1;
     } else {
-        targetRow = std::clamp(currentRow + direction, 0, channelsTable_->rowCount() - 1);
+        targetRow = std::clamp(currentRow + direction, 0, rowCount - 1);
     }
 
     if (targetRow == currentRow && currentRow >= 0) {
@@ -8400,16 +10268,12 @@ bool MainWindow::stepChannelSelection(int direction)
         return false;
     }
 
-    QTableWidgetItem *channelItem = channelsTable_->item(targetRow, kChannelTableNameColumn);
-    QTableWidgetItem *rawLineItem = channelsTable_->item(targetRow, kChannelTableRawLineColumn);
-    if (channelItem == nullptr || rawLineItem == nullptr) {
-        return false;
-    }
-
+    const ChannelTableRow &targetChannel = channelsModel_->rowAt(targetRow);
+    const QModelIndex targetIndex = channelsModel_->index(targetRow, kChannelTableNameColumn);
     channelsTable_->selectRow(targetRow);
-    channelsTable_->setCurrentCell(targetRow, kChannelTableNameColumn);
-    channelsTable_->scrollToItem(channelItem, QAbstractItemView::PositionAtCenter);
-    return startWatchingChannel(channelItem->text().trimmed(), false, normalizeZapLine(rawLineItem->text()).trimmed());
+    channelsTable_->setCurrentIndex(targetIndex);
+    channelsTable_->scrollTo(targetIndex, QAbstractItemView::PositionAtCenter);
+    return startWatchingChannel(targetChannel.label.trimmed(), false, normalizeZapLine(targetChannel.rawLine).trimmed());
 }
 
 void MainWindow::adjustVolumeByDelta(int delta)
@@ -8597,7 +10461,7 @@ void MainWindow::refreshScheduledSwitchList()
     scheduledSwitchesList_->clear();
     QStringList labels;
     labels.reserve(scheduledSwitches_.size());
-    for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_) {
+    for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_.items()) {
         const TvGuideScheduledSwitch normalizedSwitch = normalizedScheduledSwitch(scheduledSwitch);
         const QString displayTitle = normalizedSwitch.title.trimmed().isEmpty()
                                          ? normalizedSwitch.channelName.trimmed()
@@ -8810,12 +10674,13 @@ bool MainWindow::removeFavoriteShowRule(const QString &title)
     favoriteShowRules_.removeAt(row);
     favoriteShowRatings_.remove(normalizedRemovedRule);
     int removedScheduledSwitchCount = 0;
-    for (int index = scheduledSwitches_.size() - 1; index >= 0; --index) {
-        if (normalizeFavoriteShowRule(scheduledSwitches_.at(index).title) != normalizedRemovedRule) {
+    const QList<TvGuideScheduledSwitch> queuedSwitches = scheduledSwitches_.items();
+    for (const TvGuideScheduledSwitch &scheduledSwitch : queuedSwitches) {
+        if (normalizeFavoriteShowRule(scheduledSwitch.title) != normalizedRemovedRule) {
             continue;
         }
 
-        scheduledSwitches_.removeAt(index);
+        scheduledSwitches_.remove(scheduledSwitchKey(scheduledSwitch));
         ++removedScheduledSwitchCount;
     }
     saveFavoriteShowRules();
@@ -8842,6 +10707,7 @@ void MainWindow::handleCurrentTabChanged(int index)
         return;
     }
 
+    ensureTabPageBuilt(tabs_->widget(index));
     applyKeyBindings();
 
     if (tabs_->widget(index) == keyBindingsPage_) {
@@ -8868,12 +10734,16 @@ void MainWindow::handleCurrentTabChanged(int index)
         });
     }
 
+    if (logOutput_ != nullptr && tabs_->widget(index) == logsPage_) {
+        scheduleLogViewFlush();
+    }
+
     if (scheduledSwitchListRefreshPending_ && scheduledSwitchesList_ != nullptr
         && scheduledSwitchesList_->isVisibleTo(this)) {
         refreshScheduledSwitchList();
     }
 
-    if (tabs_->widget(index) == tvGuideDialog_ && tvGuideDialog_ != nullptr) {
+    if (tabs_->widget(index) == tvGuidePage_ && tvGuideDialog_ != nullptr) {
         tvGuideDialog_->syncToCurrentTime();
         const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
         const bool cacheLooksCurrent =
@@ -8973,7 +10843,7 @@ void MainWindow::attachVideoFromPip()
     syncFullscreenOverlayState();
 }
 
-bool MainWindow::purgeExpiredGuideCacheFiles(bool clearLoadedState, bool includeSchedulesDirect)
+bool MainWindow::purgeExpiredSchedulesDirectExports()
 {
     const int retentionHours = guideCacheRetentionHoursValue(guideCacheRetentionCombo_);
     if (retentionHours <= 0) {
@@ -8981,42 +10851,34 @@ bool MainWindow::purgeExpiredGuideCacheFiles(bool clearLoadedState, bool include
     }
 
     const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-    bool updatedPrimaryCache = false;
     bool removedAny = false;
-    const QString primaryCachePath = resolveGuideCachePath();
-    if (pruneGuideCacheFile(primaryCachePath, nowUtc, retentionHours)) {
-        updatedPrimaryCache = true;
+    const QString schedulesDirectExportPath = resolveSchedulesDirectExportPath();
+    if (pruneGuideCacheFile(schedulesDirectExportPath, nowUtc, retentionHours)) {
         removedAny = true;
     }
 
-    if (includeSchedulesDirect) {
-        const QString schedulesDirectExportPath = resolveSchedulesDirectExportPath();
-        if (pruneGuideCacheFile(schedulesDirectExportPath, nowUtc, retentionHours)) {
-            removedAny = true;
-        }
-
-        const QString legacySchedulesDirectExportPath = resolveLegacySchedulesDirectExportPath();
-        if (legacySchedulesDirectExportPath != schedulesDirectExportPath
-            && pruneGuideCacheFile(legacySchedulesDirectExportPath, nowUtc, retentionHours)) {
-            removedAny = true;
-        }
+    const QString legacySchedulesDirectExportPath = resolveLegacySchedulesDirectExportPath();
+    if (legacySchedulesDirectExportPath != schedulesDirectExportPath
+        && pruneGuideCacheFile(legacySchedulesDirectExportPath, nowUtc, retentionHours)) {
+        removedAny = true;
     }
 
-    if (updatedPrimaryCache && clearLoadedState) {
-        clearLoadedGuideCache();
-    }
     if (removedAny) {
         showTransientStatusBarMessage("Cleaning up TV Guide cache", 3000);
     }
     return removedAny;
 }
 
-bool MainWindow::saveScheduledSwitches() const
+bool MainWindow::saveScheduledSwitches()
 {
+    const QList<ScheduledSwitchQueue::JournalEntry> journal = scheduledSwitches_.takeJournal();
     const QString schedulePath = resolveGuideSchedulePath();
     if (schedulePath.isEmpty()) {
         return false;
     }
+    if (journal.isEmpty()) {
+        return true;
+    }
 
     QFileInfo scheduleInfo(schedulePath);
     QDir scheduleDir = scheduleInfo.dir();
@@ -9024,127 +10886,103 @@ bool MainWindow::saveScheduledSwitches() const
         return false;
     }
 
-    QJsonObject root;
-    root.insert("version", 1);
-    root.insert("savedUtc", QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs));
-
-    QJsonArray switchesArray;
-    for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_) {
-        switchesArray.append(scheduledSwitchToJsonObject(scheduledSwitch));
+    QByteArray payload;
+    for (const ScheduledSwitchQueue::JournalEntry &entry : journal) {
+        payload += scheduledSwitchJournalLine(entry);
     }
-    root.insert("switches", switchesArray);
-
-    QSaveFile scheduleFile(schedulePath);
-    if (!scheduleFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+    QFile journalFile(scheduledSwitchJournalPath(schedulePath));
+    const bool appended = journalFile.open(QIODevice::WriteOnly | QIODevice::Append)
+                          && journalFile.write(payload) == payload.size();
+    journalFile.close();
+    if (!appended) {
+        // The changes are gone from the journal, so only a full snapshot can persist them now.
+        appendLog(QString("schedule: could not append to %1; writing a full snapshot").arg(journalFile.fileName()));
+        scheduledSwitchJournalEntries_ = kScheduledSwitchJournalCompactEntries;
+        compactScheduledSwitchesInBackground();
         return false;
     }
-    const QByteArray payload = QJsonDocument(root).toJson(QJsonDocument::Indented);
-    if (scheduleFile.write(payload) != payload.size()) {
-        scheduleFile.cancelWriting();
-        return false;
+
+    scheduledSwitchJournalEntries_ += static_cast<int>(journal.size());
+    if (scheduledSwitchJournalEntries_ >= kScheduledSwitchJournalCompactEntries) {
+        compactScheduledSwitchesInBackground();
     }
-    return scheduleFile.commit();
+    return true;
 }
 
-bool MainWindow::loadScheduledSwitches()
+void MainWindow::compactScheduledSwitchesInBackground()
 {
-    scheduledSwitches_.clear();
-    refreshScheduledSwitchList();
+    // Until the file has been loaded the queue only holds switches added since startup.
+    if (!scheduledSwitchesLoaded_) {
+        return;
+    }
+    if (scheduledSwitchCompaction_.isRunning()) {
+        scheduledSwitchCompactionPending_ = true;
+        return;
+    }
 
     const QString schedulePath = resolveGuideSchedulePath();
     if (schedulePath.isEmpty()) {
-        return false;
+        return;
     }
+    const QString journalPath = scheduledSwitchJournalPath(schedulePath);
+    const qint64 compactedBytes = QFileInfo(journalPath).size();
+    scheduledSwitchCompaction_ = QtConcurrent::run(&writeScheduledSwitchesSnapshot,
+                                                   schedulePath,
+                                                   scheduledSwitches_.items());
 
-    QFile scheduleFile(schedulePath);
-    if (!scheduleFile.exists()) {
-        return false;
-    }
-    if (!scheduleFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        return false;
-    }
+    auto *watcher = new QFutureWatcher<bool>(this);
+    connect(watcher, &QFutureWatcher<bool>::finished, this, [this, watcher, journalPath, compactedBytes]() {
+        watcher->deleteLater();
+        if (!watcher->result()) {
+            appendLog("schedule: could not write the scheduled switch snapshot");
+            scheduledSwitchCompactionPending_ = false;
+            return;
+        }
+        const int remainingEntries = trimScheduledSwitchJournal(journalPath, compactedBytes);
+        if (remainingEntries >= 0) {
+            scheduledSwitchJournalEntries_ = remainingEntries;
+        }
+        if (std::exchange(scheduledSwitchCompactionPending_, false)) {
+            compactScheduledSwitchesInBackground();
+        }
+    });
+    watcher->setFuture(scheduledSwitchCompaction_);
+}
 
-    QJsonParseError parseError{};
-    const QJsonDocument document = QJsonDocument::fromJson(scheduleFile.readAll(), &parseError);
-    if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
-        return false;
+void MainWindow::applyLoadedScheduledSwitches(const QList<TvGuideScheduledSwitch> &loadedSwitches)
+{
+    // Anything scheduled while the file was still loading is kept and has already been journaled.
+    for (const TvGuideScheduledSwitch &scheduledSwitch : loadedSwitches) {
+        scheduledSwitches_.restore(scheduledSwitchKey(scheduledSwitch), scheduledSwitch);
     }
-
-    scheduledSwitches_ = scheduledSwitchesFromJsonArray(document.object().value("switches").toArray());
-    appendLog(QString("schedule: loaded %1 switch(es) from disk").arg(scheduledSwitches_.size()));
+    appendLog(QString("schedule: loaded %1 switch(es) from disk").arg(loadedSwitches.size()));
     const bool pruned = pruneExpiredScheduledSwitches(false);
     if (pruned) {
         saveScheduledSwitches();
         showTransientStatusBarMessage("Pruning scheduled tunes", 3000);
-        appendLog(QString("schedule: pruned expired/duplicate switches after load; %1 remain")
+        appendLog(QString("schedule: pruned expired switches after load; %1 remain")
                       .arg(scheduledSwitches_.size()));
     }
     refreshScheduledSwitchList();
-    return !scheduledSwitches_.isEmpty();
 }
 
 bool MainWindow::pruneExpiredScheduledSwitches(bool includeStartedSwitches)
 {
+    // Switches are normalized and deduplicated on insert and ordered by start, so only the started prefix can
+    // hold anything to drop.
     const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-    QList<TvGuideScheduledSwitch> cleaned;
-    cleaned.reserve(scheduledSwitches_.size());
-    QSet<QString> seenScheduledSwitchKeys;
-    seenScheduledSwitchKeys.reserve(scheduledSwitches_.size());
     bool changed = false;
-
-    std::sort(scheduledSwitches_.begin(), scheduledSwitches_.end(), [](const TvGuideScheduledSwitch &left,
-                                                                       const TvGuideScheduledSwitch &right) {
-        if (left.startUtc == right.startUtc) {
-            return left.channelName < right.channelName;
-        }
-        return left.startUtc < right.startUtc;
-    });
-
-    for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_) {
-        const TvGuideScheduledSwitch normalizedSwitch = normalizedScheduledSwitch(scheduledSwitch);
-        if (!scheduledSwitchesMatch(scheduledSwitch, normalizedSwitch)) {
-            changed = true;
-        }
-        if (normalizedSwitch.channelName.isEmpty()
-            || !normalizedSwitch.startUtc.isValid()
-            || !normalizedSwitch.endUtc.isValid()
-            || normalizedSwitch.endUtc <= normalizedSwitch.startUtc
-            || (includeStartedSwitches && normalizedSwitch.startUtc <= nowUtc)
-            || normalizedSwitch.endUtc <= nowUtc) {
-            changed = true;
-            continue;
-        }
-
-        const QString switchKey = scheduledSwitchKey(normalizedSwitch);
-        if (switchKey.isEmpty() || seenScheduledSwitchKeys.contains(switchKey)) {
-            changed = true;
-            continue;
+    for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_.startedBy(nowUtc)) {
+        if (includeStartedSwitches || scheduledSwitch.endUtc <= nowUtc) {
+            changed = scheduledSwitches_.remove(scheduledSwitchKey(scheduledSwitch)) || changed;
         }
-        seenScheduledSwitchKeys.insert(switchKey);
-        cleaned.append(normalizedSwitch);
-    }
-
-    if (cleaned.size() != scheduledSwitches_.size()) {
-        changed = true;
     }
-    scheduledSwitches_ = cleaned;
     return changed;
 }
 
 bool MainWindow::hasActiveScheduledSwitchesNow() const
 {
-    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-    for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_) {
-        const QDateTime effectiveStartUtc = scheduledSwitchEffectiveStartUtc(scheduledSwitch);
-        const QDateTime effectiveEndUtc = scheduledSwitchEffectiveEndUtc(scheduledSwitch);
-        if (!effectiveStartUtc.isValid() || !effectiveEndUtc.isValid() || effectiveEndUtc <= effectiveStartUtc) {
-            continue;
-        }
-        if (effectiveStartUtc <= nowUtc && nowUtc < effectiveEndUtc) {
-            return true;
-        }
-    }
-    return false;
+    return !scheduledSwitches_.activeAt(QDateTime::currentDateTimeUtc()).isEmpty();
 }
 
 void MainWindow::refreshScheduledSwitchTimer()
@@ -9163,20 +11001,24 @@ void MainWindow::refreshScheduledSwitchTimer()
 
     scheduledSwitchTimer_->stop();
     if (scheduledSwitches_.isEmpty()) {
-        appendLog(QString("schedule: timer idle obey=%1 queue=%2")
-                      .arg(obeyScheduledSwitches_ ? "true" : "false",
-                           summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+        logRecord(LogCategory::Schedule, LogLevel::Debug, [&]() {
+            return QString("schedule: timer idle obey=%1 queue=%2")
+                .arg(obeyScheduledSwitches_ ? "true" : "false",
+                     summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+        });
         return;
     }
 
     const QDateTime nextStartUtc = scheduledSwitchEffectiveStartUtc(scheduledSwitches_.first());
     const qint64 delayMs = std::max<qint64>(0, QDateTime::currentDateTimeUtc().msecsTo(nextStartUtc));
     scheduledSwitchTimer_->start(static_cast<int>(std::min<qint64>(delayMs, std::numeric_limits<int>::max())));
-    appendLog(QString("schedule: timer armed mode=%1 next=%2 delayMs=%3 queue=%4")
-                  .arg(obeyScheduledSwitches_ ? "switch" : "cleanup")
-                  .arg(nextStartUtc.toLocalTime().toString("ddd h:mm:ss AP"))
-                  .arg(delayMs)
-                  .arg(summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+    logRecord(LogCategory::Schedule, LogLevel::Debug, [&]() {
+        return QString("schedule: timer armed mode=%1 next=%2 delayMs=%3 queue=%4")
+            .arg(obeyScheduledSwitches_ ? "switch" : "cleanup")
+            .arg(nextStartUtc.toLocalTime().toString("ddd h:mm:ss AP"))
+            .arg(delayMs)
+            .arg(summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
 }
 
 void MainWindow::processScheduledSwitches()
@@ -9190,34 +11032,23 @@ void MainWindow::processScheduledSwitches()
     }
 
     if (scheduledSwitches_.isEmpty()) {
-        appendLog(QString("schedule: process skipped obey=%1 queue=%2")
-                      .arg(obeyScheduledSwitches_ ? "true" : "false",
-                           summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+        logRecord(LogCategory::Schedule, LogLevel::Debug, [&]() {
+            return QString("schedule: process skipped obey=%1 queue=%2")
+                .arg(obeyScheduledSwitches_ ? "true" : "false",
+                     summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+        });
         refreshScheduledSwitchTimer();
         return;
     }
 
     const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-    appendLog(QString("schedule: process begin now=%1 queue=%2")
-                  .arg(nowUtc.toLocalTime().toString("ddd h:mm:ss AP"))
-                  .arg(summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+    logRecord(LogCategory::Schedule, LogLevel::Debug, [&]() {
+        return QString("schedule: process begin now=%1 queue=%2")
+            .arg(nowUtc.toLocalTime().toString("ddd h:mm:ss AP"))
+            .arg(summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
     showTransientStatusBarMessage("Checking scheduled switches", 3000);
-    QList<TvGuideScheduledSwitch> activeSwitches;
-    for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_) {
-        const QDateTime effectiveStartUtc = scheduledSwitchEffectiveStartUtc(scheduledSwitch);
-        const QDateTime effectiveEndUtc = scheduledSwitchEffectiveEndUtc(scheduledSwitch);
-        if (effectiveStartUtc > nowUtc) {
-            appendLog(QString("schedule: next pending switch is still in the future -> %1")
-                          .arg(scheduledSwitchDebugLabel(scheduledSwitch)));
-            break;
-        }
-        if (effectiveEndUtc <= nowUtc) {
-            appendLog(QString("schedule: skipping already-ended switch during process -> %1")
-                          .arg(scheduledSwitchDebugLabel(scheduledSwitch)));
-            continue;
-        }
-        activeSwitches.append(scheduledSwitch);
-    }
+    const QList<TvGuideScheduledSwitch> activeSwitches = scheduledSwitches_.activeAt(nowUtc);
     if (activeSwitches.isEmpty()) {
         refreshScheduledSwitchTimer();
         return;
@@ -9226,14 +11057,7 @@ void MainWindow::processScheduledSwitches()
     auto removeDueSwitches = [this](const QList<TvGuideScheduledSwitch> &dueSwitches) {
         bool removed = false;
         for (const TvGuideScheduledSwitch &dueSwitch : dueSwitches) {
-            for (int index = scheduledSwitches_.size() - 1; index >= 0; --index) {
-                if (!scheduledSwitchesMatch(scheduledSwitches_.at(index), dueSwitch)) {
-                    continue;
-                }
-                scheduledSwitches_.removeAt(index);
-                removed = true;
-                break;
-            }
+            removed = scheduledSwitches_.remove(scheduledSwitchKey(dueSwitch)) || removed;
         }
         if (!removed) {
             return false;
@@ -9246,9 +11070,11 @@ void MainWindow::processScheduledSwitches()
     };
 
     if (!obeyScheduledSwitches_) {
-        appendLog(QString("schedule: removing %1 due switch(es) while obey is disabled -> %2")
-                      .arg(activeSwitches.size())
-                      .arg(summarizeScheduledSwitchesDebug(activeSwitches)));
+        logRecord(LogCategory::Schedule, LogLevel::Info, [&]() {
+            return QString("schedule: removing %1 due switch(es) while obey is disabled -> %2")
+                .arg(activeSwitches.size())
+                .arg(summarizeScheduledSwitchesDebug(activeSwitches));
+        });
         showTransientStatusBarMessage(activeSwitches.size() == 1
                                           ? QString("Scheduled switch expired while obey was off: %1")
                                                 .arg(activeSwitches.first().channelName)
@@ -9271,9 +11097,11 @@ void MainWindow::processScheduledSwitches()
     }
 
     if (currentChannelName_.startsWith("File: ")) {
-        appendLog(QString("schedule: local file playback active; ignoring and pruning %1 due switch(es) -> %2")
-                      .arg(activeSwitches.size())
-                      .arg(summarizeScheduledSwitchesDebug(activeSwitches)));
+        logRecord(LogCategory::Schedule, LogLevel::Info, [&]() {
+            return QString("schedule: local file playback active; ignoring and pruning %1 due switch(es) -> %2")
+                .arg(activeSwitches.size())
+                .arg(summarizeScheduledSwitchesDebug(activeSwitches));
+        });
         showTransientStatusBarMessage(activeSwitches.size() == 1
                                           ? QString("Local file playing; ignored scheduled tune: %1")
                                                 .arg(activeSwitches.first().channelName)
@@ -9285,8 +11113,10 @@ void MainWindow::processScheduledSwitches()
     }
 
     if (activeSwitches.size() > 1) {
-        appendLog(QString("schedule: runtime conflict for active switches -> %1")
-                      .arg(summarizeScheduledSwitchesDebug(activeSwitches)));
+        logRecord(LogCategory::Schedule, LogLevel::Info, [&]() {
+            return QString("schedule: runtime conflict for active switches -> %1")
+                .arg(summarizeScheduledSwitchesDebug(activeSwitches));
+        });
         const bool resolved = resolveScheduledSwitchChoices(activeSwitches,
                                                             "runtime schedule:",
                                                             !favoriteShowRatingsOverrideEnabled_);
@@ -9302,14 +11132,8 @@ void MainWindow::processScheduledSwitches()
     }
 
     const TvGuideScheduledSwitch scheduledSwitch = activeSwitches.first();
-    int scheduledSwitchIndex = -1;
-    for (int index = 0; index < scheduledSwitches_.size(); ++index) {
-        if (scheduledSwitchesMatch(scheduledSwitches_.at(index), scheduledSwitch)) {
-            scheduledSwitchIndex = index;
-            break;
-        }
-    }
-    if (scheduledSwitchIndex < 0) {
+    const QString activeSwitchKey = scheduledSwitchKey(scheduledSwitch);
+    if (!scheduledSwitches_.contains(activeSwitchKey)) {
         refreshScheduledSwitchTimer();
         return;
     }
@@ -9320,7 +11144,7 @@ void MainWindow::processScheduledSwitches()
         showTransientStatusBarMessage(QString("Scheduled switch already satisfied: %1")
                                           .arg(scheduledSwitch.channelName),
                                       3000);
-        scheduledSwitches_.removeAt(scheduledSwitchIndex);
+        scheduledSwitches_.remove(activeSwitchKey);
         saveScheduledSwitches();
         refreshScheduledSwitchList();
         updateTvGuideDialogFromCurrentCache(false);
@@ -9334,7 +11158,7 @@ void MainWindow::processScheduledSwitches()
     }
 
     const bool startedWatching = startWatchingChannel(scheduledSwitch.channelName, false);
-    scheduledSwitches_.removeAt(scheduledSwitchIndex);
+    scheduledSwitches_.remove(activeSwitchKey);
     saveScheduledSwitches();
     refreshScheduledSwitchList();
     updateTvGuideDialogFromCurrentCache(false);
@@ -9381,26 +11205,24 @@ bool MainWindow::resolveScheduledSwitchChoices(const QList<TvGuideScheduledSwitc
         return false;
     }
 
-    appendLog(QString("%1 resolve begin prompt=%2 candidates=%3 existing=%4")
-                  .arg(sourceDescription,
-                       promptForConflict ? "true" : "false",
-                       summarizeScheduledSwitchesDebug(uniqueCandidates),
-                       summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+    logRecord(LogCategory::Schedule, LogLevel::Debug, [&]() {
+        return QString("%1 resolve begin prompt=%2 candidates=%3 existing=%4")
+            .arg(sourceDescription,
+                 promptForConflict ? "true" : "false",
+                 summarizeScheduledSwitchesDebug(uniqueCandidates),
+                 summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
 
     QList<ScheduledSwitchChoiceOption> choices;
-    QSet<int> relevantExistingIndexSet;
+    QStringList relevantExistingKeys;
     for (const TvGuideScheduledSwitch &candidate : uniqueCandidates) {
-        int existingIndex = -1;
-        for (int index = 0; index < scheduledSwitches_.size(); ++index) {
-            if (!scheduledSwitchesMatch(scheduledSwitches_.at(index), candidate)) {
-                continue;
-            }
-            existingIndex = index;
-            relevantExistingIndexSet.insert(index);
-            break;
+        const QString candidateKey = scheduledSwitchKey(candidate);
+        const bool isExisting = scheduledSwitches_.contains(candidateKey);
+        if (isExisting && !relevantExistingKeys.contains(candidateKey)) {
+            relevantExistingKeys.append(candidateKey);
         }
 
-        choices.append(ScheduledSwitchChoiceOption{candidate, existingIndex >= 0, existingIndex});
+        choices.append(ScheduledSwitchChoiceOption{candidate, isExisting, isExisting ? candidateKey : QString()});
     }
 
     if (choices.isEmpty()) {
@@ -9646,16 +11468,14 @@ bool MainWindow::resolveScheduledSwitchChoices(const QList<TvGuideScheduledSwitc
     }
     bool changed = false;
 
-    QList<int> relevantExistingIndexes = relevantExistingIndexSet.values();
-    std::sort(relevantExistingIndexes.begin(), relevantExistingIndexes.end(), std::greater<int>());
-    for (const int index : relevantExistingIndexes) {
-        if (chosen.isExisting && index == chosen.existingIndex) {
+    for (const QString &existingKey : std::as_const(relevantExistingKeys)) {
+        if (chosen.isExisting && existingKey == chosen.existingKey) {
             continue;
         }
-        if (index < 0 || index >= scheduledSwitches_.size()) {
+        if (!scheduledSwitches_.contains(existingKey)) {
             continue;
         }
-        const TvGuideScheduledSwitch &existingSwitch = scheduledSwitches_.at(index);
+        const TvGuideScheduledSwitch existingSwitch = scheduledSwitches_.value(existingKey);
         if (!scheduledSwitchesMatch(existingSwitch, chosen.scheduledSwitch)
             && !scheduledSwitchesOverlap(existingSwitch, chosen.scheduledSwitch)) {
             appendLog(QString("%1 kept non-overlapping switch %2 while resolving %3")
@@ -9666,22 +11486,12 @@ bool MainWindow::resolveScheduledSwitchChoices(const QList<TvGuideScheduledSwitc
         }
         appendLog(QString("%1 removed conflicting switch %2")
                       .arg(sourceDescription, scheduledSwitchLabel(existingSwitch)));
-        scheduledSwitches_.removeAt(index);
+        scheduledSwitches_.remove(existingKey);
         changed = true;
     }
 
-    if (!chosen.isExisting) {
-        bool alreadyScheduled = false;
-        for (const TvGuideScheduledSwitch &existing : scheduledSwitches_) {
-            if (scheduledSwitchesMatch(existing, chosen.scheduledSwitch)) {
-                alreadyScheduled = true;
-                break;
-            }
-        }
-        if (!alreadyScheduled) {
-            scheduledSwitches_.append(chosen.scheduledSwitch);
-            changed = true;
-        }
+    if (!chosen.isExisting && queueScheduledSwitch(scheduledSwitches_, chosen.scheduledSwitch)) {
+        changed = true;
     }
 
     if (!changed) {
@@ -9693,18 +11503,13 @@ bool MainWindow::resolveScheduledSwitchChoices(const QList<TvGuideScheduledSwitc
             }
         }
         appendLog(QString("%1 kept %2").arg(sourceDescription, scheduledSwitchLabel(chosen.scheduledSwitch)));
-        appendLog(QString("%1 resolve queue unchanged -> %2")
-                      .arg(sourceDescription, summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+        logRecord(LogCategory::Schedule, LogLevel::Debug, [&]() {
+            return QString("%1 resolve queue unchanged -> %2")
+                .arg(sourceDescription, summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+        });
         return true;
     }
 
-    std::sort(scheduledSwitches_.begin(), scheduledSwitches_.end(), [](const TvGuideScheduledSwitch &left,
-                                                                       const TvGuideScheduledSwitch &right) {
-        if (left.startUtc == right.startUtc) {
-            return left.channelName < right.channelName;
-        }
-        return left.startUtc < right.startUtc;
-    });
     if (persistConflictChoice) {
         savePersistedAutoFavoriteConflictState(cacheStamp, dismissedAutoFavoriteCandidates_);
     }
@@ -9713,8 +11518,10 @@ bool MainWindow::resolveScheduledSwitchChoices(const QList<TvGuideScheduledSwitc
     updateTvGuideDialogFromCurrentCache(false);
     refreshScheduledSwitchTimer();
     appendLog(QString("%1 kept %2").arg(sourceDescription, scheduledSwitchLabel(chosen.scheduledSwitch)));
-    appendLog(QString("%1 resolve queue after -> %2")
-                  .arg(sourceDescription, summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+    logRecord(LogCategory::Schedule, LogLevel::Debug, [&]() {
+        return QString("%1 resolve queue after -> %2")
+            .arg(sourceDescription, summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
     return true;
 }
 
@@ -9732,28 +11539,29 @@ bool MainWindow::addScheduledSwitchCandidate(const TvGuideScheduledSwitch &candi
         return false;
     }
 
-    if (scheduledSwitchListContains(scheduledSwitches_, normalizedCandidate)) {
+    if (!queueScheduledSwitch(scheduledSwitches_, normalizedCandidate)) {
         appendLog(QString("%1 skipped duplicate queued switch %2")
                       .arg(sourceDescription, scheduledSwitchLabel(normalizedCandidate)));
         return false;
     }
+    const qsizetype overlapCount =
+        scheduledSwitches_.overlapping(normalizedCandidate.startUtc, normalizedCandidate.endUtc).size() - 1;
+    if (overlapCount > 0) {
+        appendLog(QString("%1 %2 overlaps %3 queued switch(es); the conflict is settled at airtime")
+                      .arg(sourceDescription, scheduledSwitchLabel(normalizedCandidate))
+                      .arg(overlapCount));
+    }
 
-    scheduledSwitches_.append(normalizedCandidate);
-    std::sort(scheduledSwitches_.begin(), scheduledSwitches_.end(), [](const TvGuideScheduledSwitch &left,
-                                                                       const TvGuideScheduledSwitch &right) {
-        if (left.startUtc == right.startUtc) {
-            return left.channelName < right.channelName;
-        }
-        return left.startUtc < right.startUtc;
-    });
     saveScheduledSwitches();
     refreshScheduledSwitchList();
     updateTvGuideDialogFromCurrentCache(false);
     applyCurrentShowStatusFromGuideCache();
     refreshScheduledSwitchTimer();
     appendLog(QString("%1 queued %2").arg(sourceDescription, scheduledSwitchLabel(candidate)));
-    appendLog(QString("%1 queue after -> %2")
-                  .arg(sourceDescription, summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+    logRecord(LogCategory::Schedule, LogLevel::Debug, [&]() {
+        return QString("%1 queue after -> %2")
+            .arg(sourceDescription, summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
     return true;
 }
 
@@ -9764,8 +11572,6 @@ void MainWindow::scheduleMatchingGuideEntriesForTitle(const QString &favoriteSho
 {
     Q_UNUSED(promptForConflict);
 
-    const QHash<QString, QList<TvGuideEntry>> &guideEntriesForScheduling =
-        guideEntriesFullCache_.isEmpty() ? guideEntriesCache_ : guideEntriesFullCache_;
     const QString normalizedTitle = normalizeFavoriteShowRule(favoriteShowTitle);
     const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
     QList<TvGuideScheduledSwitch> matchingCandidates;
@@ -9802,25 +11608,11 @@ void MainWindow::scheduleMatchingGuideEntriesForTitle(const QString &favoriteSho
     }
 
     if (!normalizedTitle.isEmpty()) {
-        QStringList orderedChannels = lastGuideChannelOrder_;
-        for (auto it = guideEntriesForScheduling.cbegin(); it != guideEntriesForScheduling.cend(); ++it) {
-            if (!orderedChannels.contains(it.key())) {
-                orderedChannels.append(it.key());
-            }
-        }
-
-        for (const QString &channelName : orderedChannels) {
-            const QList<TvGuideEntry> entries = guideEntriesForScheduling.value(channelName);
-            for (const TvGuideEntry &entry : entries) {
-                const TvGuideScheduledSwitch candidate = scheduledSwitchFromGuideEntry(channelName, entry);
-                if (!candidate.startUtc.isValid()
-                    || !candidate.endUtc.isValid()
-                    || candidate.endUtc <= candidate.startUtc
-                    || candidate.startUtc <= nowUtc
-                    || normalizeFavoriteShowRule(candidate.title) != normalizedTitle) {
-                    continue;
-                }
-                appendCandidate(candidate);
+        const FavoriteShowIndex &index = favoriteShowIndex();
+        const QList<TvGuideScheduledSwitch> occurrences = index.occurrencesByTitle.value(normalizedTitle);
+        for (const TvGuideScheduledSwitch &occurrence : occurrences) {
+            if (occurrence.startUtc > nowUtc) {
+                appendCandidate(occurrence);
             }
         }
     }
@@ -9849,31 +11641,16 @@ void MainWindow::scheduleMatchingGuideEntriesForTitle(const QString &favoriteSho
                                                       lastGuideWindowStartUtc_,
                                                       lastGuideSlotMinutes_,
                                                       lastGuideSlotCount_);
-    QSet<QString> existingScheduledKeys;
-    for (const TvGuideScheduledSwitch &existingSwitch : std::as_const(scheduledSwitches_)) {
-        existingScheduledKeys.insert(scheduledSwitchKey(existingSwitch));
-    }
-
     QList<TvGuideScheduledSwitch> addedCandidates;
     for (const TvGuideScheduledSwitch &candidate : matchingCandidates) {
-        const QString candidateKey = scheduledSwitchKey(candidate);
-        if (existingScheduledKeys.contains(candidateKey)) {
+        if (!queueScheduledSwitch(scheduledSwitches_, candidate)) {
             continue;
         }
-        scheduledSwitches_.append(candidate);
-        existingScheduledKeys.insert(candidateKey);
         addedCandidates.append(candidate);
         setAutoFavoriteDismissed(dismissedAutoFavoriteCandidates_, cacheStamp, candidate, false);
     }
 
     if (!addedCandidates.isEmpty()) {
-        std::sort(scheduledSwitches_.begin(), scheduledSwitches_.end(), [](const TvGuideScheduledSwitch &left,
-                                                                           const TvGuideScheduledSwitch &right) {
-            if (left.startUtc == right.startUtc) {
-                return left.channelName < right.channelName;
-            }
-            return left.startUtc < right.startUtc;
-        });
         saveScheduledSwitches();
         refreshScheduledSwitchList();
         updateTvGuideDialogFromCurrentCache(false);
@@ -9883,8 +11660,10 @@ void MainWindow::scheduleMatchingGuideEntriesForTitle(const QString &favoriteSho
                       .arg(addedCandidates.size())
                       .arg(addedCandidates.size() == 1 ? QString() : QString("es"))
                       .arg(showTitle));
-        appendLog(QString("%1 queue after -> %2")
-                      .arg(sourceDescription, summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+        logRecord(LogCategory::Schedule, LogLevel::Debug, [&]() {
+            return QString("%1 queue after -> %2")
+                .arg(sourceDescription, summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+        });
         showTransientStatusBarMessage(QString("Queued %1 switch%2 for %3")
                                           .arg(addedCandidates.size())
                                           .arg(addedCandidates.size() == 1 ? QString() : QString("es"))
@@ -9909,12 +11688,12 @@ void MainWindow::handleGuideScheduleToggle(const QString &channelName, const TvG
     }
 
     const TvGuideScheduledSwitch candidate = scheduledSwitchFromGuideEntry(trimmedChannelName, entry);
-    logInteraction("user",
-                   "schedule.guide-toggle",
-                   QString("enabled=%1 candidate=%2 queue-before=%3")
-                       .arg(enabled ? "true" : "false",
-                            scheduledSwitchDebugLabel(candidate),
-                            summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+    logInteractionLazy("user", "schedule.guide-toggle", LogLevel::Info, [&]() {
+        return QString("enabled=%1 candidate=%2 queue-before=%3")
+            .arg(enabled ? "true" : "false",
+                 scheduledSwitchDebugLabel(candidate),
+                 summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
 
     if (enabled) {
         if (candidate.startUtc <= QDateTime::currentDateTimeUtc()) {
@@ -9931,12 +11710,11 @@ void MainWindow::handleGuideScheduleToggle(const QString &channelName, const TvG
                                                           lastGuideSlotMinutes_,
                                                           lastGuideSlotCount_);
         bool removed = false;
-        for (int index = scheduledSwitches_.size() - 1; index >= 0; --index) {
-            if (!guideEntryMatchesScheduledSwitch(trimmedChannelName, entry, scheduledSwitches_.at(index))) {
+        for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_.startingAt(candidate.startUtc)) {
+            if (!guideEntryMatchesScheduledSwitch(trimmedChannelName, entry, scheduledSwitch)) {
                 continue;
             }
-            scheduledSwitches_.removeAt(index);
-            removed = true;
+            removed = scheduledSwitches_.remove(scheduledSwitchKey(scheduledSwitch)) || removed;
         }
         if (removed) {
             setAutoFavoriteDismissed(dismissedAutoFavoriteCandidates_, cacheStamp, candidate, true);
@@ -9949,9 +11727,9 @@ void MainWindow::handleGuideScheduleToggle(const QString &channelName, const TvG
 
     updateTvGuideDialogFromCurrentCache(false);
     refreshScheduledSwitchTimer();
-    logInteraction("program",
-                   "schedule.guide-toggle.complete",
-                   QString("queue-after=%1").arg(summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+    logInteractionLazy("program", "schedule.guide-toggle.complete", LogLevel::Debug, [&]() {
+        return QString("queue-after=%1").arg(summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
 }
 
 void MainWindow::handleGuideWatchRequested(const QString &channelName, const TvGuideEntry &entry)
@@ -9998,7 +11776,7 @@ void MainWindow::handleSearchScheduleRequested(const QString &favoriteShowTitle,
     const TvGuideScheduledSwitch candidate = scheduledSwitchFromGuideEntry(trimmedChannelName, entry);
 
     scheduleMatchingGuideEntriesForTitle(trimmedFavoriteTitle, candidate, "favorite-show:", false);
-    if (addedFavoriteRule && !scheduledSwitchListContains(scheduledSwitches_, candidate)) {
+    if (addedFavoriteRule && !scheduledSwitches_.contains(scheduledSwitchKey(candidate))) {
         updateTvGuideDialogFromCurrentCache(false);
     }
 }
@@ -10028,8 +11806,8 @@ void MainWindow::removeSelectedScheduledSwitch()
         return;
     }
 
-    const TvGuideScheduledSwitch removedSwitch = scheduledSwitches_.at(row);
-    scheduledSwitches_.removeAt(row);
+    const TvGuideScheduledSwitch removedSwitch = scheduledSwitches_.items().at(row);
+    scheduledSwitches_.remove(scheduledSwitchKey(removedSwitch));
     const QString cacheStamp = currentGuideCacheStamp(lastGuideCacheGeneratedUtc_,
                                                       lastGuideWindowStartUtc_,
                                                       lastGuideSlotMinutes_,
@@ -10066,87 +11844,72 @@ void MainWindow::autoScheduleFavoriteShowsFromGuideCache(bool promptForConflict,
                       .arg(currentCacheStamp)
                       .arg(dismissedAutoFavoriteCandidates_.size()));
     }
-    logInteraction("program",
-                   "favorite-show.auto.begin",
-                   QString("prompt=%1 force=%2 stamp=%3 favorites=%4 existing=%5")
-                       .arg(promptForConflict ? "true" : "false",
-                            forceCurrentCacheSearch ? "true" : "false",
-                            currentCacheStamp,
-                            favoriteShowRules_.join(" | "),
-                            summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+    logInteractionLazy("program", "favorite-show.auto.begin", LogLevel::Info, [&]() {
+        return QString("prompt=%1 force=%2 stamp=%3 favorites=%4 existing=%5")
+            .arg(promptForConflict ? "true" : "false",
+                 forceCurrentCacheSearch ? "true" : "false",
+                 currentCacheStamp,
+                 favoriteShowRules_.join(" | "),
+                 summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
 
     if (!forceCurrentCacheSearch
-        && !currentCacheStamp.isEmpty()
-        && currentCacheStamp == lastAutoFavoriteScheduleStamp_) {
-        appendLog(QString("favorite-show auto: skipped because stamp %1 already processed").arg(currentCacheStamp));
-        return;
-    }
-
-    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-    QStringList orderedChannels = lastGuideChannelOrder_;
-    for (auto it = guideEntriesForScheduling.cbegin(); it != guideEntriesForScheduling.cend(); ++it) {
-        if (!orderedChannels.contains(it.key())) {
-            orderedChannels.append(it.key());
-        }
-    }
-
-    const auto scheduledSwitchKey = [](const TvGuideScheduledSwitch &scheduledSwitch) {
-        const TvGuideScheduledSwitch normalized = normalizedScheduledSwitch(scheduledSwitch);
-        if (normalized.channelName.trimmed().isEmpty()
-            || !normalized.startUtc.isValid()
-            || !normalized.endUtc.isValid()
-            || normalized.endUtc <= normalized.startUtc) {
-            return QString();
-        }
-
-        return QString("%1|%2|%3|%4")
-            .arg(normalized.channelName,
-                 QString::number(normalized.startUtc.toSecsSinceEpoch()),
-                 QString::number(normalized.endUtc.toSecsSinceEpoch()),
-                 normalizeFavoriteShowRule(normalized.title));
-    };
+        && !currentCacheStamp.isEmpty()
+        && currentCacheStamp == lastAutoFavoriteScheduleStamp_) {
+        appendLog(QString("favorite-show auto: skipped because stamp %1 already processed").arg(currentCacheStamp));
+        return;
+    }
 
+    // Rules that were already matched against an earlier snapshot only need the occurrences that snapshot lacked;
+    // new rules and forced searches look at every occurrence.
+    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
+    FavoriteShowIndex &index = favoriteShowIndex();
     QList<TvGuideScheduledSwitch> matchedCandidates;
     QSet<QString> matchedCandidateKeys;
+    QSet<QString> processedRules;
+    QSet<QString> processedOccurrenceKeys;
     QStringList sampleMatches;
     int dismissedCandidateCount = 0;
+    int previouslySeenCount = 0;
     for (const QString &favoriteRule : favoriteShowRules_) {
         const QString normalizedRule = normalizeFavoriteShowRule(favoriteRule);
-        if (normalizedRule.isEmpty()) {
+        if (normalizedRule.isEmpty() || processedRules.contains(normalizedRule)) {
             continue;
         }
+        processedRules.insert(normalizedRule);
 
-        for (const QString &channelName : orderedChannels) {
-            const QList<TvGuideEntry> entries = guideEntriesForScheduling.value(channelName);
-            for (const TvGuideEntry &entry : entries) {
-                const TvGuideScheduledSwitch candidate = scheduledSwitchFromGuideEntry(channelName, entry);
-                if (!candidate.startUtc.isValid()
-                    || !candidate.endUtc.isValid()
-                    || candidate.endUtc <= candidate.startUtc
-                    || candidate.startUtc <= nowUtc
-                    || normalizeFavoriteShowRule(candidate.title) != normalizedRule) {
-                    continue;
-                }
-                if (isAutoFavoriteDismissed(dismissedAutoFavoriteCandidates_, currentCacheStamp, candidate)) {
-                    ++dismissedCandidateCount;
-                    continue;
-                }
-
-                const TvGuideScheduledSwitch normalizedCandidate = normalizedScheduledSwitch(candidate);
-                const QString candidateKey = scheduledSwitchKey(normalizedCandidate);
-                if (candidateKey.isEmpty() || matchedCandidateKeys.contains(candidateKey)) {
-                    continue;
-                }
+        const auto occurrencesIt = index.occurrencesByTitle.constFind(normalizedRule);
+        if (occurrencesIt == index.occurrencesByTitle.cend()) {
+            continue;
+        }
+        const bool onlyNewOccurrences = !forceCurrentCacheSearch && index.processedRules.contains(normalizedRule);
+        for (const TvGuideScheduledSwitch &candidate : occurrencesIt.value()) {
+            if (candidate.startUtc <= nowUtc) {
+                continue;
+            }
+            const QString candidateKey = favoriteShowOccurrenceKey(candidate, normalizedRule);
+            processedOccurrenceKeys.insert(candidateKey);
+            if (onlyNewOccurrences && index.processedOccurrenceKeys.contains(candidateKey)) {
+                ++previouslySeenCount;
+                continue;
+            }
+            if (isAutoFavoriteDismissed(dismissedAutoFavoriteCandidates_, currentCacheStamp, candidate)) {
+                ++dismissedCandidateCount;
+                continue;
+            }
+            if (matchedCandidateKeys.contains(candidateKey)) {
+                continue;
+            }
 
-                matchedCandidateKeys.insert(candidateKey);
-                matchedCandidates.append(normalizedCandidate);
-                if (sampleMatches.size() < 8) {
-                    sampleMatches.append(QString("%1 -> %2")
-                                             .arg(favoriteRule, scheduledSwitchDebugLabel(normalizedCandidate)));
-                }
+            matchedCandidateKeys.insert(candidateKey);
+            matchedCandidates.append(candidate);
+            if (sampleMatches.size() < 8) {
+                sampleMatches.append(QString("%1 -> %2").arg(favoriteRule, scheduledSwitchDebugLabel(candidate)));
             }
         }
     }
+    index.processedRules = processedRules;
+    index.processedOccurrenceKeys = processedOccurrenceKeys;
 
     std::sort(matchedCandidates.begin(), matchedCandidates.end(), [](const TvGuideScheduledSwitch &left,
                                                                      const TvGuideScheduledSwitch &right) {
@@ -10161,51 +11924,55 @@ void MainWindow::autoScheduleFavoriteShowsFromGuideCache(bool promptForConflict,
         }
         return left.startUtc < right.startUtc;
     });
-    appendLog(QString("favorite-show auto: matched %1 future candidate%2 across %3 favorite%4 (dismissed=%5)")
+    appendLog(QString("favorite-show auto: matched %1 future candidate%2 across %3 favorite%4 (dismissed=%5 "
+                      "previously-seen=%6)")
                   .arg(matchedCandidates.size())
                   .arg(matchedCandidates.size() == 1 ? QString() : QString("s"))
                   .arg(favoriteShowRules_.size())
                   .arg(favoriteShowRules_.size() == 1 ? QString() : QString("s"))
-                  .arg(dismissedCandidateCount));
+                  .arg(dismissedCandidateCount)
+                  .arg(previouslySeenCount));
     if (!sampleMatches.isEmpty()) {
         appendLog(QString("favorite-show auto: sample matches -> %1").arg(sampleMatches.join(" || ")));
     }
-
-    QSet<QString> existingScheduledKeys;
-    for (const TvGuideScheduledSwitch &existingSwitch : std::as_const(scheduledSwitches_)) {
-        const QString existingKey = scheduledSwitchKey(existingSwitch);
-        if (!existingKey.isEmpty()) {
-            existingScheduledKeys.insert(existingKey);
+    if (favoriteShowRatingsOverrideEnabled_ && !matchedCandidates.isEmpty()) {
+        QList<TvGuideScheduledSwitch> outrankedCandidates;
+        matchedCandidates = keepHighestPriorityScheduledSwitches(matchedCandidates,
+                                                                 scheduledSwitches_,
+                                                                 [this](const QString &title) {
+                                                                     return favoriteShowRating(title);
+                                                                 },
+                                                                 &outrankedCandidates);
+        // Outranked airings are looked at again with the next snapshot, in case the winner is removed by then.
+        for (const TvGuideScheduledSwitch &candidate : std::as_const(outrankedCandidates)) {
+            index.processedOccurrenceKeys.remove(
+                favoriteShowOccurrenceKey(candidate, normalizeFavoriteShowRule(candidate.title)));
+        }
+        if (!outrankedCandidates.isEmpty()) {
+            appendLog(QString("favorite-show auto: rating override skipped %1 airing%2 overlapping higher-priority "
+                              "switches")
+                          .arg(outrankedCandidates.size())
+                          .arg(outrankedCandidates.size() == 1 ? QString() : QString("s")));
         }
     }
 
     QList<TvGuideScheduledSwitch> addedCandidates;
     int alreadyScheduledCount = 0;
     for (const TvGuideScheduledSwitch &candidate : matchedCandidates) {
-        const QString candidateKey = scheduledSwitchKey(candidate);
-        if (candidateKey.isEmpty()) {
+        if (scheduledSwitchKey(candidate).isEmpty()) {
             continue;
         }
 
         setAutoFavoriteDismissed(dismissedAutoFavoriteCandidates_, currentCacheStamp, candidate, false);
-        if (existingScheduledKeys.contains(candidateKey)) {
+        if (!queueScheduledSwitch(scheduledSwitches_, candidate)) {
             ++alreadyScheduledCount;
             continue;
         }
 
-        scheduledSwitches_.append(candidate);
-        existingScheduledKeys.insert(candidateKey);
         addedCandidates.append(candidate);
     }
 
     if (!addedCandidates.isEmpty()) {
-        std::sort(scheduledSwitches_.begin(), scheduledSwitches_.end(), [](const TvGuideScheduledSwitch &left,
-                                                                           const TvGuideScheduledSwitch &right) {
-            if (left.startUtc == right.startUtc) {
-                return left.channelName < right.channelName;
-            }
-            return left.startUtc < right.startUtc;
-        });
         saveScheduledSwitches();
         refreshScheduledSwitchList();
         updateTvGuideDialogFromCurrentCache(false);
@@ -10228,10 +11995,10 @@ void MainWindow::autoScheduleFavoriteShowsFromGuideCache(bool promptForConflict,
                   .arg(addedCandidates.size())
                   .arg(addedCandidates.size() == 1 ? QString() : QString("es"))
                   .arg(alreadyScheduledCount));
-    logInteraction("program",
-                   "favorite-show.auto.complete",
-                   QString("stamp=%1 final-queue=%2")
-                       .arg(currentCacheStamp, summarizeScheduledSwitchesDebug(scheduledSwitches_)));
+    logInteractionLazy("program", "favorite-show.auto.complete", LogLevel::Debug, [&]() {
+        return QString("stamp=%1 final-queue=%2")
+            .arg(currentCacheStamp, summarizeScheduledSwitchesDebug(scheduledSwitches_.items()));
+    });
 }
 
 void MainWindow::showStartupSwitchSummary()
@@ -10250,7 +12017,7 @@ void MainWindow::showStartupSwitchSummary()
         message = "No scheduled switches are currently saved.";
     } else {
         QStringList lines;
-        for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_) {
+        for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_.items()) {
             lines.append(scheduledSwitchManagementLabel(scheduledSwitch));
         }
         message = lines.join('\n');
@@ -10309,11 +12076,15 @@ void MainWindow::startScan()
     }
 
     stopWatching();
-    channelsTable_->setRowCount(0);
-    logOutput_->clear();
+    channelTableFlushTimer_->stop();
+    pendingChannelRows_.clear();
+    channelsModel_->clear();
+    pendingLogRecords_.clear();
+    logLinesModel_->clear();
     partialStdOut_.clear();
     partialStdErr_.clear();
     channelLines_.clear();
+    invalidateGuideChannelIndex();
     pendingScanChannelNumbersByName_.clear();
     channelHintsDirty_ = false;
 
@@ -10345,57 +12116,38 @@ void MainWindow::stopScan()
 
 void MainWindow::handleStdOut()
 {
-    partialStdOut_.append(QString::fromUtf8(scanProcess_->readAllStandardOutput()));
-    const QStringList lines = partialStdOut_.split('\n');
-    partialStdOut_ = lines.back();
-
-    for (int i = 0; i < lines.size() - 1; ++i) {
-        const QString line = lines[i].trimmed();
-        if (!line.isEmpty()) {
-            appendLog(line);
-            parseAndStoreLine(line);
-        }
+    for (const QString &line : takeCompleteOutputLines(&partialStdOut_, scanProcess_->readAllStandardOutput())) {
+        appendLog(line);
+        parseAndStoreLine(line);
     }
 }
 
 void MainWindow::handleStdErr()
 {
-    partialStdErr_.append(QString::fromUtf8(scanProcess_->readAllStandardError()));
-    const QStringList lines = partialStdErr_.split('\n');
-    partialStdErr_ = lines.back();
-
-    static const QRegularExpression channelNumberPattern(
-        QStringLiteral("Channel number:\\s*(\\d+[:.-]\\d+)\\.\\s*Name:\\s*'([^']+)'"),
-        QRegularExpression::CaseInsensitiveOption);
-
-    for (int i = 0; i < lines.size() - 1; ++i) {
-        const QString line = lines[i].trimmed();
-        if (!line.isEmpty()) {
-            appendLog("stderr: " + line);
-            const QRegularExpressionMatch match = channelNumberPattern.match(line);
-            if (match.hasMatch()) {
-                const QString channelNumber = normalizeChannelNumberHint(match.captured(1));
-                const QString channelName = match.captured(2).trimmed();
-                if (!channelNumber.isEmpty() && !channelName.isEmpty()) {
-                    pendingScanChannelNumbersByName_[channelName].append(channelNumber);
-                }
-            }
+    for (const QString &line : takeCompleteOutputLines(&partialStdErr_, scanProcess_->readAllStandardError())) {
+        appendLog("stderr: " + line);
+        QString channelNumber;
+        QString channelName;
+        if (matchScanChannelNumberLine(line, &channelNumber, &channelName)) {
+            pendingScanChannelNumbersByName_[channelName].append(channelNumber);
         }
     }
 }
 
 void MainWindow::processFinished(int exitCode)
 {
-    if (!partialStdOut_.trimmed().isEmpty()) {
-        const QString line = partialStdOut_.trimmed();
-        appendLog(line);
-        parseAndStoreLine(line);
-        partialStdOut_.clear();
+    const QString stdOutTail = QString::fromUtf8(partialStdOut_).trimmed();
+    if (!stdOutTail.isEmpty()) {
+        appendLog(stdOutTail);
+        parseAndStoreLine(stdOutTail);
     }
-    if (!partialStdErr_.trimmed().isEmpty()) {
-        appendLog("stderr: " + partialStdErr_.trimmed());
-        partialStdErr_.clear();
+    partialStdOut_.clear();
+    const QString stdErrTail = QString::fromUtf8(partialStdErr_).trimmed();
+    if (!stdErrTail.isEmpty()) {
+        appendLog("stderr: " + stdErrTail);
     }
+    partialStdErr_.clear();
+    flushPendingChannelRows();
 
     setScanningState(false);
     persistChannelsFile();
@@ -10405,10 +12157,11 @@ void MainWindow::processFinished(int exitCode)
             && !saveError.trimmed().isEmpty()) {
             appendLog(saveError);
         }
+        saveStartupSnapshot();
     }
     pendingScanChannelNumbersByName_.clear();
     channelHintsDirty_ = false;
-    const int rowCount = channelsTable_->rowCount();
+    const int rowCount = channelsModel_->rowCount();
     const QString endMsg = QString("Scan finished (exit=%1). Channels parsed: %2").arg(exitCode).arg(rowCount);
     appendLog(endMsg);
     setStatusBarStateMessage(endMsg);
@@ -10436,28 +12189,83 @@ void MainWindow::setScanningState(bool running)
 
 void MainWindow::appendLog(const QString &line)
 {
-    const QString entry = QString("[%1] %2")
-                              .arg(QDateTime::currentDateTime().toString("MM/dd/yyyy HH:mm:ss"), line);
+    appendLogRecord(logCategoryForTag(line.section(':', 0, 0)), LogLevel::Info, line);
+}
+
+void MainWindow::appendLogRecord(LogCategory category, LogLevel level, const QString &message)
+{
+    if (!logEnabled(category, level)) {
+        return;
+    }
+
+    LogRecord record;
+    record.monotonicNs = logMonotonicNowNs();
+    record.category = category;
+    record.level = level;
+    record.message = message;
+    appendLogSinkRecord(record);
+
+    // The view only catches up once per frame, and not at all while the Logs tab is hidden.
+    pendingLogRecords_.append(std::move(record));
+    if (pendingLogRecords_.size() > kLogViewMaxLines) {
+        pendingLogRecords_.removeFirst();
+    }
+    if (logOutput_ != nullptr && logOutput_->isVisible()) {
+        scheduleLogViewFlush();
+    }
+}
+
+void MainWindow::scheduleLogViewFlush()
+{
+    if (logViewFlushTimer_ != nullptr && !logViewFlushTimer_->isActive()) {
+        logViewFlushTimer_->start();
+    }
+}
+
+void MainWindow::flushLogView()
+{
+    if (logOutput_ == nullptr || logLinesModel_ == nullptr || pendingLogRecords_.isEmpty()
+        || !logOutput_->isVisible()) {
+        return;
+    }
 
     QScrollBar *scrollBar = logOutput_->verticalScrollBar();
     const int previousScrollValue = scrollBar != nullptr ? scrollBar->value() : 0;
     const bool shouldAutoScroll = logAutoScrollCheckBox_ == nullptr || logAutoScrollCheckBox_->isChecked();
-    logOutput_->appendPlainText(entry);
+    const int droppedRows = logLinesModel_->appendRecords(pendingLogRecords_);
+    pendingLogRecords_.clear();
     if (shouldAutoScroll) {
-        QTextCursor cursor = logOutput_->textCursor();
-        cursor.movePosition(QTextCursor::End);
-        logOutput_->setTextCursor(cursor);
-        if (scrollBar != nullptr) {
-            scrollBar->setValue(scrollBar->maximum());
-        }
+        logOutput_->scrollToBottom();
     } else if (scrollBar != nullptr) {
-        scrollBar->setValue(previousScrollValue);
+        scrollBar->setValue(std::max(0, previousScrollValue - droppedRows));
+    }
+}
+
+void MainWindow::copySelectedLogLines() const
+{
+    if (logOutput_ == nullptr || logLinesModel_ == nullptr || logOutput_->selectionModel() == nullptr) {
+        return;
     }
 
-    appendDirectLineToLogFile(logFilePath_, entry);
+    QModelIndexList selected = logOutput_->selectionModel()->selectedRows();
+    if (selected.isEmpty()) {
+        return;
+    }
+    std::sort(selected.begin(), selected.end(), [](const QModelIndex &left, const QModelIndex &right) {
+        return left.row() < right.row();
+    });
+    QStringList lines;
+    lines.reserve(selected.size());
+    for (const QModelIndex &index : selected) {
+        lines.append(logLinesModel_->lineAt(index.row()));
+    }
+    QGuiApplication::clipboard()->setText(lines.join('\n'));
 }
 
-void MainWindow::logInteraction(const QString &actor, const QString &action, const QString &details)
+void MainWindow::logInteraction(const QString &actor,
+                                const QString &action,
+                                const QString &details,
+                                LogLevel level)
 {
     QString line = QString("interaction: actor=%1 action=%2")
                        .arg(actor.simplified().isEmpty() ? "unknown" : actor.simplified(),
@@ -10466,7 +12274,12 @@ void MainWindow::logInteraction(const QString &actor, const QString &action, con
     if (!trimmedDetails.isEmpty()) {
         line += " details=" + trimmedDetails;
     }
-    appendLog(line);
+    appendLogRecord(interactionLogCategory(action), level, line);
+}
+
+LogCategory MainWindow::interactionLogCategory(const QString &action)
+{
+    return logCategoryForTag(action.section('.', 0, 0));
 }
 
 void MainWindow::parseAndStoreLine(const QString &line)
@@ -10488,6 +12301,7 @@ void MainWindow::parseAndStoreLine(const QString &line)
 
     if (!channelLines_.contains(normalizedLine)) {
         channelLines_.append(normalizedLine);
+        invalidateGuideChannelIndex();
     }
 
     const QString tuneKeyValue = tuneKeyForParts(parts);
@@ -10498,6 +12312,7 @@ void MainWindow::parseAndStoreLine(const QString &line)
             channelNumberHint = normalizeChannelNumberHint(pendingNumbers.takeFirst());
             if (!channelNumberHint.isEmpty() && !tuneKeyValue.isEmpty()) {
                 xspfNumberByTuneKey_.insert(tuneKeyValue, channelNumberHint);
+                invalidateGuideChannelIndex();
                 channelHintsDirty_ = true;
             }
         }
@@ -10514,30 +12329,38 @@ void MainWindow::parseAndStoreLine(const QString &line)
     const QString displayLabel = channelDisplayLabel(channelName, channelNumberHint).isEmpty()
                                      ? channelName
                                      : channelDisplayLabel(channelName, channelNumberHint);
-    const bool sortingEnabled = channelsTable_->isSortingEnabled();
-    const int sortColumn = channelsTable_->horizontalHeader()->sortIndicatorSection();
-    const Qt::SortOrder sortOrder = channelsTable_->horizontalHeader()->sortIndicatorOrder();
-
-    if (sortingEnabled) {
-        channelsTable_->setSortingEnabled(false);
-    }
-
-    const int row = channelsTable_->rowCount();
-    channelsTable_->insertRow(row);
-    channelsTable_->setItem(row, kChannelTableNumberColumn, new QTableWidgetItem(channelNumber));
-    channelsTable_->setItem(row, kChannelTableNameColumn, new QTableWidgetItem(displayLabel));
-    channelsTable_->setItem(row, kChannelTableShowColumn, new QTableWidgetItem(channelTableShowText(displayLabel)));
-    channelsTable_->setItem(row, kChannelTableRawLineColumn, new QTableWidgetItem(normalizedLine));
+    pendingChannelRows_.append({channelNumber, displayLabel, normalizedLine});
+    scheduleChannelTableFlush();
 
     xspfProgramByChannel_.insert(channelName, parts[5].trimmed());
     if (displayLabel != channelName) {
         xspfProgramByChannel_.insert(displayLabel, parts[5].trimmed());
     }
+}
+
+void MainWindow::scheduleChannelTableFlush()
+{
+    if (channelTableFlushTimer_ != nullptr && !channelTableFlushTimer_->isActive()) {
+        channelTableFlushTimer_->start();
+    }
+}
+
+void MainWindow::flushPendingChannelRows()
+{
+    if (channelTableFlushTimer_ != nullptr) {
+        channelTableFlushTimer_->stop();
+    }
+    if (pendingChannelRows_.isEmpty()) {
+        return;
+    }
 
-    if (sortingEnabled) {
-        channelsTable_->setSortingEnabled(true);
-        channelsTable_->sortItems(sortColumn >= 0 ? sortColumn : 0, sortOrder);
+    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
+    for (ChannelTableRow &row : pendingChannelRows_) {
+        row.show = channelTableShowText(row.label, nowUtc, &row.nextShow, &row.showChangesUtc);
     }
+    channelsModel_->appendRows(pendingChannelRows_);
+    pendingChannelRows_.clear();
+    scheduleChannelShowBoundaryRefresh();
 }
 
 bool MainWindow::persistChannelsFile()
@@ -10571,85 +12394,147 @@ bool MainWindow::persistChannelsFile()
     }
     file.close();
     appendLog("Channels saved: " + channelsFilePath_);
+    saveStartupSnapshot();
     return true;
 }
 
-QString MainWindow::channelTableShowText(const QString &channelName) const
+QString MainWindow::channelTableShowText(const QString &channelName,
+                                         const QDateTime &nowUtc,
+                                         QString *nextShow,
+                                         QDateTime *changesUtc) const
 {
+    nextShow->clear();
+    *changesUtc = QDateTime();
     const QString trimmedChannelName = normalizeDisplayedChannelLabel(channelName);
     if (trimmedChannelName.isEmpty()) {
         return kChannelTableNoShowText;
     }
 
-    QList<TvGuideEntry> entries = guideEntriesCache_.value(trimmedChannelName);
-    if (entries.isEmpty()) {
-        for (auto it = guideEntriesCache_.cbegin(); it != guideEntriesCache_.cend(); ++it) {
+    auto entriesIt = channelShowGuideIndex_.constFind(trimmedChannelName);
+    if (entriesIt == channelShowGuideIndex_.cend()) {
+        for (auto it = channelShowGuideIndex_.cbegin(); it != channelShowGuideIndex_.cend(); ++it) {
             if (channelDisplayLabelsEqual(it.key(), trimmedChannelName)) {
-                entries = it.value();
+                entriesIt = it;
                 break;
             }
         }
     }
-    if (entries.isEmpty()) {
+    if (entriesIt == channelShowGuideIndex_.cend()) {
         return kChannelTableNoShowText;
     }
 
-    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-    TvGuideEntry currentEntry;
-    bool foundCurrent = false;
-    for (const TvGuideEntry &entry : entries) {
-        if (!entry.startUtc.isValid() || !entry.endUtc.isValid() || entry.endUtc <= entry.startUtc) {
-            continue;
-        }
-        if (entry.startUtc <= nowUtc && nowUtc < entry.endUtc) {
-            if (!foundCurrent || entry.startUtc > currentEntry.startUtc) {
-                currentEntry = entry;
-                foundCurrent = true;
-            }
+    // Entries are sorted by start, so the current show is the latest-starting entry before now that has not ended.
+    const QList<TvGuideEntry> &entries = entriesIt.value();
+    const auto nextIt = std::upper_bound(entries.cbegin(),
+                                         entries.cend(),
+                                         nowUtc,
+                                         [](const QDateTime &utc, const TvGuideEntry &entry) {
+                                             return utc < entry.startUtc;
+                                         });
+    const TvGuideEntry *currentEntry = nullptr;
+    for (auto it = nextIt; it != entries.cbegin();) {
+        --it;
+        if (nowUtc < it->endUtc) {
+            currentEntry = &*it;
+            break;
         }
     }
-    if (!foundCurrent) {
+
+    if (nextIt != entries.cend()) {
+        *changesUtc = nextIt->startUtc;
+        *nextShow = displayPartsForGuideEntry(*nextIt).title.simplified();
+    }
+    if (currentEntry == nullptr) {
         return kChannelTableNoShowText;
     }
+    if (!changesUtc->isValid() || currentEntry->endUtc < *changesUtc) {
+        *changesUtc = currentEntry->endUtc;
+    }
 
-    const GuideEntryDisplayParts parts = displayPartsForGuideEntry(currentEntry);
-    const QString title = parts.title.simplified();
+    const QString title = displayPartsForGuideEntry(*currentEntry).title.simplified();
     return title.isEmpty() ? kChannelTableNoShowText : title;
 }
 
-void MainWindow::refreshChannelTableShowColumn()
+void MainWindow::rebuildChannelShowGuideIndex()
 {
-    if (channelsTable_ == nullptr) {
-        return;
+    channelShowGuideIndex_.clear();
+    channelShowGuideIndex_.reserve(guideEntriesCache_.size());
+    for (auto it = guideEntriesCache_.cbegin(); it != guideEntriesCache_.cend(); ++it) {
+        QList<TvGuideEntry> entries;
+        entries.reserve(it.value().size());
+        for (const TvGuideEntry &entry : it.value()) {
+            if (entry.startUtc.isValid() && entry.endUtc.isValid() && entry.startUtc < entry.endUtc) {
+                entries.append(entry);
+            }
+        }
+        if (entries.isEmpty()) {
+            continue;
+        }
+        std::stable_sort(entries.begin(), entries.end(), [](const TvGuideEntry &left, const TvGuideEntry &right) {
+            return left.startUtc < right.startUtc;
+        });
+        channelShowGuideIndex_.insert(normalizeDisplayedChannelLabel(it.key()), entries);
     }
+}
+
+void MainWindow::refreshChannelTableShowColumn()
+{
+    rebuildChannelShowGuideIndex();
+    updateChannelTableShows(false);
+}
+
+void MainWindow::refreshDueChannelTableShows()
+{
+    updateChannelTableShows(true);
+}
 
-    const bool sortingEnabled = channelsTable_->isSortingEnabled();
-    const int sortColumn = channelsTable_->horizontalHeader()->sortIndicatorSection();
-    const Qt::SortOrder sortOrder = channelsTable_->horizontalHeader()->sortIndicatorOrder();
-    if (sortingEnabled) {
-        channelsTable_->setSortingEnabled(false);
+void MainWindow::updateChannelTableShows(bool dueRowsOnly)
+{
+    if (channelsModel_ == nullptr) {
+        return;
     }
 
-    for (int row = 0; row < channelsTable_->rowCount(); ++row) {
-        const QTableWidgetItem *channelItem = channelsTable_->item(row, kChannelTableNameColumn);
-        if (channelItem == nullptr) {
+    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
+    bool changed = false;
+    for (int row = 0; row < channelsModel_->rowCount(); ++row) {
+        const ChannelTableRow &channelRow = channelsModel_->rowAt(row);
+        if (dueRowsOnly && (!channelRow.showChangesUtc.isValid() || nowUtc < channelRow.showChangesUtc)) {
             continue;
         }
+        QString nextShow;
+        QDateTime changesUtc;
+        const QString show = channelTableShowText(channelRow.label, nowUtc, &nextShow, &changesUtc);
+        changed = channelsModel_->setShow(row, show, nextShow, changesUtc) || changed;
+    }
+    if (changed && channelsModel_->sortColumn() == kChannelTableShowColumn) {
+        channelsTable_->sortByColumn(kChannelTableShowColumn, channelsTable_->horizontalHeader()->sortIndicatorOrder());
+    }
+    scheduleChannelShowBoundaryRefresh();
+}
 
-        const QString showText = channelTableShowText(channelItem->text());
-        QTableWidgetItem *showItem = channelsTable_->item(row, kChannelTableShowColumn);
-        if (showItem == nullptr) {
-            showItem = new QTableWidgetItem(showText);
-            channelsTable_->setItem(row, kChannelTableShowColumn, showItem);
-        } else if (showItem->text() != showText) {
-            showItem->setText(showText);
-        }
+void MainWindow::scheduleChannelShowBoundaryRefresh()
+{
+    if (channelShowBoundaryTimer_ == nullptr || channelsModel_ == nullptr) {
+        return;
     }
 
-    if (sortingEnabled) {
-        channelsTable_->setSortingEnabled(true);
-        channelsTable_->sortItems(sortColumn >= 0 ? sortColumn : kChannelTableNumberColumn, sortOrder);
+    QDateTime nextChangeUtc;
+    for (int row = 0; row < channelsModel_->rowCount(); ++row) {
+        const QDateTime &changesUtc = channelsModel_->rowAt(row).showChangesUtc;
+        if (changesUtc.isValid() && (!nextChangeUtc.isValid() || changesUtc < nextChangeUtc)) {
+            nextChangeUtc = changesUtc;
+        }
     }
+    if (!nextChangeUtc.isValid()) {
+        channelShowBoundaryTimer_->stop();
+        return;
+    }
+
+    // Capped so a suspended machine or clock change is caught up within the hour.
+    const qint64 delayMs = std::clamp<qint64>(QDateTime::currentDateTimeUtc().msecsTo(nextChangeUtc) + 500,
+                                              0,
+                                              kChannelShowBoundaryMaxDelayMs);
+    channelShowBoundaryTimer_->start(static_cast<int>(delayMs));
 }
 
 QString MainWindow::selectedChannelNameFromTable() const
@@ -10658,12 +12543,7 @@ QString MainWindow::selectedChannelNameFromTable() const
     if (rows.isEmpty()) {
         return {};
     }
-    const int row = rows.first().row();
-    const auto *item = channelsTable_->item(row, kChannelTableNameColumn);
-    if (item == nullptr) {
-        return {};
-    }
-    return item->text().trimmed();
+    return channelsModel_->rowAt(rows.first().row()).label.trimmed();
 }
 
 QString MainWindow::selectedChannelLineFromTable() const
@@ -10672,12 +12552,7 @@ QString MainWindow::selectedChannelLineFromTable() const
     if (rows.isEmpty()) {
         return {};
     }
-    const int row = rows.first().row();
-    const auto *item = channelsTable_->item(row, kChannelTableRawLineColumn);
-    if (item == nullptr) {
-        return {};
-    }
-    return normalizeZapLine(item->text()).trimmed();
+    return normalizeZapLine(channelsModel_->rowAt(rows.first().row()).rawLine).trimmed();
 }
 
 QString MainWindow::firstChannelLineForName(const QString &channelName) const
@@ -10687,6 +12562,11 @@ QString MainWindow::firstChannelLineForName(const QString &channelName) const
         return {};
     }
 
+    const int row = channelsModel_ != nullptr ? channelsModel_->rowForLabel(trimmedChannelName) : -1;
+    if (row >= 0) {
+        return normalizeZapLine(channelsModel_->rowAt(row).rawLine).trimmed();
+    }
+
     for (const QString &line : channelLines_) {
         const QString normalizedLine = normalizeZapLine(line).trimmed();
         const QString baseName = channelNameFromZapLine(normalizedLine).trimmed();
@@ -10722,19 +12602,16 @@ bool MainWindow::highlightChannelInTable(const QString &channelName)
         return false;
     }
 
-    for (int row = 0; row < channelsTable_->rowCount(); ++row) {
-        QTableWidgetItem *channelItem = channelsTable_->item(row, kChannelTableNameColumn);
-        if (channelItem == nullptr || channelItem->text().trimmed() != channelName.trimmed()) {
-            continue;
-        }
-
-        channelsTable_->selectRow(row);
-        channelsTable_->setCurrentCell(row, kChannelTableNameColumn);
-        channelsTable_->scrollToItem(channelItem, QAbstractItemView::PositionAtCenter);
-        return true;
+    const int row = channelsModel_->rowForLabel(channelName);
+    if (row < 0) {
+        return false;
     }
 
-    return false;
+    const QModelIndex channelIndex = channelsModel_->index(row, kChannelTableNameColumn);
+    channelsTable_->selectRow(row);
+    channelsTable_->setCurrentIndex(channelIndex);
+    channelsTable_->scrollTo(channelIndex, QAbstractItemView::PositionAtCenter);
+    return true;
 }
 
 bool MainWindow::highlightChannelLineInTable(const QString &channelLine)
@@ -10743,20 +12620,16 @@ bool MainWindow::highlightChannelLineInTable(const QString &channelLine)
         return false;
     }
 
-    const QString normalizedChannelLine = normalizeZapLine(channelLine).trimmed();
-    for (int row = 0; row < channelsTable_->rowCount(); ++row) {
-        QTableWidgetItem *rawLineItem = channelsTable_->item(row, kChannelTableRawLineColumn);
-        if (rawLineItem == nullptr || normalizeZapLine(rawLineItem->text()).trimmed() != normalizedChannelLine) {
-            continue;
-        }
-
-        channelsTable_->selectRow(row);
-        channelsTable_->setCurrentCell(row, kChannelTableNameColumn);
-        channelsTable_->scrollToItem(rawLineItem, QAbstractItemView::PositionAtCenter);
-        return true;
+    const int row = channelsModel_->rowForLine(channelLine);
+    if (row < 0) {
+        return false;
     }
 
-    return false;
+    const QModelIndex channelIndex = channelsModel_->index(row, kChannelTableNameColumn);
+    channelsTable_->selectRow(row);
+    channelsTable_->setCurrentIndex(channelIndex);
+    channelsTable_->scrollTo(channelIndex, QAbstractItemView::PositionAtCenter);
+    return true;
 }
 
 QString MainWindow::programIdForChannel(const QString &channelName) const
@@ -10860,12 +12733,31 @@ void MainWindow::openMediaFile()
     setStatusBarStateMessage("Opening media file");
 }
 
-bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
+void MainWindow::refreshGuideData(bool interactive, bool updateDialog, GuideRefreshCallback onFinished)
+{
+    // Both sources keep the UI live while they run, so a second refresh can be asked for before the first ends.
+    if (guideRefreshInProgress_) {
+        appendLog("guide-bg: a guide refresh is already running; skipped this request.");
+        if (onFinished) {
+            onFinished(false);
+        }
+        return;
+    }
+
+    if (useSchedulesDirectGuideSource()) {
+        refreshGuideDataFromSchedulesDirect(interactive, updateDialog, std::move(onFinished));
+        return;
+    }
+
+    const bool refreshed = refreshGuideDataFromBroadcast(interactive, updateDialog);
+    if (onFinished) {
+        onFinished(refreshed);
+    }
+}
+
+bool MainWindow::refreshGuideDataFromBroadcast(bool interactive, bool updateDialog)
 {
-    const bool useSchedulesDirect = useSchedulesDirectGuideSource();
-    if (!useSchedulesDirect
-        && scanProcess_ != nullptr
-        && scanProcess_->state() != QProcess::NotRunning) {
+    if (scanProcess_ != nullptr && scanProcess_->state() != QProcess::NotRunning) {
         if (interactive) {
             showWarningDialog("Scan in progress", "Stop scanning before opening the TV guide.");
         } else {
@@ -10874,10 +12766,6 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
         return false;
     }
 
-    if (useSchedulesDirect) {
-        return refreshGuideDataFromSchedulesDirect(interactive, updateDialog);
-    }
-
     if (channelLines_.isEmpty()) {
         loadChannelsFileIfPresent();
     }
@@ -10900,7 +12788,8 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
         return false;
     }
 
-    const QVector<GuideChannelInfo> channels = parseGuideChannels(channelLines_, &xspfNumberByTuneKey_);
+    const GuideChannelIndex &channelIndex = guideChannelIndex();
+    const QVector<GuideChannelInfo> channels = channelIndex.channels;
     if (channels.isEmpty()) {
         if (interactive) {
             showWarningDialog("Unsupported channel format",
@@ -10911,11 +12800,12 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
         return false;
     }
 
-    QHash<qint64, QVector<GuideChannelInfo>> channelsByFrequency;
+    const QHash<qint64, QVector<GuideChannelInfo>> channelsByFrequency = channelIndex.channelsByFrequency;
+    const QHash<qint64, QHash<int, QStringList>> namesByServiceIdByFrequency =
+        channelIndex.namesByServiceIdByFrequency;
     QStringList channelOrder;
     QSet<QString> channelSeen;
     for (const GuideChannelInfo &channel : channels) {
-        channelsByFrequency[channel.frequencyHz].append(channel);
         if (!channelSeen.contains(channel.name)) {
             channelSeen.insert(channel.name);
             channelOrder.append(channel.name);
@@ -11062,6 +12952,41 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
     }
 
     QHash<QString, QList<TvGuideEntry>> entriesByChannel = guideEntriesCache_;
+    const int retentionHours = guideCacheRetentionHoursValue(guideCacheRetentionCombo_);
+    // The cached window start can be days old when a stale cache is being rebuilt, so the guide starts from now.
+    const QDateTime progressiveWindowStartUtc = alignedGuideWindowStartUtc(QDateTime::currentDateTimeUtc());
+    const int progressiveSlotMinutes = lastGuideSlotMinutes_;
+    // Publish each multiplex as soon as it is decoded so the guide fills in while the sweep continues.
+    const auto publishMuxEntries = [&](const QVector<GuideChannelInfo> &muxChannels, int completedFrequencies) {
+        const QDateTime publishNowUtc = QDateTime::currentDateTimeUtc();
+        for (const GuideChannelInfo &channel : muxChannels) {
+            guideEntriesFullCache_.insert(channel.name,
+                                          cleanGuideEntries(entriesByChannel.value(channel.name),
+                                                            publishNowUtc,
+                                                            retentionHours));
+        }
+        QDateTime displayedLatestEndUtc;
+        guideEntriesCache_ = filterGuideEntriesForConfiguredListingsScope(guideEntriesFullCache_, &displayedLatestEndUtc);
+        invalidateFavoriteShowIndex();
+        applyCurrentShowStatusFromGuideCache();
+        // Only refreshes that push their final result to the dialog may show progress there; a background
+        // refresh would otherwise leave the dialog on its last progress status.
+        if (!updateDialog || tvGuideDialog_ == nullptr) {
+            return;
+        }
+        lastGuideDialogPresentationStamp_.clear();
+        tvGuideDialog_->setGuideData(channelOrder,
+                                     favorites_,
+                                     favoriteShowRatings_,
+                                     guideEntriesCache_,
+                                     progressiveWindowStartUtc,
+                                     progressiveSlotMinutes,
+                                     guideWindowSlotCount(progressiveWindowStartUtc,
+                                                          displayedLatestEndUtc,
+                                                          progressiveSlotMinutes),
+                                     scheduledSwitches_.items(),
+                                     progressStatusMessage(completedFrequencies));
+    };
     QStringList errors;
     int frequenciesWithData = 0;
     int decodedEvents = 0;
@@ -11152,7 +13077,7 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
         int mappedForFrequency = 0;
         QSet<QString> mappedChannelNamesForMux;
         const QHash<QString, QList<TvGuideEntry>> mappedEntriesForMux =
-            mapGuideEntriesForFrequency(frequencyChannels,
+            mapGuideEntriesForFrequency(namesByServiceIdByFrequency.value(frequencyHz),
                                         frequencyEvents,
                                         atscSourceToProgram,
                                         &mappedForFrequency,
@@ -11183,6 +13108,9 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
         }
         muxSummaryLines.append(muxSummary);
 
+        if (!mappedChannelNamesForMux.isEmpty()) {
+            publishMuxEntries(frequencyChannels, i + 1);
+        }
         setStatusBarStateMessage(progressStatusMessage(i + 1));
     }
     if (progress != nullptr) {
@@ -11195,7 +13123,6 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
     }
 
     const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-    const int retentionHours = guideCacheRetentionHoursValue(guideCacheRetentionCombo_);
     int mappedEntries = 0;
     QDateTime latestEndUtc = nowUtc.addSecs(6 * 3600);
 
@@ -11276,6 +13203,7 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
     guideCacheCoverageEndUtc_ = cacheCoverageEndUtc;
     guideEntriesFullCache_ = entriesByChannel;
     guideEntriesCache_ = displayedEntriesByChannel;
+    invalidateFavoriteShowIndex();
     for (const QString &channelName : channelOrder) {
         if (guideEntriesCache_.value(channelName).isEmpty()) {
             noAutoCurrentShowLookupChannels_.insert(channelName);
@@ -11289,6 +13217,7 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
         appendLog("guide: failed to reload guide cache file after refresh; using in-memory cache.");
         guideEntriesFullCache_ = entriesByChannel;
         guideEntriesCache_ = displayedEntriesByChannel;
+        invalidateFavoriteShowIndex();
         guideCacheCoverageEndUtc_ = cacheCoverageEndUtc;
         lastGuideChannelOrder_ = channelOrder;
         lastGuideWindowStartUtc_ = windowStartUtc;
@@ -11302,99 +13231,58 @@ bool MainWindow::refreshGuideData(bool interactive, bool updateDialog)
         tvGuideDialog_->setGuideData(lastGuideChannelOrder_,
                                      favorites_,
                                      favoriteShowRatings_,
-                                     guideEntriesCache_,
-                                     lastGuideWindowStartUtc_,
-                                     lastGuideSlotMinutes_,
-                                     lastGuideSlotCount_,
-                                     scheduledSwitches_,
-                                     lastGuideStatusText_);
-    }
-    setStatusBarStateMessage(statusText.section('\n', 0, 0));
-    return true;
-}
-
-void MainWindow::refreshTvGuide()
-{
-    if (!refreshGuideData(true, true)) {
-        loadGuideCacheFile();
-        updateTvGuideDialogFromCurrentCache(true);
-    }
-}
-
-bool MainWindow::writeGuideCacheFile(const QStringList &channelOrder,
-                                     const QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
-                                     const QDateTime &windowStartUtc,
-                                     int slotMinutes,
-                                     int slotCount,
-                                     const QString &statusText)
-{
-    const QString cachePath = resolveGuideCachePath();
-    if (cachePath.isEmpty()) {
-        return false;
-    }
-
-    QFileInfo cacheInfo(cachePath);
-    QDir cacheDir = cacheInfo.dir();
-    if (!cacheDir.exists() && !cacheDir.mkpath(".")) {
-        return false;
-    }
-
-    QJsonObject root;
-    root.insert("version", 1);
-    root.insert("generatedUtc", QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs));
-    root.insert("windowStartUtc", windowStartUtc.toString(Qt::ISODateWithMs));
-    root.insert("slotMinutes", slotMinutes);
-    root.insert("slotCount", slotCount);
-    root.insert("statusText", statusText);
-
-    QJsonArray channelOrderArray;
-    for (const QString &channelName : channelOrder) {
-        channelOrderArray.append(channelName);
-    }
-    root.insert("channelOrder", channelOrderArray);
-
-    QJsonObject entriesObject;
-    for (auto it = entriesByChannel.cbegin(); it != entriesByChannel.cend(); ++it) {
-        entriesObject.insert(it.key(), guideEntriesToJsonArray(it.value()));
-    }
-    root.insert("entriesByChannel", entriesObject);
-
-    QSaveFile cacheFile(cachePath);
-    if (!cacheFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-        return false;
-    }
-    const QByteArray payload = QJsonDocument(root).toJson(QJsonDocument::Indented);
-    if (cacheFile.write(payload) != payload.size()) {
-        cacheFile.cancelWriting();
-        return false;
+                                     guideEntriesCache_,
+                                     lastGuideWindowStartUtc_,
+                                     lastGuideSlotMinutes_,
+                                     lastGuideSlotCount_,
+                                     scheduledSwitches_.items(),
+                                     lastGuideStatusText_);
     }
-    return cacheFile.commit();
+    setStatusBarStateMessage(statusText.section('\n', 0, 0));
+    return true;
+}
+
+void MainWindow::refreshTvGuide()
+{
+    refreshGuideData(true, true, [this](bool refreshed) {
+        if (!refreshed) {
+            loadGuideCacheFile();
+            updateTvGuideDialogFromCurrentCache(true);
+        }
+    });
+}
+
+bool MainWindow::writeGuideCacheFile(const QStringList &channelOrder,
+                                     const QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
+                                     const QDateTime &windowStartUtc,
+                                     int slotMinutes,
+                                     int slotCount,
+                                     const QString &statusText)
+{
+    // A fresh write supersedes any pending prune write and must not be overtaken by one still running.
+    guideCachePruneWriteTimer_->stop();
+    pendingGuideCachePrune_.reset();
+    guideCachePruneWrite_.waitForFinished();
+    return writeGuideCacheJson(resolveGuideCachePath(),
+                               channelOrder,
+                               entriesByChannel,
+                               QDateTime::currentDateTimeUtc().toString(Qt::ISODateWithMs),
+                               windowStartUtc,
+                               slotMinutes,
+                               slotCount,
+                               statusText);
 }
 
-bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool updateDialog)
+void MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive,
+                                                     bool updateDialog,
+                                                     GuideRefreshCallback onFinished)
 {
     if (guideEntriesFullCache_.isEmpty()) {
         loadGuideCacheFile();
     }
 
-    const auto setGuideRefreshInProgress = [this](bool active) {
-        guideRefreshInProgress_ = active;
-        setStatusBarStateMessage(lastStatusBarMessage_);
-    };
-    struct GuideRefreshGuard {
-        std::function<void()> onExit;
-        ~GuideRefreshGuard()
-        {
-            if (onExit) {
-                onExit();
-            }
-        }
-    };
-
-    setGuideRefreshInProgress(true);
-    GuideRefreshGuard guideRefreshGuard{[&setGuideRefreshInProgress]() {
-        setGuideRefreshInProgress(false);
-    }};
+    guideRefreshInProgress_ = true;
+    setStatusBarStateMessage(lastStatusBarMessage_);
 
     const QString loadingMessage = "Downloading OTA schedule data from Schedules Direct...";
     if (updateDialog && tvGuideDialog_ != nullptr) {
@@ -11405,15 +13293,23 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
     if (!interactive) {
         appendLog("guide-bg: starting Schedules Direct guide refresh.");
     }
-    QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
 
-    QString exportSummary;
-    QString exportError;
-    bool usedCachedExport = false;
-    if (!ensureSchedulesDirectJson(true, &usedCachedExport, &exportSummary, &exportError)) {
-        const QString statusText = exportError.trimmed().isEmpty()
+    startSchedulesDirectSync(true, [this, updateDialog, onFinished](const SchedulesDirectSyncResult &result) {
+        const bool refreshed = applySchedulesDirectGuideRefresh(updateDialog, result);
+        guideRefreshInProgress_ = false;
+        setStatusBarStateMessage(lastStatusBarMessage_);
+        if (onFinished) {
+            onFinished(refreshed);
+        }
+    });
+}
+
+bool MainWindow::applySchedulesDirectGuideRefresh(bool updateDialog, const SchedulesDirectSyncResult &result)
+{
+    if (!result.ok) {
+        const QString statusText = result.errorText.trimmed().isEmpty()
                                        ? QString("Schedules Direct guide refresh failed.")
-                                       : exportError.trimmed();
+                                       : result.errorText.trimmed();
         appendLog(QString("guide-sd: %1").arg(statusText));
         if (updateDialog && tvGuideDialog_ != nullptr) {
             lastGuideDialogPresentationStamp_.clear();
@@ -11431,32 +13327,36 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
         }
     }
 
-    QFile exportFile(exportPath);
-    if (!exportFile.exists() || !exportFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        const QString statusText = QString("Could not open %1 for Schedules Direct guide import.").arg(exportPath);
-        appendLog(QString("guide-sd: %1").arg(statusText));
-        if (updateDialog && tvGuideDialog_ != nullptr) {
-            lastGuideDialogPresentationStamp_.clear();
-            tvGuideDialog_->setLoadingState(statusText);
+    QJsonObject root = result.exportRoot;
+    const bool freshExport = !root.isEmpty();
+    if (!freshExport) {
+        QFile exportFile(exportPath);
+        if (!exportFile.exists() || !exportFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            const QString statusText = QString("Could not open %1 for Schedules Direct guide import.").arg(exportPath);
+            appendLog(QString("guide-sd: %1").arg(statusText));
+            if (updateDialog && tvGuideDialog_ != nullptr) {
+                lastGuideDialogPresentationStamp_.clear();
+                tvGuideDialog_->setLoadingState(statusText);
+            }
+            setStatusBarStateMessage("Schedules Direct guide import failed");
+            return false;
         }
-        setStatusBarStateMessage("Schedules Direct guide import failed");
-        return false;
-    }
 
-    QJsonParseError parseError{};
-    const QJsonDocument document = QJsonDocument::fromJson(exportFile.readAll(), &parseError);
-    if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
-        const QString statusText = QString("Could not parse %1 (%2).").arg(exportPath, parseError.errorString());
-        appendLog(QString("guide-sd: %1").arg(statusText));
-        if (updateDialog && tvGuideDialog_ != nullptr) {
-            lastGuideDialogPresentationStamp_.clear();
-            tvGuideDialog_->setLoadingState(statusText);
+        QJsonParseError parseError{};
+        const QJsonDocument document = QJsonDocument::fromJson(exportFile.readAll(), &parseError);
+        if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+            const QString statusText = QString("Could not parse %1 (%2).").arg(exportPath, parseError.errorString());
+            appendLog(QString("guide-sd: %1").arg(statusText));
+            if (updateDialog && tvGuideDialog_ != nullptr) {
+                lastGuideDialogPresentationStamp_.clear();
+                tvGuideDialog_->setLoadingState(statusText);
+            }
+            setStatusBarStateMessage("Schedules Direct guide import failed");
+            return false;
         }
-        setStatusBarStateMessage("Schedules Direct guide import failed");
-        return false;
+        root = document.object();
     }
 
-    const QJsonObject root = document.object();
     QStringList channelOrder;
     const QJsonArray channelOrderArray = root.value("channelOrder").toArray();
     for (const QJsonValue &value : channelOrderArray) {
@@ -11466,7 +13366,7 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
         }
     }
     if (channelOrder.isEmpty()) {
-        const QVector<GuideChannelInfo> localChannels = parseGuideChannels(channelLines_, &xspfNumberByTuneKey_);
+        const QVector<GuideChannelInfo> localChannels = guideChannelIndex().channels;
         QSet<QString> seenChannelNames;
         for (const GuideChannelInfo &channel : localChannels) {
             if (!channel.name.trimmed().isEmpty() && !seenChannelNames.contains(channel.name)) {
@@ -11481,22 +13381,11 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
     const int retentionHours = guideCacheRetentionHoursValue(guideCacheRetentionCombo_);
     QDateTime latestEndUtc = nowUtc.addSecs(6 * 3600);
     QHash<QString, QList<TvGuideEntry>> entriesByChannel;
-    const bool hasRawSchedulesDirectLineups = !root.value("lineups").toArray().isEmpty();
+    // Cached exports are remapped from their station listings in case the local channels changed since.
+    const bool hasSchedulesDirectChannels =
+        !root.value("sdChannels").toArray().isEmpty() || !root.value("lineups").toArray().isEmpty();
     const QJsonObject entriesObject = root.value("entriesByChannel").toObject();
-    if (hasRawSchedulesDirectLineups) {
-        QStringList importedChannels;
-        QStringList unmatchedChannels;
-        QStringList skippedChannels;
-        int importedEntryCount = 0;
-        applySchedulesDirectGuideFallback(entriesByChannel,
-                                          retentionHours,
-                                          nowUtc,
-                                          &latestEndUtc,
-                                          &importedChannels,
-                                          &unmatchedChannels,
-                                          &skippedChannels,
-                                          &importedEntryCount);
-    } else if (!entriesObject.isEmpty()) {
+    if (!entriesObject.isEmpty() && (freshExport || !hasSchedulesDirectChannels)) {
         for (auto it = entriesObject.begin(); it != entriesObject.end(); ++it) {
             entriesByChannel.insert(normalizeDisplayedChannelLabel(it.key()),
                                     cleanGuideEntries(guideEntriesFromJsonArray(it.value().toArray()),
@@ -11509,7 +13398,9 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
         QStringList unmatchedChannels;
         QStringList skippedChannels;
         int importedEntryCount = 0;
-        applySchedulesDirectGuideFallback(entriesByChannel,
+        applySchedulesDirectGuideFallback(root,
+                                          exportPath,
+                                          entriesByChannel,
                                           retentionHours,
                                           nowUtc,
                                           &latestEndUtc,
@@ -11545,14 +13436,14 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
                          .arg(channelOrder.size() - missingChannelNames.size())
                          .arg(channelOrder.size());
     }
-    if (!exportSummary.trimmed().isEmpty()) {
-        statusText = exportSummary.trimmed() + "\n" + statusText;
+    if (!result.summary.trimmed().isEmpty()) {
+        statusText = result.summary.trimmed() + "\n" + statusText;
     }
     if (!missingChannelNames.isEmpty()
         && !statusText.contains(QString("No guide data: %1").arg(missingChannelNames.join(", ")))) {
         statusText += QString("\nNo guide data: %1").arg(missingChannelNames.join(", "));
     }
-    if (usedCachedExport) {
+    if (result.usedCachedExport) {
         statusText = "Using cached Schedules Direct JSON.\n" + statusText;
     }
 
@@ -11568,6 +13459,7 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
     guideCacheCoverageEndUtc_ = cacheCoverageEndUtc;
     guideEntriesFullCache_ = entriesByChannel;
     guideEntriesCache_ = displayedEntriesByChannel;
+    invalidateFavoriteShowIndex();
     for (const QString &channelName : channelOrder) {
         if (guideEntriesCache_.value(channelName).isEmpty()) {
             noAutoCurrentShowLookupChannels_.insert(channelName);
@@ -11581,6 +13473,7 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
         appendLog("guide-sd: failed to reload guide cache file after refresh; using in-memory cache.");
         guideEntriesFullCache_ = entriesByChannel;
         guideEntriesCache_ = displayedEntriesByChannel;
+        invalidateFavoriteShowIndex();
         guideCacheCoverageEndUtc_ = cacheCoverageEndUtc;
         lastGuideChannelOrder_ = channelOrder;
         lastGuideWindowStartUtc_ = windowStartUtc;
@@ -11598,7 +13491,7 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
                                      lastGuideWindowStartUtc_,
                                      lastGuideSlotMinutes_,
                                      lastGuideSlotCount_,
-                                     scheduledSwitches_,
+                                     scheduledSwitches_.items(),
                                      lastGuideStatusText_);
     }
     setStatusBarStateMessage(statusText.section('\n', 0, 0));
@@ -11607,9 +13500,70 @@ bool MainWindow::refreshGuideDataFromSchedulesDirect(bool interactive, bool upda
 
 bool MainWindow::loadGuideCacheFile()
 {
-    purgeExpiredGuideCacheFiles(true, false);
+    GuideCacheFileData data;
+    if (!readGuideCacheFile(resolveGuideCachePath(),
+                            QDateTime::currentDateTimeUtc(),
+                            guideCacheRetentionHoursValue(guideCacheRetentionCombo_),
+                            &data)) {
+        return false;
+    }
+    applyGuideCacheFileData(data);
+    if (data.pruned) {
+        scheduleGuideCachePruneWrite(data);
+    }
+    return true;
+}
+
+void MainWindow::scheduleGuideCachePruneWrite(const GuideCacheFileData &data)
+{
+    // Called right after applyGuideCacheFileData, so the window fields describe exactly this data.
+    auto pending = std::make_shared<GuideCachePruneWrite>();
+    pending->data = data;
+    pending->windowStartUtc = lastGuideWindowStartUtc_;
+    pending->slotCount = lastGuideSlotCount_;
+    const bool sameSource = pendingGuideCachePrune_ != nullptr
+                            && pendingGuideCachePrune_->data.sourceStamp == data.sourceStamp;
+    pendingGuideCachePrune_ = std::move(pending);
+    if (!sameSource || !guideCachePruneWriteTimer_->isActive()) {
+        guideCachePruneWriteTimer_->start();
+    }
+}
+
+void MainWindow::writePrunedGuideCacheInBackground()
+{
+    if (guideCachePruneWrite_.isRunning()) {
+        guideCachePruneWriteTimer_->start();
+        return;
+    }
+
+    std::shared_ptr<const GuideCachePruneWrite> pending = std::move(pendingGuideCachePrune_);
+    pendingGuideCachePrune_.reset();
+    if (pending == nullptr) {
+        return;
+    }
+
+    // Only the data read from the file is written back, never the in-memory guide, which may hold a partial
+    // progressive merge. The write is skipped if the file changed since it was loaded.
+    guideCachePruneWrite_ = QtConcurrent::run([cachePath = resolveGuideCachePath(), pending]() {
+        if (guideCacheFileStamp(cachePath) != pending->data.sourceStamp) {
+            return;
+        }
+        writeGuideCacheJson(cachePath,
+                            pending->data.channelOrder,
+                            pending->data.entriesByChannel,
+                            pending->data.generatedUtc,
+                            pending->windowStartUtc,
+                            pending->data.slotMinutes,
+                            pending->slotCount,
+                            pending->data.statusText);
+    });
+}
 
-    const QString cachePath = resolveGuideCachePath();
+bool MainWindow::readGuideCacheFile(const QString &cachePath,
+                                    const QDateTime &nowUtc,
+                                    int retentionHours,
+                                    GuideCacheFileData *data)
+{
     if (cachePath.isEmpty()) {
         return false;
     }
@@ -11618,6 +13572,7 @@ bool MainWindow::loadGuideCacheFile()
     if (!cacheFile.exists()) {
         return false;
     }
+    data->sourceStamp = guideCacheFileStamp(cachePath);
     if (!cacheFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
         return false;
     }
@@ -11628,43 +13583,53 @@ bool MainWindow::loadGuideCacheFile()
         return false;
     }
 
-    const QString previousCacheStamp = currentGuideCacheStamp(lastGuideCacheGeneratedUtc_,
-                                                              lastGuideWindowStartUtc_,
-                                                              lastGuideSlotMinutes_,
-                                                              lastGuideSlotCount_);
     const QJsonObject root = document.object();
-    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-    QStringList storedChannelOrder = [&root]() {
-        QStringList order;
-        for (const QJsonValue &value : root.value("channelOrder").toArray()) {
-            const QString channelName = normalizeDisplayedChannelLabel(value.toString());
-            if (!channelName.isEmpty() && !order.contains(channelName)) {
-                order.append(channelName);
-            }
+    QStringList storedChannelOrder;
+    for (const QJsonValue &value : root.value("channelOrder").toArray()) {
+        const QString channelName = normalizeDisplayedChannelLabel(value.toString());
+        if (!channelName.isEmpty() && !storedChannelOrder.contains(channelName)) {
+            storedChannelOrder.append(channelName);
         }
-        return order;
-    }();
+    }
     sortGuideChannelOrder(storedChannelOrder);
 
-    QHash<QString, QList<TvGuideEntry>> loadedEntries;
     const QJsonObject entriesObject = root.value("entriesByChannel").toObject();
-    const int retentionHours = guideCacheRetentionHoursValue(guideCacheRetentionCombo_);
     for (auto it = entriesObject.begin(); it != entriesObject.end(); ++it) {
+        const QJsonArray array = it.value().toArray();
+        int expiredCount = 0;
         const QList<TvGuideEntry> cleaned =
-            cleanGuideEntries(guideEntriesFromJsonArray(it.value().toArray()), nowUtc, retentionHours);
-        loadedEntries.insert(normalizeDisplayedChannelLabel(it.key()), cleaned);
+            cleanGuideEntries(guideEntriesFromJsonArray(array), nowUtc, retentionHours, nullptr, &expiredCount);
+        if (expiredCount > 0) {
+            data->pruned = true;
+        }
+        data->entriesByChannel.insert(normalizeDisplayedChannelLabel(it.key()), cleaned);
     }
+    data->channelOrder = storedChannelOrder;
+    data->generatedUtc = root.value("generatedUtc").toString().trimmed();
+    data->slotMinutes = std::clamp(root.value("slotMinutes").toInt(30), 15, 120);
+    data->statusText = root.value("statusText").toString().trimmed();
+    return true;
+}
 
-    guideEntriesFullCache_ = loadedEntries;
+void MainWindow::applyGuideCacheFileData(const GuideCacheFileData &data)
+{
+    const QString previousCacheStamp = currentGuideCacheStamp(lastGuideCacheGeneratedUtc_,
+                                                              lastGuideWindowStartUtc_,
+                                                              lastGuideSlotMinutes_,
+                                                              lastGuideSlotCount_);
+    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
+    loadedGuideCacheFileStamp_ = data.sourceStamp;
+    guideEntriesFullCache_ = data.entriesByChannel;
     guideCacheCoverageEndUtc_ = latestGuideEntryEndUtc(guideEntriesFullCache_);
     QDateTime filteredLatestEndUtc;
     guideEntriesCache_ = filterGuideEntriesForConfiguredListingsScope(guideEntriesFullCache_, &filteredLatestEndUtc);
-    lastGuideChannelOrder_ = storedChannelOrder;
-    lastGuideCacheGeneratedUtc_ = root.value("generatedUtc").toString().trimmed();
-    lastGuideSlotMinutes_ = std::clamp(root.value("slotMinutes").toInt(30), 15, 120);
+    invalidateFavoriteShowIndex();
+    lastGuideChannelOrder_ = data.channelOrder;
+    lastGuideCacheGeneratedUtc_ = data.generatedUtc;
+    lastGuideSlotMinutes_ = data.slotMinutes;
     lastGuideWindowStartUtc_ = alignedGuideWindowStartUtc(nowUtc);
     lastGuideSlotCount_ = guideWindowSlotCount(lastGuideWindowStartUtc_, filteredLatestEndUtc, lastGuideSlotMinutes_);
-    lastGuideStatusText_ = root.value("statusText").toString().trimmed();
+    lastGuideStatusText_ = data.statusText;
     if (guideCacheHasEntriesForNow(guideEntriesCache_, nowUtc)) {
         guideCacheRunoutRefreshRetryUtc_ = QDateTime();
     }
@@ -11674,7 +13639,7 @@ bool MainWindow::loadGuideCacheFile()
                                                             lastGuideSlotCount_);
     const bool cacheStampChanged = !loadedCacheStamp.isEmpty() && loadedCacheStamp != previousCacheStamp;
 
-    for (const QString &channelName : storedChannelOrder) {
+    for (const QString &channelName : data.channelOrder) {
         if (guideEntriesCache_.value(channelName).isEmpty()) {
             noAutoCurrentShowLookupChannels_.insert(channelName);
         } else {
@@ -11682,14 +13647,14 @@ bool MainWindow::loadGuideCacheFile()
         }
     }
     if (cacheStampChanged && deferStartupAutoFavoriteScheduling_) {
-        logInteraction("program",
-                       "startup.favorite-show.auto-scan.defer",
-                       QString("cache stamp=%1 favorites=%2")
-                           .arg(currentGuideCacheStamp(lastGuideCacheGeneratedUtc_,
-                                                       lastGuideWindowStartUtc_,
-                                                       lastGuideSlotMinutes_,
-                                                       lastGuideSlotCount_),
-                                favoriteShowRules_.join(" | ")));
+        logInteractionLazy("program", "startup.favorite-show.auto-scan.defer", LogLevel::Info, [&]() {
+            return QString("cache stamp=%1 favorites=%2")
+                .arg(currentGuideCacheStamp(lastGuideCacheGeneratedUtc_,
+                                            lastGuideWindowStartUtc_,
+                                            lastGuideSlotMinutes_,
+                                            lastGuideSlotCount_),
+                     favoriteShowRules_.join(" | "));
+        });
     } else if (cacheStampChanged) {
         autoScheduleFavoriteShowsFromGuideCache(false, false);
     }
@@ -11699,7 +13664,6 @@ bool MainWindow::loadGuideCacheFile()
                                      4000);
     }
     refreshChannelTableShowColumn();
-    return true;
 }
 
 void MainWindow::setCurrentShowStatus(const QString &text,
@@ -11786,41 +13750,9 @@ bool MainWindow::applyCurrentShowStatusFromGuideCache()
     }
 
     if (obeyScheduledSwitches_) {
-        for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches_) {
-            const TvGuideScheduledSwitch normalizedSwitch = normalizedScheduledSwitch(scheduledSwitch);
-            const QDateTime effectiveStartUtc = scheduledSwitchEffectiveStartUtc(normalizedSwitch);
-            const QDateTime effectiveEndUtc = scheduledSwitchEffectiveEndUtc(normalizedSwitch);
-            if (normalizedSwitch.channelName.isEmpty()
-                || !effectiveStartUtc.isValid()
-                || !effectiveEndUtc.isValid()
-                || effectiveEndUtc <= nowUtc
-                || effectiveStartUtc <= nowUtc) {
-                continue;
-            }
-
-            if (!nextScheduledStartUtc.isValid() || effectiveStartUtc < nextScheduledStartUtc) {
-                nextScheduledStartUtc = effectiveStartUtc;
-                nextScheduledCandidates = {normalizedSwitch};
-                continue;
-            }
-
-            if (effectiveStartUtc != nextScheduledStartUtc) {
-                continue;
-            }
-
-            bool duplicateCandidate = false;
-            for (const TvGuideScheduledSwitch &existingCandidate : nextScheduledCandidates) {
-                if (scheduledSwitchesMatch(existingCandidate, normalizedSwitch)) {
-                    duplicateCandidate = true;
-                    break;
-                }
-            }
-            if (!duplicateCandidate) {
-                nextScheduledCandidates.append(normalizedSwitch);
-            }
-        }
-
+        nextScheduledCandidates = scheduledSwitches_.nextStartingAfter(nowUtc);
         if (!nextScheduledCandidates.isEmpty()) {
+            nextScheduledStartUtc = nextScheduledCandidates.first().startUtc;
             if (nextScheduledCandidates.size() == 1) {
                 nextScheduledSwitch = nextScheduledCandidates.first();
                 foundNextScheduledSwitch = true;
@@ -12215,7 +14147,9 @@ bool MainWindow::startWatchingChannel(const QString &channelName,
     args << (zapChannelName.isEmpty() ? requestedChannelName : zapChannelName);
     appendLog(QString("Tuning channel: %1 (program=%2)")
                   .arg(currentChannelName_, currentProgramId_.isEmpty() ? "unknown" : currentProgramId_));
-    appendLog("zap: launch " + formatCommandLine(zapExe, args));
+    logRecord(LogCategory::Zap, LogLevel::Info, [&]() {
+        return "zap: launch " + formatCommandLine(zapExe, args);
+    });
     zapProcess_->start(zapExe, args);
     if (!zapProcess_->waitForStarted(2000)) {
         appendLog(QString("Failed to start dvbv5-zap for %1 (%2)")
@@ -12495,7 +14429,9 @@ void MainWindow::startPlaybackFromDvr(const QString &dvrPath)
                    << liveBridgeOutputUrl;
     }
 
-    appendLog("ffmpeg bridge: launch " + formatCommandLine(ffmpegExe, ffmpegArgs));
+    logRecord(LogCategory::Player, LogLevel::Info, [&]() {
+        return "ffmpeg bridge: launch " + formatCommandLine(ffmpegExe, ffmpegArgs);
+    });
     streamBridgeProcess_->setProgram(ffmpegExe);
     streamBridgeProcess_->setArguments(ffmpegArgs);
     streamBridgeProcess_->setProcessChannelMode(QProcess::SeparateChannels);
@@ -12620,7 +14556,7 @@ void MainWindow::addSelectedFavorite()
     } else if (!currentWatchedChannel.isEmpty() && !channelDisplayListContains(favorites_, currentWatchedChannel)) {
         channelName = currentWatchedChannel;
     } else {
-        const QStringList candidates = favoriteCandidatesFromTable(channelsTable_, favorites_);
+        const QStringList candidates = favoriteCandidatesFromChannels(channelsModel_->labels(), favorites_);
         if (candidates.isEmpty()) {
             showInformationDialog("No channels available",
                                   "There are no additional channels available to add to favorites.");
@@ -12911,7 +14847,9 @@ void MainWindow::startSignalMonitor(int adapter, int frontend)
         return;
     }
 
-    appendLog(QString("signal: launch %1").arg(formatCommandLine(femonExe, args)));
+    logRecord(LogCategory::Signal, LogLevel::Info, [&]() {
+        return QString("signal: launch %1").arg(formatCommandLine(femonExe, args));
+    });
 }
 
 void MainWindow::stopSignalMonitor()
@@ -13047,7 +14985,7 @@ void MainWindow::updateTvGuideDialogFromCurrentCache(bool showStatusMessage)
                                                                    lastGuideChannelOrder_,
                                                                    favorites_,
                                                                    favoriteShowRatings_,
-                                                                   scheduledSwitches_,
+                                                                   scheduledSwitches_.items(),
                                                                    guideShowTodayOnlyListingsEnabled(),
                                                                    statusText);
 
@@ -13059,7 +14997,7 @@ void MainWindow::updateTvGuideDialogFromCurrentCache(bool showStatusMessage)
                                      lastGuideWindowStartUtc_,
                                      lastGuideSlotMinutes_,
                                      lastGuideSlotCount_,
-                                     scheduledSwitches_,
+                                     scheduledSwitches_.items(),
                                      statusText);
         lastGuideDialogPresentationStamp_ = presentationStamp;
     }
@@ -13349,7 +15287,7 @@ void MainWindow::restoreChannelSidebarSizing()
 
 void MainWindow::restoreLastPlayedChannel()
 {
-    if (channelsTable_ == nullptr || channelsTable_->rowCount() == 0) {
+    if (channelsModel_ == nullptr || channelsModel_->rowCount() == 0) {
         return;
     }
 
@@ -13851,160 +15789,36 @@ void MainWindow::loadFavorites()
     }
 }
 
-void MainWindow::loadXspfChannelHints()
+void MainWindow::loadChannelsFileIfPresent()
 {
-    xspfNumberByTuneKey_.clear();
-    xspfProgramByChannel_.clear();
-
-    QString jsonError;
-    const bool loadedJsonHints = loadChannelHintsFromJson(xspfNumberByTuneKey_,
-                                                          xspfProgramByChannel_,
-                                                          &jsonError);
-    if (loadedJsonHints) {
-        appendLog(QString("Loaded %1 saved channel hint mapping%2 from %3")
-                      .arg(xspfProgramByChannel_.size())
-                      .arg(xspfProgramByChannel_.size() == 1 ? QString() : QString("s"))
-                      .arg(resolveChannelHintsJsonPath()));
-    } else if (!jsonError.trimmed().isEmpty()) {
-        appendLog(jsonError);
-    }
-
-    const QString xspfPath = QDir::home().filePath("Desktop/tv.xspf");
-    QFile file(xspfPath);
-    if (!file.exists()) {
-        if (!loadedJsonHints) {
-            appendLog("No saved channel hint JSON or XSPF playlist found; using channels.conf metadata.");
-        }
-        return;
-    }
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        appendLog("Could not open XSPF playlist: " + xspfPath);
-        return;
-    }
-
-    QXmlStreamReader xml(&file);
-    QString currentTitle;
-    QString currentProgram;
-    QString currentFrequency;
-    bool inTrack = false;
-    bool inVlcOption = false;
-    QString optionText;
-
-    auto flushTrack = [this, &currentTitle, &currentProgram, &currentFrequency]() {
-        if (currentTitle.isEmpty() || currentProgram.isEmpty()) {
-            return;
-        }
-        const int firstSpace = currentTitle.indexOf(' ');
-        if (firstSpace <= 0 || firstSpace >= currentTitle.size() - 1) {
-            return;
-        }
-        const QString channelNumber = currentTitle.left(firstSpace).trimmed();
-        const QString channelName = currentTitle.mid(firstSpace + 1).trimmed();
-        if (!channelName.isEmpty()) {
-            const QString normalizedChannelNumber = normalizeChannelNumberHint(channelNumber);
-            if (!normalizedChannelNumber.isEmpty() && !currentFrequency.isEmpty()) {
-                xspfNumberByTuneKey_.insert(tuneKey(currentFrequency, currentProgram), normalizedChannelNumber);
-            }
-            xspfProgramByChannel_.insert(channelName, currentProgram);
-            const QString displayLabel = channelDisplayLabel(channelName, normalizedChannelNumber);
-            if (!displayLabel.isEmpty() && displayLabel != channelName) {
-                xspfProgramByChannel_.insert(displayLabel, currentProgram);
-            }
-        }
-    };
-
-    while (!xml.atEnd()) {
-        xml.readNext();
-        if (xml.isStartElement()) {
-            const QStringView name = xml.name();
-            if (name == u"track") {
-                inTrack = true;
-                currentTitle.clear();
-                currentProgram.clear();
-                currentFrequency.clear();
-            } else if (inTrack && name == u"title") {
-                currentTitle = xml.readElementText(QXmlStreamReader::SkipChildElements).trimmed();
-            } else if (inTrack && name == u"location") {
-                const QString location = xml.readElementText(QXmlStreamReader::SkipChildElements).trimmed();
-                const QRegularExpressionMatch match = QRegularExpression(QStringLiteral("frequency=(\\d+)")).match(location);
-                currentFrequency = match.hasMatch() ? match.captured(1) : QString();
-            } else if (inTrack && name == u"option" && xml.namespaceUri().toString().contains("videolan.org")) {
-                inVlcOption = true;
-                optionText.clear();
-            }
-        } else if (xml.isCharacters() && inVlcOption) {
-            optionText += xml.text().toString();
-        } else if (xml.isEndElement()) {
-            const QStringView name = xml.name();
-            if (inVlcOption && name == u"option") {
-                inVlcOption = false;
-                const QString opt = optionText.trimmed();
-                if (opt.startsWith("program=")) {
-                    currentProgram = opt.mid(QString("program=").size()).trimmed();
-                }
-                optionText.clear();
-            } else if (inTrack && name == u"track") {
-                flushTrack();
-                inTrack = false;
-                currentTitle.clear();
-                currentProgram.clear();
-                currentFrequency.clear();
-            }
-        }
+    const QString path = resolveChannelsFilePath();
+    QStringList lines;
+    QStringList logLines;
+    const bool loaded = readChannelsFileLines(path, &lines, &logLines);
+    for (const QString &line : logLines) {
+        appendLog(line);
     }
-
-    if (xml.hasError()) {
-        appendLog("Failed to parse XSPF playlist: " + xml.errorString());
-        if (!loadedJsonHints) {
-            xspfNumberByTuneKey_.clear();
-            xspfProgramByChannel_.clear();
-        }
-        return;
+    if (!path.isEmpty()) {
+        channelsFilePath_ = path;
     }
-
-    QString saveError;
-    if (!saveChannelHintsToJson(xspfNumberByTuneKey_, xspfProgramByChannel_, &saveError)
-        && !saveError.trimmed().isEmpty()) {
-        appendLog(saveError);
+    if (loaded) {
+        applyChannelsFileLines(path, lines);
     }
-
-    appendLog(QString("Loaded %1 XSPF program mappings from %2 and cached them to %3")
-                  .arg(xspfProgramByChannel_.size())
-                  .arg(xspfPath)
-                  .arg(resolveChannelHintsJsonPath()));
 }
 
-void MainWindow::loadChannelsFileIfPresent()
+void MainWindow::applyChannelsFileLines(const QString &channelsFilePath, const QStringList &lines)
 {
-    const QString appDataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
-    if (appDataPath.isEmpty()) {
-        appendLog("Could not resolve app data directory for channels list.");
-        return;
-    }
-
-    QDir dir(appDataPath);
-    channelsFilePath_ = dir.filePath("channels.conf");
-    QFile file(channelsFilePath_);
-    if (!file.exists()) {
-        appendLog("No saved channels file found. Run a scan once to create one.");
-        return;
-    }
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        appendLog("Could not open channels file: " + channelsFilePath_);
-        return;
-    }
-
-    channelsTable_->setRowCount(0);
+    channelTableFlushTimer_->stop();
+    pendingChannelRows_.clear();
+    channelsModel_->clear();
     channelLines_.clear();
-
-    while (!file.atEnd()) {
-        const QString line = QString::fromUtf8(file.readLine()).trimmed();
-        if (!line.isEmpty()) {
-            parseAndStoreLine(line);
-        }
+    invalidateGuideChannelIndex();
+    for (const QString &line : lines) {
+        parseAndStoreLine(line);
     }
+    flushPendingChannelRows();
 
     appendLog(QString("Loaded %1 channel entries from %2")
                   .arg(channelLines_.size())
-                  .arg(channelsFilePath_));
+                  .arg(channelsFilePath));
 }
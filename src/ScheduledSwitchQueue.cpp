@@ -0,0 +1,172 @@
+#include "ScheduledSwitchQueue.h"
+
+#include <utility>
+
+bool ScheduledSwitchQueue::isEmpty() const
+{
+    return entries_.isEmpty();
+}
+
+int ScheduledSwitchQueue::size() const
+{
+    return static_cast<int>(entries_.size());
+}
+
+bool ScheduledSwitchQueue::contains(const QString &key) const
+{
+    return !key.isEmpty() && startByKey_.contains(key);
+}
+
+TvGuideScheduledSwitch ScheduledSwitchQueue::value(const QString &key) const
+{
+    const auto startIt = startByKey_.constFind(key);
+    if (key.isEmpty() || startIt == startByKey_.cend()) {
+        return {};
+    }
+    return entries_.value({startIt.value(), key});
+}
+
+bool ScheduledSwitchQueue::insert(const QString &key, const TvGuideScheduledSwitch &scheduledSwitch)
+{
+    if (!insertEntry(key, scheduledSwitch)) {
+        return false;
+    }
+    journal_.append({true, key, scheduledSwitch});
+    return true;
+}
+
+bool ScheduledSwitchQueue::restore(const QString &key, const TvGuideScheduledSwitch &scheduledSwitch)
+{
+    return insertEntry(key, scheduledSwitch);
+}
+
+bool ScheduledSwitchQueue::insertEntry(const QString &key, const TvGuideScheduledSwitch &scheduledSwitch)
+{
+    if (key.isEmpty()
+        || !scheduledSwitch.startUtc.isValid()
+        || !scheduledSwitch.endUtc.isValid()
+        || scheduledSwitch.endUtc <= scheduledSwitch.startUtc
+        || startByKey_.contains(key)) {
+        return false;
+    }
+
+    const qint64 startSecs = scheduledSwitch.startUtc.toSecsSinceEpoch();
+    entries_.insert({startSecs, key}, scheduledSwitch);
+    startByKey_.insert(key, startSecs);
+    ++durationCounts_[scheduledSwitch.endUtc.toSecsSinceEpoch() - startSecs];
+    itemsCacheValid_ = false;
+    return true;
+}
+
+bool ScheduledSwitchQueue::remove(const QString &key)
+{
+    if (key.isEmpty()) {
+        return false;
+    }
+    const auto startIt = startByKey_.find(key);
+    if (startIt == startByKey_.end()) {
+        return false;
+    }
+
+    const qint64 startSecs = startIt.value();
+    const TvGuideScheduledSwitch removed = entries_.take({startSecs, key});
+    startByKey_.erase(startIt);
+    const auto durationIt = durationCounts_.find(removed.endUtc.toSecsSinceEpoch() - startSecs);
+    if (durationIt != durationCounts_.end() && --durationIt.value() <= 0) {
+        durationCounts_.erase(durationIt);
+    }
+    itemsCacheValid_ = false;
+    journal_.append({false, key, {}});
+    return true;
+}
+
+void ScheduledSwitchQueue::clear()
+{
+    for (auto it = startByKey_.cbegin(); it != startByKey_.cend(); ++it) {
+        journal_.append({false, it.key(), {}});
+    }
+    entries_.clear();
+    startByKey_.clear();
+    durationCounts_.clear();
+    itemsCacheValid_ = false;
+}
+
+const TvGuideScheduledSwitch &ScheduledSwitchQueue::first() const
+{
+    return entries_.first();
+}
+
+const QList<TvGuideScheduledSwitch> &ScheduledSwitchQueue::items() const
+{
+    if (!itemsCacheValid_) {
+        itemsCache_ = entries_.values();
+        itemsCacheValid_ = true;
+    }
+    return itemsCache_;
+}
+
+QList<TvGuideScheduledSwitch> ScheduledSwitchQueue::startedBy(const QDateTime &nowUtc) const
+{
+    QList<TvGuideScheduledSwitch> started;
+    const qint64 nowSecs = nowUtc.toSecsSinceEpoch();
+    for (auto it = entries_.cbegin(); it != entries_.cend() && it.key().first <= nowSecs; ++it) {
+        started.append(it.value());
+    }
+    return started;
+}
+
+QList<TvGuideScheduledSwitch> ScheduledSwitchQueue::startingAt(const QDateTime &startUtc) const
+{
+    QList<TvGuideScheduledSwitch> matches;
+    if (!startUtc.isValid()) {
+        return matches;
+    }
+    const qint64 startSecs = startUtc.toSecsSinceEpoch();
+    for (auto it = entries_.lowerBound({startSecs, QString()}); it != entries_.cend() && it.key().first == startSecs;
+         ++it) {
+        matches.append(it.value());
+    }
+    return matches;
+}
+
+QList<TvGuideScheduledSwitch> ScheduledSwitchQueue::nextStartingAfter(const QDateTime &afterUtc) const
+{
+    if (!afterUtc.isValid()) {
+        return {};
+    }
+    const auto nextIt = entries_.lowerBound({afterUtc.toSecsSinceEpoch() + 1, QString()});
+    if (nextIt == entries_.cend()) {
+        return {};
+    }
+    return startingAt(nextIt.value().startUtc);
+}
+
+QList<TvGuideScheduledSwitch> ScheduledSwitchQueue::overlapping(const QDateTime &startUtc, const QDateTime &endUtc) const
+{
+    QList<TvGuideScheduledSwitch> matches;
+    if (entries_.isEmpty() || !startUtc.isValid() || !endUtc.isValid() || endUtc <= startUtc) {
+        return matches;
+    }
+
+    const qint64 startSecs = startUtc.toSecsSinceEpoch();
+    const qint64 endSecs = endUtc.toSecsSinceEpoch();
+    const qint64 longestDurationSecs = durationCounts_.lastKey();
+    for (auto it = entries_.lowerBound({startSecs - longestDurationSecs + 1, QString()});
+         it != entries_.cend() && it.key().first < endSecs;
+         ++it) {
+        if (it.value().endUtc.toSecsSinceEpoch() > startSecs) {
+            matches.append(it.value());
+        }
+    }
+    return matches;
+}
+
+QList<TvGuideScheduledSwitch> ScheduledSwitchQueue::activeAt(const QDateTime &atUtc) const
+{
+    return overlapping(atUtc, atUtc.addSecs(1));
+}
+
+QList<ScheduledSwitchQueue::JournalEntry> ScheduledSwitchQueue::takeJournal()
+{
+    return std::exchange(journal_, {});
+}
@@ -0,0 +1,246 @@
+#include "SchedulesDirectClient.h"
+
+#include <QJsonObject>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QTimer>
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+constexpr int kRetryBaseDelayMs = 500;
+constexpr int kRetryMaxDelayMs = 8000;
+
+QString serverErrorMessage(const QJsonDocument &document)
+{
+    if (!document.isObject()) {
+        return {};
+    }
+    const QJsonObject object = document.object();
+    const QString message = object.value("message").toString().trimmed();
+    const QString response = object.value("response").toString().trimmed();
+    if (!message.isEmpty() && !response.isEmpty()) {
+        return QString("%1 (%2)").arg(message, response);
+    }
+    return !message.isEmpty() ? message : response;
+}
+}
+
+SchedulesDirectClient::SchedulesDirectClient(const QString &userAgent, QObject *parent)
+    : QObject(parent)
+    , networkManager_(new QNetworkAccessManager(this))
+    , userAgent_(userAgent)
+{
+}
+
+SchedulesDirectClient::~SchedulesDirectClient()
+{
+    // Callbacks may point into a caller that is already gone, so pending requests are dropped silently here.
+    for (auto it = inFlight_.cbegin(); it != inFlight_.cend(); ++it) {
+        it.key()->disconnect(this);
+        it.key()->abort();
+    }
+}
+
+void SchedulesDirectClient::setToken(const QString &token)
+{
+    token_ = token.trimmed();
+}
+
+void SchedulesDirectClient::setMaxConcurrentRequests(int limit)
+{
+    maxConcurrentRequests_ = std::max(1, limit);
+    startQueuedRequests();
+}
+
+int SchedulesDirectClient::maxConcurrentRequests() const
+{
+    return maxConcurrentRequests_;
+}
+
+void SchedulesDirectClient::setMaxRetries(int retries)
+{
+    maxRetries_ = std::max(0, retries);
+}
+
+void SchedulesDirectClient::enqueue(const Request &request, Callback callback)
+{
+    queue_.append({request, std::move(callback), 0});
+    ++totalRequests_;
+    startQueuedRequests();
+}
+
+void SchedulesDirectClient::cancel()
+{
+    Reply cancelledReply;
+    cancelledReply.cancelled = true;
+    cancelledReply.errorText = "Request cancelled";
+
+    // Backoff timers find their id gone and do nothing; the requests they held are finished here instead.
+    const QHash<quint64, PendingRequest> backingOff = std::exchange(backingOff_, {});
+    const QList<PendingRequest> queued = std::exchange(queue_, {});
+    const QHash<QNetworkReply *, PendingRequest> inFlight = std::exchange(inFlight_, {});
+    for (auto it = inFlight.cbegin(); it != inFlight.cend(); ++it) {
+        QNetworkReply *reply = it.key();
+        delete timeoutTimers_.take(reply);
+        timedOutReplies_.remove(reply);
+        reply->disconnect(this);
+        reply->abort();
+        reply->deleteLater();
+    }
+    for (const PendingRequest &pending : queued) {
+        finishRequest(pending, cancelledReply);
+    }
+    for (const PendingRequest &pending : inFlight) {
+        finishRequest(pending, cancelledReply);
+    }
+    for (const PendingRequest &pending : backingOff) {
+        finishRequest(pending, cancelledReply);
+    }
+    checkIdle();
+}
+
+bool SchedulesDirectClient::isIdle() const
+{
+    return queue_.isEmpty() && inFlight_.isEmpty() && backingOff_.isEmpty();
+}
+
+qint64 SchedulesDirectClient::bytesReceived() const
+{
+    return bytesReceived_;
+}
+
+void SchedulesDirectClient::startQueuedRequests()
+{
+    while (!queue_.isEmpty() && inFlight_.size() < maxConcurrentRequests_) {
+        startRequest(queue_.takeFirst());
+    }
+}
+
+void SchedulesDirectClient::startRequest(PendingRequest pending)
+{
+    const Request &request = pending.request;
+    QNetworkRequest networkRequest(request.url);
+    networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+    networkRequest.setRawHeader("Accept", "application/json");
+    networkRequest.setRawHeader("User-Agent", userAgent_.toUtf8());
+    // Accept-Encoding is left to QNetworkAccessManager: it advertises gzip/deflate itself and only inflates
+    // the body transparently when the header was not set by hand.
+    if (!token_.isEmpty()) {
+        networkRequest.setRawHeader("token", token_.toUtf8());
+    }
+
+    const QByteArray body = request.body.isNull() ? QByteArray() : request.body.toJson(QJsonDocument::Compact);
+    const QByteArray method = request.method.trimmed().toUpper();
+    QNetworkReply *reply = nullptr;
+    if (method.isEmpty()) {
+        reply = request.body.isNull() ? networkManager_->get(networkRequest)
+                                      : networkManager_->post(networkRequest, body);
+    } else if (method == "GET") {
+        reply = networkManager_->get(networkRequest);
+    } else if (method == "POST") {
+        reply = networkManager_->post(networkRequest, body);
+    } else {
+        reply = networkManager_->sendCustomRequest(networkRequest, method, body);
+    }
+
+    auto *timeoutTimer = new QTimer(this);
+    timeoutTimer->setSingleShot(true);
+    connect(timeoutTimer, &QTimer::timeout, this, [this, reply]() {
+        timedOutReplies_.insert(reply, true);
+        reply->abort();
+    });
+    timeoutTimer->start(std::max(1, request.timeoutMs));
+    timeoutTimers_.insert(reply, timeoutTimer);
+    inFlight_.insert(reply, std::move(pending));
+    connect(reply, &QNetworkReply::finished, this, [this, reply]() {
+        handleReplyFinished(reply);
+    });
+}
+
+void SchedulesDirectClient::handleReplyFinished(QNetworkReply *reply)
+{
+    reply->deleteLater();
+    delete timeoutTimers_.take(reply);
+    const bool timedOut = timedOutReplies_.take(reply);
+    const auto pendingIt = inFlight_.find(reply);
+    if (pendingIt == inFlight_.end()) {
+        return;
+    }
+    PendingRequest pending = std::move(pendingIt.value());
+    inFlight_.erase(pendingIt);
+
+    Reply result;
+    result.timedOut = timedOut;
+    const QVariant statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute);
+    result.httpStatus = statusCode.isValid() ? statusCode.toInt() : 0;
+    result.body = reply->readAll();
+    bytesReceived_ += result.body.size();
+
+    QJsonParseError parseError{};
+    result.document = QJsonDocument::fromJson(result.body, &parseError);
+    if (!result.body.trimmed().isEmpty() && parseError.error != QJsonParseError::NoError) {
+        result.errorText = QString("Invalid JSON response: %1").arg(parseError.errorString());
+    }
+
+    if (timedOut) {
+        result.errorText = QString("Request timed out after %1 ms").arg(pending.request.timeoutMs);
+    } else if (reply->error() != QNetworkReply::NoError) {
+        const QString serverMessage = serverErrorMessage(result.document);
+        result.errorText = serverMessage.isEmpty() ? reply->errorString()
+                                                   : QString("%1: %2").arg(reply->errorString(), serverMessage);
+    } else if (result.errorText.trimmed().isEmpty() && (result.httpStatus < 200 || result.httpStatus >= 300)) {
+        result.errorText = QString("Unexpected HTTP status %1").arg(result.httpStatus);
+    }
+
+    if (!result.ok() && shouldRetry(result) && pending.attempt < maxRetries_) {
+        const int delayMs = std::min(kRetryMaxDelayMs, kRetryBaseDelayMs << pending.attempt);
+        ++pending.attempt;
+        const quint64 backoffId = ++nextBackoffId_;
+        backingOff_.insert(backoffId, std::move(pending));
+        QTimer::singleShot(delayMs, this, [this, backoffId]() {
+            const auto backoffIt = backingOff_.find(backoffId);
+            if (backoffIt == backingOff_.end()) {
+                return;
+            }
+            queue_.prepend(std::move(backoffIt.value()));
+            backingOff_.erase(backoffIt);
+            startQueuedRequests();
+        });
+        startQueuedRequests();
+        return;
+    }
+
+    finishRequest(pending, result);
+    startQueuedRequests();
+    checkIdle();
+}
+
+void SchedulesDirectClient::finishRequest(const PendingRequest &pending, const Reply &reply)
+{
+    ++finishedRequests_;
+    if (pending.callback) {
+        pending.callback(reply);
+    }
+    emit progress(finishedRequests_, totalRequests_, bytesReceived_);
+}
+
+void SchedulesDirectClient::checkIdle()
+{
+    if (isIdle()) {
+        emit idle();
+    }
+}
+
+bool SchedulesDirectClient::shouldRetry(const Reply &reply)
+{
+    if (reply.cancelled) {
+        return false;
+    }
+    if (reply.timedOut || reply.httpStatus == 0) {
+        return true;
+    }
+    return reply.httpStatus == 429 || reply.httpStatus >= 500;
+}
@@ -0,0 +1,173 @@
+#include "StartupTrace.h"
+
+#include "LogSink.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QList>
+#include <QSaveFile>
+#include <QStringList>
+
+namespace {
+
+struct StartupTraceEvent {
+    QString name;
+    qint64 startNs{0};
+    qint64 durationNs{-1};
+};
+
+struct StartupTraceState {
+    qint64 originNs{0};
+    bool started{false};
+    bool finished{false};
+    QList<StartupTraceEvent> events;
+};
+
+StartupTraceState &startupTraceState()
+{
+    static StartupTraceState state;
+    return state;
+}
+
+bool startupTraceRecording()
+{
+    const StartupTraceState &state = startupTraceState();
+    return state.started && !state.finished;
+}
+
+qint64 nsToMs(qint64 ns)
+{
+    return ns / 1000000;
+}
+
+QString requestedStartupTracePath()
+{
+    const QString value = qEnvironmentVariable("TV_TUNER_GUI_STARTUP_TRACE").trimmed();
+    if (value.isEmpty() || value == "0" || value.compare("false", Qt::CaseInsensitive) == 0) {
+        return {};
+    }
+    if (value == "1" || value.compare("true", Qt::CaseInsensitive) == 0) {
+        const QFileInfo logInfo(resolveProjectLogPath());
+        return logInfo.dir().filePath("tv_tuner_gui.startup-trace.json");
+    }
+    return value;
+}
+
+}
+
+void beginStartupTrace()
+{
+    StartupTraceState &state = startupTraceState();
+    if (state.started) {
+        return;
+    }
+    state.started = true;
+    state.originNs = logMonotonicNowNs();
+}
+
+void markStartupMilestone(const QString &name)
+{
+    if (!startupTraceRecording()) {
+        return;
+    }
+    startupTraceState().events.append({name, logMonotonicNowNs(), -1});
+}
+
+bool startupTraceFinished()
+{
+    return startupTraceState().finished;
+}
+
+QString finishStartupTrace()
+{
+    StartupTraceState &state = startupTraceState();
+    if (!state.started || state.finished) {
+        return {};
+    }
+    state.finished = true;
+
+    QStringList milestones;
+    QStringList stages;
+    for (const StartupTraceEvent &event : state.events) {
+        if (event.durationNs < 0) {
+            milestones.append(QString("%1=%2ms").arg(event.name).arg(nsToMs(event.startNs - state.originNs)));
+        } else {
+            stages.append(QString("%1=%2ms").arg(event.name).arg(nsToMs(event.durationNs)));
+        }
+    }
+
+    QString summary = QString("startup: %1 stages: %2")
+                          .arg(milestones.isEmpty() ? QString("no milestones") : milestones.join(' '),
+                               stages.isEmpty() ? QString("none") : stages.join(", "));
+    const QString tracePath = requestedStartupTracePath();
+    if (!tracePath.isEmpty()) {
+        QString errorText;
+        if (exportStartupTraceJson(tracePath, &errorText)) {
+            summary += QString(" trace=%1").arg(tracePath);
+        } else {
+            summary += QString(" trace-error=%1").arg(errorText);
+        }
+    }
+    return summary;
+}
+
+bool exportStartupTraceJson(const QString &path, QString *errorText)
+{
+    const StartupTraceState &state = startupTraceState();
+    const qint64 pid = QCoreApplication::applicationPid();
+    QJsonArray traceEvents;
+    for (const StartupTraceEvent &event : state.events) {
+        QJsonObject object;
+        object.insert("name", event.name);
+        object.insert("cat", "startup");
+        object.insert("pid", pid);
+        object.insert("tid", 1);
+        object.insert("ts", (event.startNs - state.originNs) / 1000);
+        if (event.durationNs < 0) {
+            object.insert("ph", "i");
+            object.insert("s", "p");
+        } else {
+            object.insert("ph", "X");
+            object.insert("dur", event.durationNs / 1000);
+        }
+        traceEvents.append(object);
+    }
+
+    QJsonObject root;
+    root.insert("traceEvents", traceEvents);
+    root.insert("displayTimeUnit", "ms");
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        if (errorText != nullptr) {
+            *errorText = QString("Could not open startup trace %1 for writing: %2").arg(path, file.errorString());
+        }
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    if (!file.commit()) {
+        if (errorText != nullptr) {
+            *errorText = QString("Could not save startup trace %1: %2").arg(path, file.errorString());
+        }
+        return false;
+    }
+    return true;
+}
+
+StartupTraceScope::StartupTraceScope(const char *name)
+    : name_(name)
+    , startNs_(startupTraceRecording() ? logMonotonicNowNs() : 0)
+{
+}
+
+StartupTraceScope::~StartupTraceScope()
+{
+    if (startNs_ == 0 || !startupTraceRecording()) {
+        return;
+    }
+    startupTraceState().events.append({QString::fromLatin1(name_), startNs_, logMonotonicNowNs() - startNs_});
+}
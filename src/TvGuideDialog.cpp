@@ -1,17 +1,24 @@
 #include "TvGuideDialog.h"
 
 #include <QAbstractItemView>
+#include <QAbstractListModel>
 #include <QAbstractScrollArea>
+#include <QCache>
 #include <QColor>
+#include <QDebug>
+#include <QElapsedTimer>
 #include <QFrame>
+#include <QFutureWatcher>
 #include <QFontMetrics>
 #include <QHeaderView>
 #include <QApplication>
 #include <QHBoxLayout>
 #include <QGridLayout>
+#include <QHideEvent>
+#include <QItemSelectionModel>
 #include <QLabel>
 #include <QLineEdit>
-#include <QListWidget>
+#include <QListView>
 #include <QMouseEvent>
 #include <QPainter>
 #include <QPlainTextEdit>
@@ -20,19 +27,26 @@
 #include <QRegularExpression>
 #include <QScrollArea>
 #include <QScrollBar>
+#include <QShowEvent>
 #include <QSet>
 #include <QStyledItemDelegate>
 #include <QStyle>
 #include <QStyleOptionButton>
 #include <QTabWidget>
-#include <QTextDocument>
+#include <QTextLayout>
+#include <QThreadPool>
+#include <QTimeZone>
 #include <QTimer>
+#include <QtConcurrent/QtConcurrentRun>
 #include <QVBoxLayout>
 #include <QWidget>
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <utility>
 
 namespace {
 
@@ -48,6 +62,8 @@ constexpr int kGuideWatchNowButtonWidth = 118;
 constexpr int kGuideWatchNowButtonHeight = 24;
 constexpr int kGuideEntrySectionSpacing = 4;
 constexpr int kDefaultFavoriteShowRating = 1;
+constexpr int kDefaultSearchBenchmarkEntryCount = 50000;
+constexpr int kSearchBenchmarkRepetitions = 25;
 constexpr int kSearchResultMargin = 8;
 constexpr int kSearchResultSpacing = 10;
 constexpr int kSearchButtonMinWidth = 132;
@@ -55,6 +71,9 @@ constexpr int kSearchButtonHeight = 28;
 constexpr int kSearchButtonSpacing = 6;
 constexpr int kSearchButtonHorizontalPadding = 28;
 constexpr int kSearchSynopsisLineBudget = 2;
+constexpr int kGuideTextHeightCacheSize = 8192;
+constexpr int kGuideTextLayoutCacheSize = 1024;
+constexpr int kGuideRecentThemeTileSets = 2;
 
 enum SearchResultRoles {
     SearchTitleRole = Qt::UserRole + 1,
@@ -95,54 +114,105 @@ struct TvGuideVisualTheme {
     QFont tabFont;
     QFont buttonFont;
     QFont inputFont;
+    // Fingerprint of every color and font above; equal keys render identical guide pixels.
+    size_t themeKey{0};
 };
 
+size_t guideVisualThemeKey(const TvGuideVisualTheme &visualTheme)
+{
+    size_t seed = 0;
+    for (const QColor *color : {&visualTheme.background,
+                                &visualTheme.text,
+                                &visualTheme.secondaryText,
+                                &visualTheme.episodeText,
+                                &visualTheme.border,
+                                &visualTheme.tabBackground,
+                                &visualTheme.tabSelectedBackground,
+                                &visualTheme.tabText,
+                                &visualTheme.buttonBackground,
+                                &visualTheme.buttonText,
+                                &visualTheme.buttonBorder,
+                                &visualTheme.gridLine,
+                                &visualTheme.entryBackground,
+                                &visualTheme.currentEntryBackground,
+                                &visualTheme.entryBorder,
+                                &visualTheme.nowLine,
+                                &visualTheme.actionBackground,
+                                &visualTheme.actionBorder,
+                                &visualTheme.actionText,
+                                &visualTheme.actionFavoriteText,
+                                &visualTheme.emptyText}) {
+        seed = qHashMulti(seed, color->isValid(), static_cast<quint64>(color->rgba64()));
+    }
+    for (const QFont *font : {&visualTheme.guideFont,
+                              &visualTheme.guideHeaderFont,
+                              &visualTheme.guideChannelFont,
+                              &visualTheme.guideSearchFont,
+                              &visualTheme.logFont,
+                              &visualTheme.tabFont,
+                              &visualTheme.buttonFont,
+                              &visualTheme.inputFont}) {
+        seed = qHashMulti(seed, font->key());
+    }
+    return seed;
+}
+
 TvGuideVisualTheme guideVisualThemeFor(const DisplayTheme &theme)
 {
+    // Normalize once and read the roles straight from it; displayThemeColor() would re-normalize per role.
     const DisplayTheme normalized = normalizedDisplayTheme(theme);
     const QFont fallbackFont = QApplication::font();
+    const auto color = [&normalized](const char *key) {
+        return normalized.colors.value(QString::fromLatin1(key));
+    };
+    const auto font = [&normalized, &fallbackFont](const char *key) {
+        return qFontFromDisplayFontStyle(normalized.fonts.value(QString::fromLatin1(key)), fallbackFont);
+    };
 
     TvGuideVisualTheme visualTheme;
-    visualTheme.background = displayThemeColor(normalized, DisplayThemeKeys::GuideBackground);
-    visualTheme.text = displayThemeColor(normalized, DisplayThemeKeys::GuideText);
-    visualTheme.secondaryText = displayThemeColor(normalized, DisplayThemeKeys::GuideSecondaryText);
-    visualTheme.episodeText = displayThemeColor(normalized, DisplayThemeKeys::GuideEpisodeText);
-    visualTheme.border = displayThemeColor(normalized, DisplayThemeKeys::GuideBorder);
-    visualTheme.tabBackground = displayThemeColor(normalized, DisplayThemeKeys::GuideTabBackground);
-    visualTheme.tabSelectedBackground = displayThemeColor(normalized, DisplayThemeKeys::GuideTabSelectedBackground);
-    visualTheme.tabText = displayThemeColor(normalized, DisplayThemeKeys::GuideTabText);
-    visualTheme.buttonBackground = displayThemeColor(normalized, DisplayThemeKeys::GuideButtonBackground);
-    visualTheme.buttonText = displayThemeColor(normalized, DisplayThemeKeys::GuideButtonText);
-    visualTheme.buttonBorder = displayThemeColor(normalized, DisplayThemeKeys::GuideButtonBorder);
-    visualTheme.gridLine = displayThemeColor(normalized, DisplayThemeKeys::GuideGridLine);
-    visualTheme.entryBackground = displayThemeColor(normalized, DisplayThemeKeys::GuideEntryBackground);
-    visualTheme.currentEntryBackground = displayThemeColor(normalized, DisplayThemeKeys::GuideCurrentEntryBackground);
-    visualTheme.entryBorder = displayThemeColor(normalized, DisplayThemeKeys::GuideEntryBorder);
-    visualTheme.nowLine = displayThemeColor(normalized, DisplayThemeKeys::GuideNowLine);
-    visualTheme.actionBackground = displayThemeColor(normalized, DisplayThemeKeys::GuideActionBackground);
-    visualTheme.actionBorder = displayThemeColor(normalized, DisplayThemeKeys::GuideActionBorder);
-    visualTheme.actionText = displayThemeColor(normalized, DisplayThemeKeys::GuideActionText);
-    visualTheme.actionFavoriteText = displayThemeColor(normalized, DisplayThemeKeys::GuideActionFavoriteText);
-    visualTheme.emptyText = displayThemeColor(normalized, DisplayThemeKeys::GuideEmptyText);
-    visualTheme.guideFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(normalized, DisplayThemeKeys::GuideFont), fallbackFont);
-    visualTheme.guideHeaderFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(normalized, DisplayThemeKeys::GuideHeaderFont), fallbackFont);
-    visualTheme.guideChannelFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(normalized, DisplayThemeKeys::GuideChannelFont), fallbackFont);
-    visualTheme.guideSearchFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(normalized, DisplayThemeKeys::GuideSearchFont), fallbackFont);
-    visualTheme.logFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(normalized, DisplayThemeKeys::LogFont), fallbackFont);
-    visualTheme.tabFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(normalized, DisplayThemeKeys::TabFont), fallbackFont);
-    visualTheme.buttonFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(normalized, DisplayThemeKeys::ButtonFont), fallbackFont);
-    visualTheme.inputFont =
-        qFontFromDisplayFontStyle(displayThemeFontStyle(normalized, DisplayThemeKeys::InputFont), fallbackFont);
+    visualTheme.background = color(DisplayThemeKeys::GuideBackground);
+    visualTheme.text = color(DisplayThemeKeys::GuideText);
+    visualTheme.secondaryText = color(DisplayThemeKeys::GuideSecondaryText);
+    visualTheme.episodeText = color(DisplayThemeKeys::GuideEpisodeText);
+    visualTheme.border = color(DisplayThemeKeys::GuideBorder);
+    visualTheme.tabBackground = color(DisplayThemeKeys::GuideTabBackground);
+    visualTheme.tabSelectedBackground = color(DisplayThemeKeys::GuideTabSelectedBackground);
+    visualTheme.tabText = color(DisplayThemeKeys::GuideTabText);
+    visualTheme.buttonBackground = color(DisplayThemeKeys::GuideButtonBackground);
+    visualTheme.buttonText = color(DisplayThemeKeys::GuideButtonText);
+    visualTheme.buttonBorder = color(DisplayThemeKeys::GuideButtonBorder);
+    visualTheme.gridLine = color(DisplayThemeKeys::GuideGridLine);
+    visualTheme.entryBackground = color(DisplayThemeKeys::GuideEntryBackground);
+    visualTheme.currentEntryBackground = color(DisplayThemeKeys::GuideCurrentEntryBackground);
+    visualTheme.entryBorder = color(DisplayThemeKeys::GuideEntryBorder);
+    visualTheme.nowLine = color(DisplayThemeKeys::GuideNowLine);
+    visualTheme.actionBackground = color(DisplayThemeKeys::GuideActionBackground);
+    visualTheme.actionBorder = color(DisplayThemeKeys::GuideActionBorder);
+    visualTheme.actionText = color(DisplayThemeKeys::GuideActionText);
+    visualTheme.actionFavoriteText = color(DisplayThemeKeys::GuideActionFavoriteText);
+    visualTheme.emptyText = color(DisplayThemeKeys::GuideEmptyText);
+    visualTheme.guideFont = font(DisplayThemeKeys::GuideFont);
+    visualTheme.guideHeaderFont = font(DisplayThemeKeys::GuideHeaderFont);
+    visualTheme.guideChannelFont = font(DisplayThemeKeys::GuideChannelFont);
+    visualTheme.guideSearchFont = font(DisplayThemeKeys::GuideSearchFont);
+    visualTheme.logFont = font(DisplayThemeKeys::LogFont);
+    visualTheme.tabFont = font(DisplayThemeKeys::TabFont);
+    visualTheme.buttonFont = font(DisplayThemeKeys::ButtonFont);
+    visualTheme.inputFont = font(DisplayThemeKeys::InputFont);
+    visualTheme.themeKey = guideVisualThemeKey(visualTheme);
     return visualTheme;
 }
 
+bool guideEntryIsAiringNow(const TvGuideEntry &entry)
+{
+    if (!entry.startUtc.isValid() || !entry.endUtc.isValid()) {
+        return false;
+    }
+
+    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
+    return entry.startUtc <= nowUtc && nowUtc < entry.endUtc;
+}
+
 bool guideEntriesMatch(const TvGuideEntry &left, const TvGuideEntry &right)
 {
     return left.startUtc == right.startUtc
@@ -351,16 +421,140 @@ GuideEntryFonts guideEntryFonts(const QFont &baseFont)
     return fonts;
 }
 
-int wrappedTextHeight(const QFont &font, int width, const QString &text)
-{
-    if (width <= 0 || text.isEmpty()) {
-        return 0;
+struct WrappedTextKey {
+    QString fontKey;
+    int width{0};
+    QString text;
+
+    bool operator==(const WrappedTextKey &other) const
+    {
+        return width == other.width && fontKey == other.fontKey && text == other.text;
     }
+};
+
+size_t qHash(const WrappedTextKey &key, size_t seed = 0)
+{
+    return qHashMulti(seed, key.fontKey, key.width, key.text);
+}
+
+// Lays text out the way QPainter::drawText() does with Qt::TextWordWrap and returns the wrapped height.
+int layOutWrappedText(QTextLayout &layout, const QFont &font, int width, const QString &text)
+{
+    QString layoutText = text;
+    layoutText.replace('\n', QChar::LineSeparator);
+    layout.setText(layoutText);
+    layout.setFont(font);
+    QTextOption option(Qt::AlignLeft | Qt::AlignTop);
+    option.setWrapMode(QTextOption::WordWrap);
+    layout.setTextOption(option);
 
     const QFontMetrics metrics(font);
-    const QRect bounds =
-        metrics.boundingRect(QRect(0, 0, width, 1000000), Qt::AlignLeft | Qt::AlignTop | Qt::TextWordWrap, text);
-    return std::max(metrics.lineSpacing(), bounds.height());
+    const qreal leading = metrics.leading();
+    qreal y = -leading;
+    layout.beginLayout();
+    for (QTextLine line = layout.createLine(); line.isValid(); line = layout.createLine()) {
+        line.setLineWidth(width);
+        y += leading;
+        line.setPosition(QPointF(0.0, y));
+        y += line.height();
+    }
+    layout.endLayout();
+    return std::max(metrics.lineSpacing(), static_cast<int>(std::ceil(y)));
+}
+
+struct GuideWrappedText {
+    QTextLayout layout;
+    int height{0};
+};
+
+// Wrapped text shared by the guide canvas and the search result delegate, keyed by font, width and text so every
+// entry with the same title or synopsis reuses one layout. Heights are kept for many more texts than full layouts:
+// row measurement touches every entry in the guide window while only visible entries are drawn.
+class GuideTextLayoutCache
+{
+public:
+    GuideTextLayoutCache()
+        : heights_(kGuideTextHeightCacheSize)
+        , layouts_(kGuideTextLayoutCacheSize)
+    {
+    }
+
+    int height(const QFont &font, int width, const QString &text)
+    {
+        if (width <= 0 || text.isEmpty()) {
+            return 0;
+        }
+
+        WrappedTextKey key{font.key(), width, text};
+        if (const int *cachedHeight = heights_.object(key)) {
+            return *cachedHeight;
+        }
+        QTextLayout layout;
+        const int height = layOutWrappedText(layout, font, width, text);
+        heights_.insert(std::move(key), new int(height));
+        return height;
+    }
+
+    // The reference is valid until the next call into the cache.
+    const GuideWrappedText &wrappedText(const QFont &font, int width, const QString &text)
+    {
+        WrappedTextKey key{font.key(), width, text};
+        if (const GuideWrappedText *cached = layouts_.object(key)) {
+            return *cached;
+        }
+
+        auto *wrapped = new GuideWrappedText;
+        wrapped->layout.setCacheEnabled(true);
+        wrapped->height = layOutWrappedText(wrapped->layout, font, width, text);
+        heights_.insert(key, new int(wrapped->height));
+        layouts_.insert(std::move(key), wrapped);
+        return *wrapped;
+    }
+
+private:
+    QCache<WrappedTextKey, int> heights_;
+    QCache<WrappedTextKey, GuideWrappedText> layouts_;
+};
+
+struct GuideTextSection {
+    QString text;
+    QFont font;
+    QColor color;
+};
+
+int measureTextSections(GuideTextLayoutCache &textLayouts, int width, const QList<GuideTextSection> &sections)
+{
+    int height = 0;
+    for (const GuideTextSection &section : sections) {
+        if (section.text.isEmpty()) {
+            continue;
+        }
+        if (height > 0) {
+            height += kGuideEntrySectionSpacing;
+        }
+        height += textLayouts.height(section.font, width, section.text);
+    }
+    return height;
+}
+
+void drawTextSections(QPainter &painter,
+                      GuideTextLayoutCache &textLayouts,
+                      const QRect &textRect,
+                      const QList<GuideTextSection> &sections)
+{
+    int y = textRect.top();
+    painter.save();
+    painter.setClipRect(textRect, Qt::IntersectClip);
+    for (const GuideTextSection &section : sections) {
+        if (section.text.isEmpty() || y > textRect.bottom()) {
+            continue;
+        }
+        const GuideWrappedText &wrapped = textLayouts.wrappedText(section.font, textRect.width(), section.text);
+        painter.setPen(section.color);
+        wrapped.layout.draw(&painter, QPointF(textRect.left(), y));
+        y += wrapped.height + kGuideEntrySectionSpacing;
+    }
+    painter.restore();
 }
 
 bool pixmapMatchesSize(const QPixmap &pixmap, const QSize &logicalSize, qreal devicePixelRatio)
@@ -511,6 +705,38 @@ QString normalizedSearchText(const QString &title, const QString &episode, const
         .toCaseFolded();
 }
 
+quint64 searchTrigramKey(const QChar *text)
+{
+    return (static_cast<quint64>(text[0].unicode()) << 32)
+           | (static_cast<quint64>(text[1].unicode()) << 16)
+           | static_cast<quint64>(text[2].unicode());
+}
+
+struct SearchResultDisplayText {
+    QString ratedTitle;
+    QString episodeTitle;
+    QString synopsisBody;
+    QString timeChannelText;
+    QString toolTip;
+};
+
+SearchResultDisplayText searchResultDisplayText(const QString &channelName,
+                                                const TvGuideEntry &entry,
+                                                const QHash<QString, int> &favoriteShowRatings)
+{
+    const GuideEntryDisplayParts parts = displayPartsForEntry(entry);
+    SearchResultDisplayText text;
+    text.ratedTitle = formatRatedShowTitle(parts.title, favoriteShowRatings);
+    text.episodeTitle = parts.episodeTitle;
+    text.synopsisBody = parts.synopsisBody;
+    text.timeChannelText = QString("%1 - %2 | Channel: %3")
+                               .arg(formatGuideSearchDateTime(entry.startUtc),
+                                    formatGuideSearchDateTime(entry.endUtc),
+                                    channelName);
+    text.toolTip = formatEntryToolTip(entry, favoriteShowRatings);
+    return text;
+}
+
 struct SearchResultTextColors {
     QColor title;
     QColor meta;
@@ -533,31 +759,6 @@ SearchResultTextColors searchResultTextColors(const QPalette &palette,
             highlightedText.lighter(115)};
 }
 
-QString formatSearchResultHtml(const QString &title,
-                              const QString &timeChannel,
-                              const QString &episode,
-                              const QString &synopsis,
-                              const SearchResultTextColors &colors)
-{
-    QString html = QString("<div style=\"color:%1;\">"
-                           "<div style=\"font-weight:600; margin-bottom:4px;\">%2</div>")
-                       .arg(colors.title.name(), title.toHtmlEscaped());
-    if (!timeChannel.isEmpty()) {
-        html += QString("<div style=\"color:%1; margin-bottom:4px;\">%2</div>")
-                    .arg(colors.meta.name(), timeChannel.toHtmlEscaped());
-    }
-    if (!episode.isEmpty()) {
-        html += QString("<div style=\"color:%1; font-style:italic; margin-bottom:4px;\">Episode: %2</div>")
-                    .arg(colors.episode.name(), episode.toHtmlEscaped());
-    }
-    if (!synopsis.isEmpty()) {
-        html += QString("<div style=\"color:%1;\">Synopsis: %2</div>")
-                    .arg(colors.synopsis.name(), synopsis.toHtmlEscaped().replace('\n', "<br/>"));
-    }
-    html += "</div>";
-    return html;
-}
-
 int searchResultItemHeight(const QFontMetrics &metrics)
 {
     const int visibleLineCount = 4 + kSearchSynopsisLineBudget;
@@ -567,6 +768,7 @@ int searchResultItemHeight(const QFontMetrics &metrics)
 }
 
 void drawSearchResultText(QPainter &painter,
+                          GuideTextLayoutCache &textLayouts,
                           const QRect &textRect,
                           const QString &title,
                           const QString &timeChannel,
@@ -580,22 +782,19 @@ void drawSearchResultText(QPainter &painter,
         return;
     }
 
-    QTextDocument document;
-    document.setDefaultFont(painter.font());
-    document.setDocumentMargin(0);
-    document.setHtml(
-        formatSearchResultHtml(title,
-                               timeChannel,
-                               episode,
-                               synopsis,
-                               searchResultTextColors(palette, selected, visualTheme)));
-    document.setTextWidth(textRect.width());
-
-    painter.save();
-    painter.translate(textRect.topLeft());
-    const QRectF clipRect(0, 0, textRect.width(), textRect.height());
-    document.drawContents(&painter, clipRect);
-    painter.restore();
+    const SearchResultTextColors colors = searchResultTextColors(palette, selected, visualTheme);
+    const GuideEntryFonts fonts = guideEntryFonts(painter.font());
+    drawTextSections(painter,
+                     textLayouts,
+                     textRect,
+                     {{title, fonts.titleFont, colors.title},
+                      {timeChannel, painter.font(), colors.meta},
+                      {episode.isEmpty() ? QString() : QString("Episode: %1").arg(episode),
+                       fonts.episodeFont,
+                       colors.episode},
+                      {synopsis.isEmpty() ? QString() : QString("Synopsis: %1").arg(synopsis),
+                       painter.font(),
+                       colors.synopsis}});
 }
 
 struct SearchResultLayoutRects {
@@ -652,9 +851,12 @@ void drawGuideStyleActionButton(QPainter &painter,
 class SearchResultItemDelegate final : public QStyledItemDelegate
 {
 public:
-    explicit SearchResultItemDelegate(const TvGuideVisualTheme &visualTheme, QObject *parent = nullptr)
+    SearchResultItemDelegate(const TvGuideVisualTheme &visualTheme,
+                             std::shared_ptr<GuideTextLayoutCache> textLayouts,
+                             QObject *parent = nullptr)
         : QStyledItemDelegate(parent)
         , visualTheme_(visualTheme)
+        , textLayouts_(std::move(textLayouts))
     {
     }
 
@@ -693,6 +895,7 @@ public:
         const bool isSelected = option.state.testFlag(QStyle::State_Selected);
 
         drawSearchResultText(*painter,
+                             *textLayouts_,
                              rects.textRect,
                              title,
                              index.data(SearchTimeChannelRole).toString(),
@@ -715,33 +918,32 @@ public:
 
 private:
     TvGuideVisualTheme visualTheme_;
+    std::shared_ptr<GuideTextLayoutCache> textLayouts_;
 };
 
-int measureEntryTextHeight(const QFont &font, int width, const GuideEntryTextSections &sections)
+QList<GuideTextSection> entryTextSections(const GuideEntryTextSections &sections,
+                                          const QFont &baseFont,
+                                          const TvGuideVisualTheme &visualTheme)
+{
+    const GuideEntryFonts fonts = guideEntryFonts(baseFont);
+    return {{sections.title, fonts.titleFont, visualTheme.text},
+            {sections.episodeTitle, fonts.episodeFont, visualTheme.episodeText},
+            {sections.synopsisBody, fonts.synopsisFont, visualTheme.secondaryText}};
+}
+
+int measureEntryTextHeight(GuideTextLayoutCache &textLayouts,
+                           int width,
+                           const GuideEntryTextSections &sections,
+                           const TvGuideVisualTheme &visualTheme)
 {
     if (width <= 0 || sections.title.isEmpty()) {
         return 0;
     }
-
-    const GuideEntryFonts fonts = guideEntryFonts(font);
-    int height = 0;
-    auto appendHeight = [&](const QString &text, const QFont &sectionFont) {
-        if (text.isEmpty()) {
-            return;
-        }
-        if (height > 0) {
-            height += kGuideEntrySectionSpacing;
-        }
-        height += wrappedTextHeight(sectionFont, width, text);
-    };
-
-    appendHeight(sections.title, fonts.titleFont);
-    appendHeight(sections.episodeTitle, fonts.episodeFont);
-    appendHeight(sections.synopsisBody, fonts.synopsisFont);
-    return height;
+    return measureTextSections(textLayouts, width, entryTextSections(sections, visualTheme.guideFont, visualTheme));
 }
 
 void drawEntryText(QPainter &painter,
+                   GuideTextLayoutCache &textLayouts,
                    const QRect &textRect,
                    const GuideEntryTextSections &sections,
                    const TvGuideVisualTheme &visualTheme)
@@ -749,33 +951,7 @@ void drawEntryText(QPainter &painter,
     if (!textRect.isValid() || sections.title.isEmpty()) {
         return;
     }
-
-    const GuideEntryFonts fonts = guideEntryFonts(painter.font());
-    int y = textRect.top();
-
-    painter.save();
-    painter.setClipRect(textRect);
-
-    auto drawSection = [&](const QString &text, const QFont &sectionFont, const QColor &color) {
-        if (text.isEmpty() || y > textRect.bottom()) {
-            return;
-        }
-
-        const int sectionHeight = wrappedTextHeight(sectionFont, textRect.width(), text);
-        const QRect sectionRect(textRect.left(),
-                                y,
-                                textRect.width(),
-                                std::min(sectionHeight, textRect.bottom() - y + 1));
-        painter.setFont(sectionFont);
-        painter.setPen(color);
-        painter.drawText(sectionRect, Qt::AlignLeft | Qt::AlignTop | Qt::TextWordWrap, text);
-        y += sectionHeight + kGuideEntrySectionSpacing;
-    };
-
-    drawSection(sections.title, fonts.titleFont, visualTheme.text);
-    drawSection(sections.episodeTitle, fonts.episodeFont, visualTheme.episodeText);
-    drawSection(sections.synopsisBody, fonts.synopsisFont, visualTheme.secondaryText);
-    painter.restore();
+    drawTextSections(painter, textLayouts, textRect, entryTextSections(sections, painter.font(), visualTheme));
 }
 
 struct GuideEntryActionTarget {
@@ -789,9 +965,113 @@ struct GuideEntryActionTarget {
 struct GuidePreparedEntry {
     TvGuideEntry entry;
     GuideEntryTextSections textSections;
+    QString scheduleKey;
+    QString normalizedTitle;
     bool scheduled{false};
 };
 
+// What changed between two guide snapshots that share the same channel rows and timeline.
+struct GuideSnapshotDiff {
+    QSet<QString> changedChannels;
+    QSet<QString> changedScheduleKeys;
+    QSet<QString> changedRatingTitles;
+
+    bool isEmpty() const
+    {
+        return changedChannels.isEmpty() && changedScheduleKeys.isEmpty() && changedRatingTitles.isEmpty();
+    }
+};
+
+bool guideEntriesIdentical(const TvGuideEntry &left, const TvGuideEntry &right)
+{
+    return left.startUtc == right.startUtc
+           && left.endUtc == right.endUtc
+           && left.title == right.title
+           && left.episode == right.episode
+           && left.synopsis == right.synopsis;
+}
+
+bool guideEntryListsIdentical(const QList<TvGuideEntry> &left, const QList<TvGuideEntry> &right)
+{
+    if (left.size() != right.size()) {
+        return false;
+    }
+    if (left.constData() == right.constData()) {
+        return true;
+    }
+    return std::equal(left.cbegin(), left.cend(), right.cbegin(), guideEntriesIdentical);
+}
+
+bool guideEntryHashesIdentical(const QHash<QString, QList<TvGuideEntry>> &left,
+                               const QHash<QString, QList<TvGuideEntry>> &right)
+{
+    if (left.isSharedWith(right)) {
+        return true;
+    }
+    if (left.size() != right.size()) {
+        return false;
+    }
+    for (auto it = left.cbegin(); it != left.cend(); ++it) {
+        const auto rightIt = right.constFind(it.key());
+        if (rightIt == right.cend() || !guideEntryListsIdentical(it.value(), rightIt.value())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QSet<QString> scheduledEntryKeysFor(const QList<TvGuideScheduledSwitch> &scheduledSwitches)
+{
+    QSet<QString> keys;
+    keys.reserve(scheduledSwitches.size());
+    for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches) {
+        const QString matchKey = scheduledSwitchMatchKey(scheduledSwitch);
+        if (!matchKey.isEmpty()) {
+            keys.insert(matchKey);
+        }
+    }
+    return keys;
+}
+
+GuideSnapshotDiff diffGuideSnapshots(const QStringList &channels,
+                                     const QHash<QString, QList<TvGuideEntry>> &previousEntriesByChannel,
+                                     const QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
+                                     const QSet<QString> &previousScheduleKeys,
+                                     const QSet<QString> &scheduleKeys,
+                                     const QHash<QString, int> &previousRatings,
+                                     const QHash<QString, int> &ratings)
+{
+    GuideSnapshotDiff diff;
+    for (const QString &channelName : channels) {
+        if (!guideEntryListsIdentical(previousEntriesByChannel.value(channelName), entriesByChannel.value(channelName))) {
+            diff.changedChannels.insert(channelName);
+        }
+    }
+
+    for (const QString &key : previousScheduleKeys) {
+        if (!scheduleKeys.contains(key)) {
+            diff.changedScheduleKeys.insert(key);
+        }
+    }
+    for (const QString &key : scheduleKeys) {
+        if (!previousScheduleKeys.contains(key)) {
+            diff.changedScheduleKeys.insert(key);
+        }
+    }
+
+    for (auto it = previousRatings.cbegin(); it != previousRatings.cend(); ++it) {
+        if (!ratings.contains(it.key()) || ratings.value(it.key()) != it.value()) {
+            diff.changedRatingTitles.insert(it.key());
+        }
+    }
+    for (auto it = ratings.cbegin(); it != ratings.cend(); ++it) {
+        if (!previousRatings.contains(it.key())) {
+            diff.changedRatingTitles.insert(it.key());
+        }
+    }
+    return diff;
+}
+
 struct GuidePreparedRow {
     QString channelName;
     QList<GuidePreparedEntry> entries;
@@ -801,6 +1081,22 @@ struct GuidePreparedRow {
     QPixmap timelinePixmap;
     int cachedHorizontalOffset{-1};
     int cachedViewportWidth{0};
+    // Bumped whenever the row's content or geometry changes, so strips stashed for another theme go stale.
+    quint64 revision{0};
+};
+
+struct GuideRowTile {
+    QPixmap pixmap;
+    int horizontalOffset{-1};
+    int viewportWidth{0};
+    quint64 revision{0};
+};
+
+// Rendered strips of a theme that is no longer shown, kept so switching back only re-renders stale rows.
+struct GuideThemeTiles {
+    quint64 layoutGeneration{0};
+    QPixmap headerPixmap;
+    QList<GuideRowTile> rowTiles;
 };
 
 int preferredGuideRowHeight(const QList<GuidePreparedEntry> &preparedEntries,
@@ -809,6 +1105,7 @@ int preferredGuideRowHeight(const QList<GuidePreparedEntry> &preparedEntries,
                             int slotCount,
                             int timelineWidth,
                             const TvGuideVisualTheme &visualTheme,
+                            GuideTextLayoutCache &textLayouts,
                             bool hasWatchNowAction)
 {
     const qint64 totalSeconds = static_cast<qint64>(slotMinutes) * std::max(slotCount, 1) * 60;
@@ -853,7 +1150,7 @@ int preferredGuideRowHeight(const QList<GuidePreparedEntry> &preparedEntries,
                                                     : (airingNow && hasWatchNowAction && boxWidth >= 62
                                                            ? (kGuideWatchNowButtonWidth + 16)
                                                            : 0)));
-        const int textHeight = measureEntryTextHeight(visualTheme.guideFont, textWidth, preparedEntry.textSections);
+        const int textHeight = measureEntryTextHeight(textLayouts, textWidth, preparedEntry.textSections, visualTheme);
         preferred = std::max(preferred, textHeight + 26);
     }
 
@@ -905,6 +1202,7 @@ void renderGuideRowPixmap(GuidePreparedRow &row,
                           int totalTimelineWidth,
                           int horizontalOffset,
                           const TvGuideVisualTheme &visualTheme,
+                          GuideTextLayoutCache &textLayouts,
                           bool hasWatchNowAction)
 {
     row.timelinePixmap = QPixmap(qRound(logicalSize.width() * devicePixelRatio),
@@ -1030,7 +1328,8 @@ void renderGuideRowPixmap(GuidePreparedRow &row,
 
         painter.setPen(visualTheme.text);
         painter.setFont(visualTheme.guideFont);
-        drawEntryText(painter, box.adjusted(10, 8, -actionInset, -8), preparedEntry.textSections, visualTheme);
+        drawEntryText(
+            painter, textLayouts, box.adjusted(10, 8, -actionInset, -8), preparedEntry.textSections, visualTheme);
         renderedAny = true;
     }
 
@@ -1049,16 +1348,16 @@ public:
         setFrameShape(QFrame::NoFrame);
         setMouseTracking(true);
         viewport()->setMouseTracking(true);
+        recentThemeTiles_.setMaxCost(kGuideRecentThemeTileSets);
         prewarmTimer_.setSingleShot(true);
         prewarmTimer_.setInterval(0);
         connect(&prewarmTimer_, &QTimer::timeout, this, [this]() {
             prewarmNextBatch();
         });
-        nowLineTimer_.setInterval(100);
+        nowLineTimer_.setSingleShot(true);
         connect(&nowLineTimer_, &QTimer::timeout, this, [this]() {
             tickNowLine();
         });
-        nowLineTimer_.start();
     }
 
     void setGuideData(const QStringList &visibleChannels,
@@ -1068,36 +1367,147 @@ public:
                       int slotMinutes,
                       int slotCount,
                       const QList<TvGuideScheduledSwitch> &scheduledSwitches,
-                      const TvGuideVisualTheme &visualTheme,
                       std::function<void(const QString &, const TvGuideEntry &, bool)> toggleSchedule,
                       std::function<void(const QString &, const TvGuideEntry &)> watchNow)
     {
+        QSet<QString> scheduledEntryKeys = scheduledEntryKeysFor(scheduledSwitches);
+        const bool layoutUnchanged = !rows_.isEmpty()
+                                     && visibleChannels == visibleChannels_
+                                     && windowStartUtc == windowStartUtc_
+                                     && slotMinutes == slotMinutes_
+                                     && slotCount == slotCount_
+                                     && static_cast<bool>(watchNow) == static_cast<bool>(watchNow_);
+        toggleSchedule_ = std::move(toggleSchedule);
+        watchNow_ = std::move(watchNow);
+
+        if (layoutUnchanged) {
+            const GuideSnapshotDiff diff = diffGuideSnapshots(visibleChannels_,
+                                                              entriesByChannel_,
+                                                              entriesByChannel,
+                                                              scheduledEntryKeys_,
+                                                              scheduledEntryKeys,
+                                                              favoriteShowRatings_,
+                                                              favoriteShowRatings);
+            entriesByChannel_ = entriesByChannel;
+            favoriteShowRatings_ = favoriteShowRatings;
+            scheduledEntryKeys_ = std::move(scheduledEntryKeys);
+            applyGuideSnapshotDiff(diff);
+            return;
+        }
+
         visibleChannels_ = visibleChannels;
         entriesByChannel_ = entriesByChannel;
         favoriteShowRatings_ = favoriteShowRatings;
         windowStartUtc_ = windowStartUtc;
         slotMinutes_ = slotMinutes;
         slotCount_ = slotCount;
-        scheduledEntryKeys_.clear();
-        scheduledEntryKeys_.reserve(scheduledSwitches.size());
-        for (const TvGuideScheduledSwitch &scheduledSwitch : scheduledSwitches) {
-            const QString matchKey = scheduledSwitchMatchKey(scheduledSwitch);
-            if (!matchKey.isEmpty()) {
-                scheduledEntryKeys_.insert(matchKey);
-            }
-        }
-        visualTheme_ = visualTheme;
-        toggleSchedule_ = std::move(toggleSchedule);
-        watchNow_ = std::move(watchNow);
+        scheduledEntryKeys_ = std::move(scheduledEntryKeys);
         headerPixmap_ = QPixmap();
         resetNowLineTracking();
         rebuildLayout(true);
     }
 
+    // Applies a snapshot diff against the current rows: only rows that own a changed channel, schedule key
+    // or rated title are re-prepared and invalidated. Row tops are re-flowed only if a height changed.
+    void applyGuideSnapshotDiff(const GuideSnapshotDiff &diff)
+    {
+        if (diff.isEmpty()) {
+            return;
+        }
+
+        bool heightsChanged = false;
+        QList<int> dirtyRows;
+        for (int rowIndex = 0; rowIndex < rows_.size(); ++rowIndex) {
+            GuidePreparedRow &row = rows_[rowIndex];
+            bool rowDirty = false;
+            if (diff.changedChannels.contains(row.channelName)) {
+                row.entries = preparedEntriesForChannel(row.channelName);
+                rowDirty = true;
+            } else {
+                for (GuidePreparedEntry &preparedEntry : row.entries) {
+                    if (diff.changedScheduleKeys.contains(preparedEntry.scheduleKey)) {
+                        preparedEntry.scheduled = scheduledEntryKeys_.contains(preparedEntry.scheduleKey);
+                        rowDirty = true;
+                    }
+                    if (diff.changedRatingTitles.contains(preparedEntry.normalizedTitle)) {
+                        preparedEntry.textSections = textSectionsForEntry(preparedEntry.entry, favoriteShowRatings_);
+                        rowDirty = true;
+                    }
+                }
+            }
+            if (!rowDirty) {
+                continue;
+            }
+
+            const int rowHeight = preferredGuideRowHeight(row.entries,
+                                                          windowStartUtc_,
+                                                          slotMinutes_,
+                                                          slotCount_,
+                                                          timelineWidth_,
+                                                          visualTheme_,
+                                                          *textLayouts_,
+                                                          static_cast<bool>(watchNow_));
+            heightsChanged = heightsChanged || rowHeight != row.rowHeight;
+            row.rowHeight = rowHeight;
+            invalidateRow(row);
+            dirtyRows.append(rowIndex);
+        }
+
+        if (dirtyRows.isEmpty()) {
+            return;
+        }
+        if (!diff.changedChannels.isEmpty()) {
+            updateNextAiringBoundary(QDateTime::currentDateTimeUtc());
+            scheduleNowLineTick();
+        }
+        if (heightsChanged) {
+            reflowRows();
+            viewport()->update();
+        } else {
+            for (int rowIndex : dirtyRows) {
+                updateRowRegion(rows_.at(rowIndex));
+            }
+        }
+        schedulePrewarm(true);
+    }
+
+    // Strips of the outgoing theme are stashed by theme key and those of a recently used theme are restored, so a
+    // theme toggle re-renders only rows that changed meanwhile. Row heights are re-measured only if the guide font
+    // changed.
     void setVisualTheme(const TvGuideVisualTheme &visualTheme)
     {
+        if (visualTheme.themeKey == visualTheme_.themeKey) {
+            return;
+        }
+
+        stashThemeTiles();
+        const bool guideFontChanged = visualTheme.guideFont.key() != visualTheme_.guideFont.key();
         visualTheme_ = visualTheme;
-        invalidateCaches();
+        restoreThemeTiles();
+
+        if (guideFontChanged) {
+            bool heightsChanged = false;
+            for (GuidePreparedRow &row : rows_) {
+                const int rowHeight = preferredGuideRowHeight(row.entries,
+                                                              windowStartUtc_,
+                                                              slotMinutes_,
+                                                              slotCount_,
+                                                              timelineWidth_,
+                                                              visualTheme_,
+                                                              *textLayouts_,
+                                                              static_cast<bool>(watchNow_));
+                if (rowHeight != row.rowHeight) {
+                    row.rowHeight = rowHeight;
+                    invalidateRow(row);
+                    heightsChanged = true;
+                }
+            }
+            if (heightsChanged) {
+                reflowRows();
+            }
+        }
+
+        resetNowLineTracking();
         schedulePrewarm(true);
         viewport()->update();
     }
@@ -1107,6 +1517,11 @@ public:
         return currentGuideSlotPixelWidth_;
     }
 
+    std::shared_ptr<GuideTextLayoutCache> textLayoutCache() const
+    {
+        return textLayouts_;
+    }
+
     void scrollToCurrentTime(bool force)
     {
         if (!windowStartUtc_.isValid() || slotMinutes_ <= 0 || slotCount_ <= 0) {
@@ -1239,6 +1654,7 @@ protected:
                                      timelineWidth_,
                                      horizontalOffset,
                                      visualTheme_,
+                                     *textLayouts_,
                                      static_cast<bool>(watchNow_));
             }
 
@@ -1301,6 +1717,18 @@ protected:
         viewport()->unsetCursor();
     }
 
+    void showEvent(QShowEvent *event) override
+    {
+        QAbstractScrollArea::showEvent(event);
+        tickNowLine();
+    }
+
+    void hideEvent(QHideEvent *event) override
+    {
+        QAbstractScrollArea::hideEvent(event);
+        nowLineTimer_.stop();
+    }
+
     void scrollContentsBy(int dx, int dy) override
     {
         Q_UNUSED(dy);
@@ -1313,6 +1741,8 @@ protected:
 
 private:
     static constexpr int kNoNowLineViewportX = std::numeric_limits<int>::min();
+    static constexpr qint64 kNowLineMinIntervalMs = 250;
+    static constexpr qint64 kNowLineMaxIntervalMs = 60 * 1000;
 
     struct HitTestResult {
         const GuidePreparedRow *row{nullptr};
@@ -1362,24 +1792,182 @@ private:
         lastNowLineViewportX_ = kNoNowLineViewportX;
     }
 
+    bool nowLineTrackingActive() const
+    {
+        if (viewport() == nullptr || !isVisible()) {
+            return false;
+        }
+
+        const QWidget *topLevel = window();
+        return topLevel == nullptr || !topLevel->isMinimized();
+    }
+
     void tickNowLine()
     {
-        if (viewport() == nullptr) {
+        if (!nowLineTrackingActive()) {
+            nowLineTimer_.stop();
             return;
         }
 
+        const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
+        if (nextAiringBoundaryUtc_.isValid() && nowUtc >= nextAiringBoundaryUtc_) {
+            if (!refreshAiringStateRows(nowUtc)) {
+                // Row heights changed; rebuildLayout() already repainted and re-armed the timer.
+                return;
+            }
+        }
+
         const int nowLineViewportX = currentNowLineViewportX();
-        if (!isVisible()) {
+        if (nowLineViewportX != lastNowLineViewportX_) {
+            updateNowLineRegion(lastNowLineViewportX_);
             lastNowLineViewportX_ = nowLineViewportX;
+            updateNowLineRegion(lastNowLineViewportX_);
+        }
+
+        scheduleNowLineTick(nowUtc);
+    }
+
+    void scheduleNowLineTick(const QDateTime &nowUtc = QDateTime::currentDateTimeUtc())
+    {
+        if (!nowLineTrackingActive()) {
+            nowLineTimer_.stop();
             return;
         }
-        if (nowLineViewportX == lastNowLineViewportX_) {
+
+        qint64 intervalMs = kNowLineMaxIntervalMs;
+        const qint64 totalMs = static_cast<qint64>(slotMinutes_) * slotCount_ * 60 * 1000;
+        if (windowStartUtc_.isValid() && totalMs > 0 && timelineWidth_ > 0) {
+            const qint64 nowOffsetMs = windowStartUtc_.msecsTo(nowUtc);
+            if (nowOffsetMs < 0) {
+                intervalMs = -nowOffsetMs;
+            } else if (nowOffsetMs <= totalMs) {
+                // The line is snapped with llround(), so it moves once the offset crosses the next half pixel.
+                const double msPerPixel = static_cast<double>(totalMs) / timelineWidth_;
+                const double pixel = static_cast<double>(nowOffsetMs) / msPerPixel;
+                const double nextStepMs = (std::floor(pixel + 0.5) + 0.5) * msPerPixel;
+                intervalMs = static_cast<qint64>(std::ceil(nextStepMs - static_cast<double>(nowOffsetMs))) + 1;
+            }
+        }
+        if (nextAiringBoundaryUtc_.isValid()) {
+            intervalMs = std::min(intervalMs, nowUtc.msecsTo(nextAiringBoundaryUtc_) + 1);
+        }
+
+        nowLineTimer_.start(static_cast<int>(std::clamp(intervalMs, kNowLineMinIntervalMs, kNowLineMaxIntervalMs)));
+    }
+
+    void updateNextAiringBoundary(const QDateTime &nowUtc)
+    {
+        airingStateCheckedUtc_ = nowUtc;
+        nextAiringBoundaryUtc_ = QDateTime();
+        for (const GuidePreparedRow &row : rows_) {
+            for (const GuidePreparedEntry &preparedEntry : row.entries) {
+                for (const QDateTime &boundaryUtc : {preparedEntry.entry.startUtc, preparedEntry.entry.endUtc}) {
+                    if (boundaryUtc.isValid()
+                        && boundaryUtc > nowUtc
+                        && (!nextAiringBoundaryUtc_.isValid() || boundaryUtc < nextAiringBoundaryUtc_)) {
+                        nextAiringBoundaryUtc_ = boundaryUtc;
+                    }
+                }
+            }
+        }
+    }
+
+    // Re-renders only the rows holding an entry that started or ended since the last check, so the
+    // current-entry highlight and schedule/watch actions flip at program boundaries without polling.
+    // Returns false when a row height changed and the whole layout had to be rebuilt instead.
+    bool refreshAiringStateRows(const QDateTime &nowUtc)
+    {
+        const QDateTime previousCheckUtc = airingStateCheckedUtc_;
+        for (GuidePreparedRow &row : rows_) {
+            const bool changed =
+                std::any_of(row.entries.cbegin(), row.entries.cend(), [&](const GuidePreparedEntry &preparedEntry) {
+                    const TvGuideEntry &entry = preparedEntry.entry;
+                    return (entry.startUtc > previousCheckUtc && entry.startUtc <= nowUtc)
+                           || (entry.endUtc > previousCheckUtc && entry.endUtc <= nowUtc);
+                });
+            if (!changed) {
+                continue;
+            }
+
+            const int rowHeight = preferredGuideRowHeight(row.entries,
+                                                          windowStartUtc_,
+                                                          slotMinutes_,
+                                                          slotCount_,
+                                                          timelineWidth_,
+                                                          visualTheme_,
+                                                          *textLayouts_,
+                                                          static_cast<bool>(watchNow_));
+            if (rowHeight != row.rowHeight) {
+                rebuildLayout(true);
+                return false;
+            }
+
+            invalidateRow(row);
+            updateRowRegion(row);
+        }
+
+        updateNextAiringBoundary(nowUtc);
+        return true;
+    }
+
+    void invalidateRow(GuidePreparedRow &row)
+    {
+        row.timelinePixmap = QPixmap();
+        row.actionTargets.clear();
+        row.cachedHorizontalOffset = -1;
+        row.cachedViewportWidth = 0;
+        ++row.revision;
+    }
+
+    void stashThemeTiles()
+    {
+        auto *tiles = new GuideThemeTiles;
+        tiles->layoutGeneration = layoutGeneration_;
+        tiles->headerPixmap = std::exchange(headerPixmap_, QPixmap());
+        tiles->rowTiles.reserve(rows_.size());
+        for (GuidePreparedRow &row : rows_) {
+            tiles->rowTiles.append({std::exchange(row.timelinePixmap, QPixmap()),
+                                    row.cachedHorizontalOffset,
+                                    row.cachedViewportWidth,
+                                    row.revision});
+            row.cachedHorizontalOffset = -1;
+            row.cachedViewportWidth = 0;
+        }
+        recentThemeTiles_.insert(visualTheme_.themeKey, tiles);
+    }
+
+    void restoreThemeTiles()
+    {
+        std::unique_ptr<GuideThemeTiles> tiles(recentThemeTiles_.take(visualTheme_.themeKey));
+        if (!tiles || tiles->layoutGeneration != layoutGeneration_ || tiles->rowTiles.size() != rows_.size()) {
             return;
         }
 
-        updateNowLineRegion(lastNowLineViewportX_);
-        lastNowLineViewportX_ = nowLineViewportX;
-        updateNowLineRegion(lastNowLineViewportX_);
+        headerPixmap_ = tiles->headerPixmap;
+        for (int rowIndex = 0; rowIndex < rows_.size(); ++rowIndex) {
+            GuidePreparedRow &row = rows_[rowIndex];
+            const GuideRowTile &tile = tiles->rowTiles.at(rowIndex);
+            if (tile.revision != row.revision) {
+                continue;
+            }
+            row.timelinePixmap = tile.pixmap;
+            row.cachedHorizontalOffset = tile.horizontalOffset;
+            row.cachedViewportWidth = tile.viewportWidth;
+        }
+    }
+
+    void updateRowRegion(const GuidePreparedRow &row)
+    {
+        if (viewport() == nullptr) {
+            return;
+        }
+
+        const QRect dirtyRect =
+            QRect(0, kGuideHeaderHeight + row.rowTop - verticalScrollBar()->value(), viewport()->width(), row.rowHeight)
+                .intersected(viewport()->rect());
+        if (!dirtyRect.isEmpty()) {
+            viewport()->update(dirtyRect);
+        }
     }
 
     void drawNowLineOverlay(QPainter &painter)
@@ -1443,6 +2031,7 @@ private:
                                      timelineWidth_,
                                      horizontalOffset,
                                      visualTheme_,
+                                     *textLayouts_,
                                      static_cast<bool>(watchNow_));
                 ++renderedRows;
             }
@@ -1478,14 +2067,13 @@ private:
 
     void invalidateCaches()
     {
+        ++layoutGeneration_;
+        recentThemeTiles_.clear();
         headerPixmap_ = QPixmap();
         prewarmRowIndex_ = 0;
         resetNowLineTracking();
         for (GuidePreparedRow &row : rows_) {
-            row.timelinePixmap = QPixmap();
-            row.actionTargets.clear();
-            row.cachedHorizontalOffset = -1;
-            row.cachedViewportWidth = 0;
+            invalidateRow(row);
         }
     }
 
@@ -1501,45 +2089,28 @@ private:
         rows_.clear();
         rows_.reserve(visibleChannels_.size());
 
-        int rowTop = 0;
         for (const QString &channelName : visibleChannels_) {
             GuidePreparedRow row;
             row.channelName = channelName;
-
-            const QList<TvGuideEntry> entries = entriesByChannel_.value(channelName);
-            row.entries.reserve(entries.size());
-            for (const TvGuideEntry &entry : entries) {
-                row.entries.append(
-                    {entry,
-                     textSectionsForEntry(entry, favoriteShowRatings_),
-                     scheduledEntryKeys_.contains(scheduledEntryMatchKey(channelName, entry))});
-            }
-            std::sort(row.entries.begin(), row.entries.end(), [](const GuidePreparedEntry &left, const GuidePreparedEntry &right) {
-                return left.entry.startUtc < right.entry.startUtc;
-            });
-
+            row.entries = preparedEntriesForChannel(channelName);
             row.rowHeight = preferredGuideRowHeight(row.entries,
                                                     windowStartUtc_,
                                                     slotMinutes_,
                                                     slotCount_,
                                                     timelineWidth_,
                                                     visualTheme_,
+                                                    *textLayouts_,
                                                     static_cast<bool>(watchNow_));
-            row.rowTop = rowTop;
-            rowTop += row.rowHeight;
             rows_.append(row);
         }
 
-        rowsHeight_ = rows_.isEmpty() ? kGuideRowHeight : rowTop;
         invalidateCaches();
 
         horizontalScrollBar()->setSingleStep(std::max(12, currentGuideSlotPixelWidth_ / 8));
         horizontalScrollBar()->setPageStep(std::max(24, visibleTimelineWidth()));
         horizontalScrollBar()->setRange(0, std::max(0, timelineWidth_ - visibleTimelineWidth()));
 
-        verticalScrollBar()->setSingleStep(std::max(24, kGuideRowHeight / 2));
-        verticalScrollBar()->setPageStep(std::max(24, visibleRowsHeight()));
-        verticalScrollBar()->setRange(0, std::max(0, rowsHeight_ - visibleRowsHeight()));
+        reflowRows();
 
         if (preserveScroll) {
             horizontalScrollBar()->setValue(std::clamp(previousHorizontal, 0, horizontalScrollBar()->maximum()));
@@ -1550,10 +2121,48 @@ private:
         }
 
         lastNowLineViewportX_ = currentNowLineViewportX();
+        updateNextAiringBoundary(QDateTime::currentDateTimeUtc());
+        scheduleNowLineTick();
         schedulePrewarm(true);
         viewport()->update();
     }
 
+    QList<GuidePreparedEntry> preparedEntriesForChannel(const QString &channelName) const
+    {
+        const QList<TvGuideEntry> entries = entriesByChannel_.value(channelName);
+        QList<GuidePreparedEntry> preparedEntries;
+        preparedEntries.reserve(entries.size());
+        for (const TvGuideEntry &entry : entries) {
+            GuidePreparedEntry preparedEntry;
+            preparedEntry.entry = entry;
+            preparedEntry.textSections = textSectionsForEntry(entry, favoriteShowRatings_);
+            preparedEntry.scheduleKey = scheduledEntryMatchKey(channelName, entry);
+            preparedEntry.normalizedTitle = normalizeFavoriteShowRule(entry.title.trimmed());
+            preparedEntry.scheduled = scheduledEntryKeys_.contains(preparedEntry.scheduleKey);
+            preparedEntries.append(preparedEntry);
+        }
+        std::sort(preparedEntries.begin(),
+                  preparedEntries.end(),
+                  [](const GuidePreparedEntry &left, const GuidePreparedEntry &right) {
+                      return left.entry.startUtc < right.entry.startUtc;
+                  });
+        return preparedEntries;
+    }
+
+    void reflowRows()
+    {
+        int rowTop = 0;
+        for (GuidePreparedRow &row : rows_) {
+            row.rowTop = rowTop;
+            rowTop += row.rowHeight;
+        }
+        rowsHeight_ = rows_.isEmpty() ? kGuideRowHeight : rowTop;
+
+        verticalScrollBar()->setSingleStep(std::max(24, kGuideRowHeight / 2));
+        verticalScrollBar()->setPageStep(std::max(24, visibleRowsHeight()));
+        verticalScrollBar()->setRange(0, std::max(0, rowsHeight_ - visibleRowsHeight()));
+    }
+
     HitTestResult hitTest(const QPoint &viewportPoint) const
     {
         if (viewportPoint.y() < kGuideHeaderHeight || viewportPoint.x() < kGuideChannelLabelWidth) {
@@ -1616,16 +2225,200 @@ private:
     TvGuideVisualTheme visualTheme_;
     QPixmap headerPixmap_;
     QList<GuidePreparedRow> rows_;
+    quint64 layoutGeneration_{0};
+    QCache<size_t, GuideThemeTiles> recentThemeTiles_;
+    std::shared_ptr<GuideTextLayoutCache> textLayouts_{std::make_shared<GuideTextLayoutCache>()};
     std::function<void(const QString &, const TvGuideEntry &, bool)> toggleSchedule_;
     std::function<void(const QString &, const TvGuideEntry &)> watchNow_;
     QTimer prewarmTimer_;
     QTimer nowLineTimer_;
     int prewarmRowIndex_{0};
     int lastNowLineViewportX_{kNoNowLineViewportX};
+    QDateTime airingStateCheckedUtc_;
+    QDateTime nextAiringBoundaryUtc_;
 };
 
+int requestedSearchBenchmarkEntryCount()
+{
+    const QString value = qEnvironmentVariable("TV_TUNER_GUI_GUIDE_SEARCH_BENCHMARK").trimmed();
+    if (value.isEmpty() || value == "0" || value.compare("false", Qt::CaseInsensitive) == 0) {
+        return 0;
+    }
+    if (value == "1" || value.compare("true", Qt::CaseInsensitive) == 0) {
+        return kDefaultSearchBenchmarkEntryCount;
+    }
+    bool ok = false;
+    const int entryCount = value.toInt(&ok);
+    return ok && entryCount > 0 ? entryCount : 0;
+}
+
+// Deterministic stand-in for a large guide cache: the same count always yields the same titles and synopses,
+// so timings from different builds are comparable.
+QHash<QString, QList<TvGuideEntry>> syntheticSearchBenchmarkEntries(int entryCount, QStringList *channelOrder)
+{
+    static const QStringList words = {
+        "news", "weather", "evening", "morning", "mystery", "detective", "kitchen", "garden", "travel",
+        "history", "science", "nature", "wildlife", "ocean", "mountain", "city", "family", "comedy",
+        "drama", "classic", "movie", "sports", "football", "baseball", "hockey", "tonight", "live",
+        "special", "report", "journal", "frontier", "island", "river", "desert", "space", "planet",
+    };
+    const QDateTime baseUtc(QDate(2024, 1, 1), QTime(0, 0), QTimeZone::UTC);
+    const int channelCount = std::max(1, entryCount / 250);
+
+    QHash<QString, QList<TvGuideEntry>> entriesByChannel;
+    for (int channelIndex = 0; channelIndex < channelCount; ++channelIndex) {
+        const QString channelName = QString("Bench %1").arg(channelIndex + 1);
+        channelOrder->append(channelName);
+        entriesByChannel.insert(channelName, {});
+    }
+
+    const qsizetype wordCount = words.size();
+    for (int entryIndex = 0; entryIndex < entryCount; ++entryIndex) {
+        const int channelIndex = entryIndex % channelCount;
+        const int slot = entryIndex / channelCount;
+
+        TvGuideEntry entry;
+        entry.startUtc = baseUtc.addSecs(qint64(slot) * 30 * 60);
+        entry.endUtc = entry.startUtc.addSecs(30 * 60);
+        entry.title = QString("%1 %2").arg(words.at(entryIndex % wordCount),
+                                           words.at((entryIndex / wordCount) % wordCount));
+        entry.episode = QString("Episode %1").arg(entryIndex % 97 + 1);
+        entry.synopsis = QString("A %1 story about the %2 and the %3 (%4).")
+                             .arg(words.at((entryIndex * 7) % wordCount),
+                                  words.at((entryIndex * 13) % wordCount),
+                                  words.at((entryIndex * 31) % wordCount))
+                             .arg(entryIndex);
+        entriesByChannel[channelOrder->at(channelIndex)].append(entry);
+    }
+    return entriesByChannel;
+}
+
 }
 
+// Virtual list model over positions in a search index snapshot; role strings are read only for rows the view paints,
+// so a broad query costs one index list instead of one item object per match.
+class TvGuideDialog::SearchResultsModel final : public QAbstractListModel
+{
+public:
+    SearchResultsModel(const QHash<QString, int> *favoriteShowRatings, QObject *parent = nullptr)
+        : QAbstractListModel(parent)
+        , favoriteShowRatings_(favoriteShowRatings)
+    {
+        displayTextCache_.setMaxCost(kDisplayTextCacheRows);
+    }
+
+    // The model shares ownership of the index snapshot its matches point into, so a newer index can be
+    // swapped in on the dialog without invalidating rows the view is still painting.
+    void setResults(std::shared_ptr<const SearchIndex> searchIndex, QList<int> matches)
+    {
+        beginResetModel();
+        searchIndex_ = std::move(searchIndex);
+        matches_ = std::move(matches);
+        displayTextCache_.clear();
+        endResetModel();
+    }
+
+    void clear()
+    {
+        setResults(nullptr, {});
+    }
+
+    void setItemSize(const QSize &itemSize)
+    {
+        if (itemSize == itemSize_) {
+            return;
+        }
+        if (matches_.isEmpty()) {
+            itemSize_ = itemSize;
+            return;
+        }
+        // Rows keep their order; the pair only makes the view re-run its item layout for the new size hint.
+        emit layoutAboutToBeChanged();
+        itemSize_ = itemSize;
+        emit layoutChanged();
+    }
+
+    const QList<int> &matches() const
+    {
+        return matches_;
+    }
+
+    const SearchResult *resultAt(int row) const
+    {
+        if (searchIndex_ == nullptr || row < 0 || row >= matches_.size()) {
+            return nullptr;
+        }
+
+        const int indexPosition = matches_.at(row);
+        if (indexPosition < 0 || indexPosition >= searchIndex_->results.size()) {
+            return nullptr;
+        }
+        return &searchIndex_->results.at(indexPosition);
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : static_cast<int>(matches_.size());
+    }
+
+    Qt::ItemFlags flags(const QModelIndex &index) const override
+    {
+        return index.isValid() ? (Qt::ItemIsEnabled | Qt::ItemIsSelectable) : Qt::NoItemFlags;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        const SearchResult *result = index.isValid() ? resultAt(index.row()) : nullptr;
+        if (result == nullptr) {
+            return {};
+        }
+
+        switch (role) {
+        case Qt::ToolTipRole:
+            return displayTextForRow(index.row(), *result).toolTip;
+        case Qt::SizeHintRole:
+            return itemSize_;
+        case SearchTitleRole:
+            return displayTextForRow(index.row(), *result).ratedTitle;
+        case SearchTimeChannelRole:
+            return displayTextForRow(index.row(), *result).timeChannelText;
+        case SearchEpisodeRole:
+            return displayTextForRow(index.row(), *result).episodeTitle;
+        case SearchSynopsisRole:
+            return displayTextForRow(index.row(), *result).synopsisBody;
+        case SearchIsCurrentRole:
+            return guideEntryIsAiringNow(result->entry);
+        case SearchIsFavoriteRole:
+            return result->isFavorite;
+        default:
+            return {};
+        }
+    }
+
+private:
+    static constexpr int kDisplayTextCacheRows = 256;
+
+    // Display strings are formatted only for rows the view actually asks about, and kept for the few
+    // hundred most recently painted rows so one paint does not re-format the same entry per role.
+    const SearchResultDisplayText &displayTextForRow(int row, const SearchResult &result) const
+    {
+        if (const SearchResultDisplayText *cached = displayTextCache_.object(row)) {
+            return *cached;
+        }
+
+        auto *displayText = new SearchResultDisplayText(searchResultDisplayText(
+            result.channelName, result.entry, favoriteShowRatings_ != nullptr ? *favoriteShowRatings_ : QHash<QString, int>()));
+        displayTextCache_.insert(row, displayText);
+        return *displayText;
+    }
+
+    std::shared_ptr<const SearchIndex> searchIndex_;
+    const QHash<QString, int> *favoriteShowRatings_{};
+    QList<int> matches_;
+    QSize itemSize_;
+    mutable QCache<int, SearchResultDisplayText> displayTextCache_;
+};
+
 TvGuideDialog::TvGuideDialog(QWidget *parent)
     : QWidget(parent)
 {
@@ -1665,7 +2458,14 @@ TvGuideDialog::TvGuideDialog(QWidget *parent)
     showSearchSummaryLabel_->setWordWrap(true);
     searchLayout->addWidget(showSearchSummaryLabel_);
 
-    showSearchResultsList_ = new QListWidget(searchTab);
+    searchResultsModel_ = new SearchResultsModel(&favoriteShowRatings_, this);
+    searchIndexWatcher_ = new QFutureWatcher<std::shared_ptr<const SearchIndex>>(this);
+    connect(searchIndexWatcher_,
+            &QFutureWatcherBase::finished,
+            this,
+            &TvGuideDialog::handleSearchIndexBuilt);
+    showSearchResultsList_ = new QListView(searchTab);
+    showSearchResultsList_->setModel(searchResultsModel_);
     showSearchResultsList_->setAlternatingRowColors(true);
     showSearchResultsList_->setSelectionMode(QAbstractItemView::SingleSelection);
     showSearchResultsList_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
@@ -1692,10 +2492,10 @@ TvGuideDialog::TvGuideDialog(QWidget *parent)
             updateSearchResults();
         }
     });
-    connect(showSearchResultsList_, &QListWidget::itemSelectionChanged, this, [this]() {
+    connect(showSearchResultsList_->selectionModel(), &QItemSelectionModel::selectionChanged, this, [this]() {
         updateSearchActionState();
     });
-    connect(showSearchResultsList_, &QListWidget::itemDoubleClicked, this, [this](QListWidgetItem *) {
+    connect(showSearchResultsList_, &QListView::doubleClicked, this, [this](const QModelIndex &) {
         scheduleSelectedSearchResult();
     });
     tabs_->addTab(searchTab, "Search");
@@ -1712,6 +2512,16 @@ TvGuideDialog::TvGuideDialog(QWidget *parent)
     tabs_->addTab(logsTab, "Status");
 
     setDisplayTheme(defaultDisplayTheme());
+
+    if (const int benchmarkEntryCount = requestedSearchBenchmarkEntryCount(); benchmarkEntryCount > 0) {
+        static bool benchmarkStarted = false;
+        if (!benchmarkStarted) {
+            benchmarkStarted = true;
+            QThreadPool::globalInstance()->start([benchmarkEntryCount]() {
+                runSearchBenchmark(benchmarkEntryCount);
+            });
+        }
+    }
 }
 
 void TvGuideDialog::setDisplayTheme(const DisplayTheme &theme)
@@ -1719,10 +2529,10 @@ void TvGuideDialog::setDisplayTheme(const DisplayTheme &theme)
     displayTheme_ = normalizedDisplayTheme(theme);
     const TvGuideVisualTheme visualTheme = guideVisualThemeFor(displayTheme_);
     const QString tabFontCss =
-        styleSheetFontFragment(displayThemeFontStyle(displayTheme_, DisplayThemeKeys::TabFont));
+        styleSheetFontFragment(displayTheme_.fonts.value(DisplayThemeKeys::TabFont));
 
     setFont(visualTheme.guideFont);
-    setStyleSheet(
+    const QString styleSheetText =
         QString(
             "QWidget { background-color: %1; color: %2; }"
             "QPushButton { background-color: %3; color: %4; border: 1px solid %5; padding: 6px 12px; }"
@@ -1730,7 +2540,7 @@ void TvGuideDialog::setDisplayTheme(const DisplayTheme &theme)
             "QTabWidget::pane { border: 1px solid %8; top: -1px; }"
             "QTabBar::tab { background-color: %9; color: %10; border: 1px solid %8; padding: 8px 14px; min-width: 110px; %14 }"
             "QTabBar::tab:selected { background-color: %11; }"
-            "QLineEdit, QListWidget { background-color: %12; color: %13; border: 1px solid %8; }"
+            "QLineEdit, QListView { background-color: %12; color: %13; border: 1px solid %8; }"
             "QPlainTextEdit { background-color: %1; color: %2; border: 1px solid %8; }"
             "QTableWidget { background-color: %1; alternate-background-color: %12; color: %2; gridline-color: %8; }"
             "QHeaderView::section { background-color: %1; color: %2; border: 1px solid %8; padding: 4px; }")
@@ -1739,15 +2549,19 @@ void TvGuideDialog::setDisplayTheme(const DisplayTheme &theme)
                  visualTheme.buttonBackground.name(),
                  visualTheme.buttonText.name(),
                  visualTheme.buttonBorder.name(),
-                 displayThemeColor(displayTheme_, DisplayThemeKeys::ButtonDisabledText).name(),
-                 displayThemeColor(displayTheme_, DisplayThemeKeys::ButtonDisabledBorder).name(),
+                 displayTheme_.colors.value(DisplayThemeKeys::ButtonDisabledText).name(),
+                 displayTheme_.colors.value(DisplayThemeKeys::ButtonDisabledBorder).name(),
                  visualTheme.border.name(),
                  visualTheme.tabBackground.name(),
                  visualTheme.tabText.name(),
                  visualTheme.tabSelectedBackground.name(),
-                 displayThemeColor(displayTheme_, DisplayThemeKeys::InputBackground).name(),
-                 displayThemeColor(displayTheme_, DisplayThemeKeys::InputText).name(),
-                 tabFontCss));
+                 displayTheme_.colors.value(DisplayThemeKeys::InputBackground).name(),
+                 displayTheme_.colors.value(DisplayThemeKeys::InputText).name(),
+                 tabFontCss);
+    // Re-setting an identical sheet would still re-polish every guide widget.
+    if (styleSheet() != styleSheetText) {
+        setStyleSheet(styleSheetText);
+    }
 
     if (tabs_ != nullptr && tabs_->tabBar() != nullptr) {
         tabs_->tabBar()->setFont(visualTheme.tabFont);
@@ -1773,7 +2587,11 @@ void TvGuideDialog::setDisplayTheme(const DisplayTheme &theme)
             existingDelegate != nullptr && existingDelegate->parent() == showSearchResultsList_) {
             existingDelegate->deleteLater();
         }
-        showSearchResultsList_->setItemDelegate(new SearchResultItemDelegate(visualTheme, showSearchResultsList_));
+        std::shared_ptr<GuideTextLayoutCache> textLayouts =
+            guideView_ != nullptr ? static_cast<GuideCanvasWidget *>(guideView_)->textLayoutCache()
+                                  : std::make_shared<GuideTextLayoutCache>();
+        showSearchResultsList_->setItemDelegate(
+            new SearchResultItemDelegate(visualTheme, std::move(textLayouts), showSearchResultsList_));
     }
     if (showSearchSummaryLabel_ != nullptr) {
         showSearchSummaryLabel_->setFont(visualTheme.guideSearchFont);
@@ -1800,11 +2618,11 @@ bool TvGuideDialog::eventFilter(QObject *watched, QEvent *event)
             showSearchResultsList_->viewport()->unsetCursor();
         } else if (event->type() == QEvent::MouseMove || event->type() == QEvent::MouseButtonRelease) {
             const auto *mouseEvent = static_cast<QMouseEvent *>(event);
-            QListWidgetItem *item = showSearchResultsList_->itemAt(mouseEvent->pos());
+            const QModelIndex index = showSearchResultsList_->indexAt(mouseEvent->pos());
             bool overActionButton = false;
-            if (item != nullptr) {
-                const QRect itemRect = showSearchResultsList_->visualItemRect(item);
-                const bool isCurrent = item->data(SearchIsCurrentRole).toBool();
+            if (index.isValid()) {
+                const QRect itemRect = showSearchResultsList_->visualRect(index);
+                const bool isCurrent = index.data(SearchIsCurrentRole).toBool();
                 const SearchResultLayoutRects rects =
                     searchResultLayoutRects(itemRect,
                                             isCurrent,
@@ -1815,10 +2633,9 @@ bool TvGuideDialog::eventFilter(QObject *watched, QEvent *event)
                 if (event->type() == QEvent::MouseButtonRelease
                     && mouseEvent->button() == Qt::LeftButton
                     && overActionButton) {
-                    const int row = showSearchResultsList_->row(item);
-                    if (row >= 0 && row < searchResults_.size()) {
-                        showSearchResultsList_->setCurrentItem(item);
-                        const SearchResult &result = searchResults_.at(row);
+                    if (const SearchResult *indexedResult = searchResultAtRow(index.row())) {
+                        showSearchResultsList_->setCurrentIndex(index);
+                        const SearchResult result = *indexedResult;
                         if (rects.watchRect.contains(mouseEvent->pos()) && isCurrent) {
                             emit watchRequested(result.channelName, result.entry);
                         } else if (rects.favoriteRect.contains(mouseEvent->pos())) {
@@ -1839,11 +2656,12 @@ bool TvGuideDialog::eventFilter(QObject *watched, QEvent *event)
 
 void TvGuideDialog::setLoadingState(const QString &message)
 {
-    searchIndex_.clear();
-    searchResults_.clear();
-    if (showSearchResultsList_ != nullptr) {
-        showSearchResultsList_->clear();
+    if (searchResultsModel_ != nullptr) {
+        searchResultsModel_->clear();
     }
+    searchIndex_.reset();
+    ++searchIndexGeneration_;
+    searchIndexStale_ = true;
     if (showSearchSummaryLabel_ != nullptr) {
         showSearchSummaryLabel_->setText("Search the current guide cache by title or synopsis.");
     }
@@ -1938,6 +2756,10 @@ void TvGuideDialog::setGuideData(const QStringList &channelOrder,
 {
     refreshButton_->setEnabled(true);
     logsView_->setPlainText(statusText);
+    const bool searchInputsChanged = searchIndexStale_
+                                     || channelOrder != channelOrder_
+                                     || favoriteShowRatings != favoriteShowRatings_
+                                     || !guideEntryHashesIdentical(entriesByChannel, entriesByChannel_);
     channelOrder_ = channelOrder;
     favoriteChannels_ = favoriteChannels;
     favoriteChannels_.removeDuplicates();
@@ -1947,7 +2769,9 @@ void TvGuideDialog::setGuideData(const QStringList &channelOrder,
     windowStartUtc_ = windowStartUtc;
     slotMinutes_ = slotMinutes;
     slotCount_ = slotCount;
-    rebuildSearchIndex();
+    if (searchInputsChanged) {
+        requestSearchIndexBuild();
+    }
 
     if (guideView_ == nullptr || guideView_->width() <= 0 || !isVisible()) {
         pendingGuideRender_ = true;
@@ -1959,19 +2783,25 @@ void TvGuideDialog::setGuideData(const QStringList &channelOrder,
     renderGuideTable();
 }
 
-void TvGuideDialog::rebuildSearchIndex()
+std::shared_ptr<const TvGuideDialog::SearchIndex>
+TvGuideDialog::buildSearchIndex(const QStringList &channelOrder,
+                                const QHash<QString, QList<TvGuideEntry>> &entriesByChannel,
+                                const QHash<QString, int> &favoriteShowRatings,
+                                quint64 generation)
 {
-    searchIndex_.clear();
+    auto index = std::make_shared<SearchIndex>();
+    index->generation = generation;
+    QList<SearchResult> &results = index->results;
 
-    QStringList orderedChannels = channelOrder_;
-    for (auto it = entriesByChannel_.cbegin(); it != entriesByChannel_.cend(); ++it) {
+    QStringList orderedChannels = channelOrder;
+    for (auto it = entriesByChannel.cbegin(); it != entriesByChannel.cend(); ++it) {
         if (!orderedChannels.contains(it.key())) {
             orderedChannels.append(it.key());
         }
     }
 
     for (const QString &channelName : orderedChannels) {
-        const QList<TvGuideEntry> entries = entriesByChannel_.value(channelName);
+        const QList<TvGuideEntry> entries = entriesByChannel.value(channelName);
         for (const TvGuideEntry &entry : entries) {
             const GuideEntryDisplayParts parts = displayPartsForEntry(entry);
             if (parts.title.isEmpty()) {
@@ -1981,22 +2811,14 @@ void TvGuideDialog::rebuildSearchIndex()
             SearchResult result;
             result.channelName = channelName;
             result.entry = entry;
-            result.ratedTitle = formatRatedShowTitle(parts.title, favoriteShowRatings_);
-            result.episodeTitle = parts.episodeTitle;
-            result.synopsisBody = parts.synopsisBody;
-            result.timeChannelText = QString("%1 - %2 | Channel: %3")
-                                         .arg(formatGuideSearchDateTime(entry.startUtc),
-                                              formatGuideSearchDateTime(entry.endUtc),
-                                              channelName);
-            result.toolTip = formatEntryToolTip(entry, favoriteShowRatings_);
             result.normalizedHaystack =
                 normalizedSearchText(parts.title, parts.episodeTitle, parts.synopsisBody);
-            result.isFavorite = favoriteShowRatings_.contains(normalizeFavoriteShowRule(parts.title));
-            searchIndex_.append(result);
+            result.isFavorite = favoriteShowRatings.contains(normalizeFavoriteShowRule(parts.title));
+            results.append(result);
         }
     }
 
-    std::sort(searchIndex_.begin(), searchIndex_.end(), [](const SearchResult &left, const SearchResult &right) {
+    std::sort(results.begin(), results.end(), [](const SearchResult &left, const SearchResult &right) {
         if (left.entry.startUtc == right.entry.startUtc) {
             if (left.channelName == right.channelName) {
                 return left.entry.title.localeAwareCompare(right.entry.title) < 0;
@@ -2005,88 +2827,258 @@ void TvGuideDialog::rebuildSearchIndex()
         }
         return left.entry.startUtc < right.entry.startUtc;
     });
+
+    for (int indexPosition = 0; indexPosition < results.size(); ++indexPosition) {
+        const QString &haystack = results.at(indexPosition).normalizedHaystack;
+        for (qsizetype offset = 0; offset + 3 <= haystack.size(); ++offset) {
+            QList<int> &postings = index->trigramPostings[searchTrigramKey(haystack.constData() + offset)];
+            if (postings.isEmpty() || postings.constLast() != indexPosition) {
+                postings.append(indexPosition);
+            }
+        }
+    }
+    index->trigramPostings.squeeze();
+    return index;
 }
 
-void TvGuideDialog::updateSearchResults()
+void TvGuideDialog::requestSearchIndexBuild()
+{
+    ++searchIndexGeneration_;
+    searchIndexStale_ = false;
+    startSearchIndexBuild();
+}
+
+void TvGuideDialog::startSearchIndexBuild()
+{
+    if (searchIndexWatcher_ == nullptr) {
+        return;
+    }
+    if (searchIndexWatcher_->isRunning()) {
+        // One build at a time; the finished handler restarts with the newest snapshot.
+        searchIndexRebuildQueued_ = true;
+        return;
+    }
+
+    searchIndexRebuildQueued_ = false;
+    searchIndexWatcher_->setFuture(QtConcurrent::run(&TvGuideDialog::buildSearchIndex,
+                                                     channelOrder_,
+                                                     entriesByChannel_,
+                                                     favoriteShowRatings_,
+                                                     searchIndexGeneration_));
+}
+
+void TvGuideDialog::handleSearchIndexBuilt()
 {
-    if (showSearchResultsList_ == nullptr || showSearchSummaryLabel_ == nullptr || showSearchEdit_ == nullptr) {
+    if (searchIndexWatcher_ == nullptr) {
         return;
     }
 
-    const bool restoreUpdates = showSearchResultsList_->updatesEnabled();
-    showSearchResultsList_->setUpdatesEnabled(false);
+    const std::shared_ptr<const SearchIndex> index = searchIndexWatcher_->result();
+    if (searchIndexRebuildQueued_) {
+        startSearchIndexBuild();
+        return;
+    }
+    if (index == nullptr || index->generation != searchIndexGeneration_) {
+        return;
+    }
 
-    SearchResult selectedResult;
-    bool hadSelectedResult = false;
-    const int previousRow = showSearchResultsList_->currentRow();
-    if (previousRow >= 0 && previousRow < searchResults_.size()) {
-        selectedResult = searchResults_.at(previousRow);
-        hadSelectedResult = true;
+    searchIndex_ = index;
+    updateSearchResults();
+}
+
+QList<int> TvGuideDialog::findSearchMatches(const SearchIndex &index, const QString &normalizedQuery)
+{
+    QList<int> matches;
+    auto appendVerified = [&](int indexPosition) {
+        if (index.results.at(indexPosition).normalizedHaystack.contains(normalizedQuery)) {
+            matches.append(indexPosition);
+        }
+    };
+
+    // Queries shorter than one trigram cannot use the postings, so they fall back to the plain scan.
+    if (normalizedQuery.size() < 3) {
+        for (int indexPosition = 0; indexPosition < index.results.size(); ++indexPosition) {
+            appendVerified(indexPosition);
+        }
+        return matches;
     }
 
-    searchResults_.clear();
-    showSearchResultsList_->clear();
+    QList<const QList<int> *> postingLists;
+    QSet<quint64> seenKeys;
+    for (qsizetype offset = 0; offset + 3 <= normalizedQuery.size(); ++offset) {
+        const quint64 key = searchTrigramKey(normalizedQuery.constData() + offset);
+        if (seenKeys.contains(key)) {
+            continue;
+        }
+        seenKeys.insert(key);
+
+        const auto postingsIt = index.trigramPostings.constFind(key);
+        if (postingsIt == index.trigramPostings.cend()) {
+            return matches;
+        }
+        postingLists.append(&postingsIt.value());
+    }
+
+    // Intersect from the rarest trigram up so the working set only shrinks.
+    std::sort(postingLists.begin(), postingLists.end(), [](const QList<int> *left, const QList<int> *right) {
+        return left->size() < right->size();
+    });
+    QList<int> candidates = *postingLists.constFirst();
+    for (qsizetype listIndex = 1; listIndex < postingLists.size() && !candidates.isEmpty(); ++listIndex) {
+        const QList<int> &postings = *postingLists.at(listIndex);
+        QList<int> narrowed;
+        narrowed.reserve(candidates.size());
+        std::set_intersection(candidates.cbegin(),
+                              candidates.cend(),
+                              postings.cbegin(),
+                              postings.cend(),
+                              std::back_inserter(narrowed));
+        candidates = std::move(narrowed);
+    }
+
+    // Trigram hits are necessary but not sufficient for a substring match, so confirm each candidate.
+    matches.reserve(candidates.size());
+    for (int indexPosition : candidates) {
+        appendVerified(indexPosition);
+    }
+    return matches;
+}
+
+void TvGuideDialog::runSearchBenchmark(int entryCount)
+{
+    QStringList channelOrder;
+    const QHash<QString, QList<TvGuideEntry>> entriesByChannel =
+        syntheticSearchBenchmarkEntries(entryCount, &channelOrder);
+
+    QElapsedTimer buildTimer;
+    buildTimer.start();
+    const std::shared_ptr<const SearchIndex> index = buildSearchIndex(channelOrder, entriesByChannel, {}, 0);
+    const qint64 buildMs = buildTimer.elapsed();
+    qInfo().noquote() << QString("guide-search-benchmark: indexed %1 entries on %2 channels in %3 ms (%4 trigrams)")
+                             .arg(index->results.size())
+                             .arg(channelOrder.size())
+                             .arg(buildMs)
+                             .arg(index->trigramPostings.size());
+
+    // Each query is timed through the trigram path and through the plain haystack scan it replaced.
+    static const QStringList queries = {"ne", "news", "detective", "ocean tonight", "episode", "zzzz"};
+    for (const QString &query : queries) {
+        const QString normalizedQuery = query.toCaseFolded();
+        QList<qint64> indexedNs;
+        QList<qint64> scanNs;
+        qsizetype matchCount = 0;
+        for (int repetition = 0; repetition < kSearchBenchmarkRepetitions; ++repetition) {
+            QElapsedTimer timer;
+            timer.start();
+            matchCount = findSearchMatches(*index, normalizedQuery).size();
+            indexedNs.append(timer.nsecsElapsed());
+
+            timer.restart();
+            qsizetype scanCount = 0;
+            for (const SearchResult &result : index->results) {
+                if (result.normalizedHaystack.contains(normalizedQuery)) {
+                    ++scanCount;
+                }
+            }
+            scanNs.append(timer.nsecsElapsed());
+            if (scanCount != matchCount) {
+                qWarning().noquote() << QString("guide-search-benchmark: \"%1\" matched %2 indexed vs %3 scanned")
+                                            .arg(query)
+                                            .arg(matchCount)
+                                            .arg(scanCount);
+            }
+        }
+        std::sort(indexedNs.begin(), indexedNs.end());
+        std::sort(scanNs.begin(), scanNs.end());
+        qInfo().noquote()
+            << QString("guide-search-benchmark: \"%1\" %2 matches, indexed median %3 us max %4 us, "
+                       "scan median %5 us max %6 us")
+                   .arg(query)
+                   .arg(matchCount)
+                   .arg(indexedNs.at(indexedNs.size() / 2) / 1000)
+                   .arg(indexedNs.constLast() / 1000)
+                   .arg(scanNs.at(scanNs.size() / 2) / 1000)
+                   .arg(scanNs.constLast() / 1000);
+    }
+}
+
+void TvGuideDialog::updateSearchResults()
+{
+    if (showSearchResultsList_ == nullptr
+        || searchResultsModel_ == nullptr
+        || showSearchSummaryLabel_ == nullptr
+        || showSearchEdit_ == nullptr) {
+        return;
+    }
+
+    rememberSearchSelection();
 
     const QString query = showSearchEdit_->text().simplified();
     if (query.isEmpty()) {
+        searchResultsModel_->clear();
+        hasSearchSelection_ = false;
         showSearchSummaryLabel_->setText("Search the current guide cache by title or synopsis.");
-        showSearchResultsList_->setUpdatesEnabled(restoreUpdates);
         updateSearchActionState();
         return;
     }
 
-    const QString normalizedQuery = query.toCaseFolded();
-    searchResults_.reserve(searchIndex_.size());
-    for (const SearchResult &indexedResult : searchIndex_) {
-        if (indexedResult.normalizedHaystack.contains(normalizedQuery)) {
-            searchResults_.append(indexedResult);
+    if (searchIndex_ == nullptr) {
+        searchResultsModel_->clear();
+        showSearchSummaryLabel_->setText("Indexing current guide data...");
+        updateSearchActionState();
+        return;
+    }
+
+    QList<int> matches = findSearchMatches(*searchIndex_, query.toCaseFolded());
+
+    int restoredRow = -1;
+    if (hasSearchSelection_) {
+        for (int row = 0; row < matches.size(); ++row) {
+            const SearchResult &result = searchIndex_->results.at(matches.at(row));
+            if (result.channelName.trimmed() == searchSelection_.channelName.trimmed()
+                && guideEntriesMatch(result.entry, searchSelection_.entry)) {
+                restoredRow = row;
+                break;
+            }
         }
     }
 
     const int viewportWidth =
         showSearchResultsList_->viewport() != nullptr ? showSearchResultsList_->viewport()->width() : 720;
-    const QFontMetrics fontMetrics(showSearchResultsList_->font());
-    int restoredRow = -1;
-    for (const SearchResult &result : searchResults_) {
-        const bool isCurrent = searchResultIsCurrent(result);
-
-        QListWidgetItem *item = new QListWidgetItem(showSearchResultsList_);
-        item->setFlags(Qt::ItemIsEnabled | Qt::ItemIsSelectable);
-        item->setToolTip(result.toolTip);
-        item->setData(SearchTitleRole, result.ratedTitle);
-        item->setData(SearchTimeChannelRole, result.timeChannelText);
-        item->setData(SearchEpisodeRole, result.episodeTitle);
-        item->setData(SearchSynopsisRole, result.synopsisBody);
-        item->setData(SearchIsCurrentRole, isCurrent);
-        item->setData(SearchIsFavoriteRole, result.isFavorite);
-        item->setData(
-            Qt::SizeHintRole,
-            QSize(viewportWidth, searchResultItemHeight(fontMetrics)));
-
-        if (restoredRow < 0
-            && hadSelectedResult
-            && result.channelName.trimmed() == selectedResult.channelName.trimmed()
-            && guideEntriesMatch(result.entry, selectedResult.entry)) {
-            restoredRow = showSearchResultsList_->count() - 1;
-        }
-    }
-
-    if (searchResults_.isEmpty()) {
+    searchResultsModel_->setItemSize(
+        QSize(viewportWidth, searchResultItemHeight(QFontMetrics(showSearchResultsList_->font()))));
+    searchResultsModel_->setResults(searchIndex_, std::move(matches));
+    hasSearchSelection_ = false;
+
+    const int matchCount = searchResultsModel_->rowCount();
+    if (matchCount == 0) {
         showSearchSummaryLabel_->setText(QString("No guide entries matched \"%1\".").arg(query));
     } else {
         showSearchSummaryLabel_->setText(QString("%1 matching guide entr%2 found.")
-                                             .arg(searchResults_.size())
-                                             .arg(searchResults_.size() == 1 ? "y" : "ies"));
+                                             .arg(matchCount)
+                                             .arg(matchCount == 1 ? "y" : "ies"));
     }
 
     if (restoredRow >= 0) {
-        showSearchResultsList_->setCurrentRow(restoredRow);
+        showSearchResultsList_->setCurrentIndex(searchResultsModel_->index(restoredRow));
     }
 
-    showSearchResultsList_->setUpdatesEnabled(restoreUpdates);
     updateSearchActionState();
 }
 
+void TvGuideDialog::rememberSearchSelection()
+{
+    if (showSearchResultsList_ == nullptr) {
+        return;
+    }
+
+    if (const SearchResult *selectedResult = searchResultAtRow(showSearchResultsList_->currentIndex().row())) {
+        searchSelection_.channelName = selectedResult->channelName;
+        searchSelection_.entry = selectedResult->entry;
+        hasSearchSelection_ = true;
+    }
+}
+
 void TvGuideDialog::updateSearchActionState()
 {
     if (showSearchResultsList_ == nullptr) {
@@ -2100,23 +3092,18 @@ void TvGuideDialog::scheduleSelectedSearchResult()
         return;
     }
 
-    const int row = showSearchResultsList_->currentRow();
-    if (row < 0 || row >= searchResults_.size()) {
+    const SearchResult *selectedResult = searchResultAtRow(showSearchResultsList_->currentIndex().row());
+    if (selectedResult == nullptr) {
         return;
     }
 
-    const SearchResult result = searchResults_.at(row);
+    const SearchResult result = *selectedResult;
     emit searchScheduleRequested(result.entry.title.simplified(), result.channelName, result.entry);
 }
 
-bool TvGuideDialog::searchResultIsCurrent(const SearchResult &result) const
+const TvGuideDialog::SearchResult *TvGuideDialog::searchResultAtRow(int row) const
 {
-    if (!result.entry.startUtc.isValid() || !result.entry.endUtc.isValid()) {
-        return false;
-    }
-
-    const QDateTime nowUtc = QDateTime::currentDateTimeUtc();
-    return result.entry.startUtc <= nowUtc && nowUtc < result.entry.endUtc;
+    return searchResultsModel_ != nullptr ? searchResultsModel_->resultAt(row) : nullptr;
 }
 
 bool TvGuideDialog::channelHasVisibleData(const QString &channel) const
@@ -2159,7 +3146,6 @@ void TvGuideDialog::renderGuideTable()
         }
         visibleChannels << channel;
     }
-    const TvGuideVisualTheme visualTheme = guideVisualThemeFor(displayTheme_);
     auto *guideView = static_cast<GuideCanvasWidget *>(guideView_);
     guideView->setGuideData(visibleChannels,
                             entriesByChannel_,
@@ -2168,7 +3154,6 @@ void TvGuideDialog::renderGuideTable()
                             slotMinutes_,
                             slotCount_,
                             scheduledSwitches_,
-                            visualTheme,
                             [this](const QString &channelName, const TvGuideEntry &entry, bool enabled) {
                                 emit scheduleSwitchRequested(channelName, entry, enabled);
                             },
@@ -1,17 +1,14 @@
 #include <QApplication>
 #include <QColor>
-#include <QDateTime>
 #include <QDir>
-#include <QFile>
 #include <QIcon>
 #include <QLoggingCategory>
 #include <QPalette>
 
-#include <fcntl.h>
-#include <unistd.h>
-
 #include "DisplayTheme.h"
+#include "LogSink.h"
 #include "MainWindow.h"
+#include "StartupTrace.h"
 
 namespace {
 bool verboseQtLoggingEnabled()
@@ -20,94 +17,53 @@ bool verboseQtLoggingEnabled()
     return value == "1" || value == "true" || value == "yes" || value == "on";
 }
 
-QString resolveProjectLogPath()
+bool jsonLinesLoggingEnabled()
 {
-    const QString envPath = qEnvironmentVariable("TV_TUNER_GUI_LOG_PATH");
-    if (!envPath.isEmpty()) {
-        return envPath;
-    }
-
-    QDir sourceDir(QStringLiteral(TV_TUNER_GUI_SOURCE_DIR));
-    if (sourceDir.exists()) {
-        return sourceDir.filePath("tv_tuner_gui.log");
-    }
-
-    QDir cwdDir(QDir::currentPath());
-    if (cwdDir.dirName() == "build") {
-        cwdDir.cdUp();
-    }
-    return cwdDir.filePath("tv_tuner_gui.log");
-}
-
-bool appendDirectLineToLog(const QString &logPath, const QString &line)
-{
-    const QByteArray encodedPath = QFile::encodeName(logPath);
-    const int fd = ::open(encodedPath.constData(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0664);
-    if (fd < 0) {
-        return false;
-    }
-
-    QByteArray payload = line.toUtf8();
-    payload.append('\n');
-
-    qsizetype totalWritten = 0;
-    while (totalWritten < payload.size()) {
-        const ssize_t written =
-            ::write(fd, payload.constData() + totalWritten, static_cast<size_t>(payload.size() - totalWritten));
-        if (written <= 0) {
-            ::close(fd);
-            return false;
-        }
-        totalWritten += written;
-    }
-
-    ::close(fd);
-    return true;
+    const QByteArray value = qgetenv("TV_TUNER_GUI_LOG_JSON").trimmed().toLower();
+    return value == "1" || value == "true" || value == "yes" || value == "on";
 }
 
 void appendQtMessageToLog(QtMsgType type, const QMessageLogContext &context, const QString &message)
 {
-    static const QString logPath = resolveProjectLogPath();
     static thread_local bool inHandler = false;
-    static bool reportedLogOpenFailure = false;
     if (inHandler) {
         return;
     }
     inHandler = true;
 
-    const char *level = "DEBUG";
+    LogLevel level = LogLevel::Debug;
     switch (type) {
     case QtDebugMsg:
-        level = "DEBUG";
+        level = LogLevel::Debug;
         break;
     case QtInfoMsg:
-        level = "INFO";
+        level = LogLevel::Info;
         break;
     case QtWarningMsg:
-        level = "WARN";
+        level = LogLevel::Warning;
         break;
     case QtCriticalMsg:
-        level = "CRIT";
-        break;
     case QtFatalMsg:
-        level = "FATAL";
+        level = LogLevel::Error;
         break;
     }
 
-    const QString timestamp = QDateTime::currentDateTime().toString(Qt::ISODate);
-    const QString category = context.category != nullptr ? QString::fromUtf8(context.category) : QString("qt");
-    const QString line = QString("[%1] [QT:%2] [%3] %4")
-                             .arg(timestamp, level, category, message);
-
-    if (!appendDirectLineToLog(logPath, line) && !reportedLogOpenFailure) {
-        reportedLogOpenFailure = true;
-        fprintf(stderr, "tv_tuner_gui: failed to open log file for append: %s\n",
-                logPath.toLocal8Bit().constData());
+    if (logEnabled(LogCategory::Qt, level) || type == QtFatalMsg) {
+        const QString category = context.category != nullptr ? QString::fromUtf8(context.category) : QString("qt");
+        LogRecord record;
+        record.monotonicNs = logMonotonicNowNs();
+        record.category = LogCategory::Qt;
+        record.level = level;
+        // LogLevel stops at Error, so fatal records are tagged to stay distinguishable from criticals.
+        record.message = type == QtFatalMsg ? QString("[fatal] [%1] %2").arg(category, message)
+                                            : QString("[%1] %2").arg(category, message);
+        fprintf(stderr, "%s\n", formatLogRecordText(record).toLocal8Bit().constData());
+        appendLogSinkRecord(std::move(record));
     }
-    fprintf(stderr, "%s\n", line.toLocal8Bit().constData());
 
     inHandler = false;
     if (type == QtFatalMsg) {
+        flushLogSink();
         abort();
     }
 }
@@ -115,6 +71,7 @@ void appendQtMessageToLog(QtMsgType type, const QMessageLogContext &context, con
 
 int main(int argc, char *argv[])
 {
+    beginStartupTrace();
     if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
         qputenv("QT_QPA_PLATFORM", "xcb");
     }
@@ -131,16 +88,29 @@ int main(int argc, char *argv[])
 
     const QString startupLogPath = resolveProjectLogPath();
     const bool verboseQtLogs = verboseQtLoggingEnabled();
-    const QString startupLine = QString("[%1] [APP:INFO] [default] logger initialized path=%2 cwd=%3 verboseQtLogs=%4")
-                                    .arg(QDateTime::currentDateTime().toString(Qt::ISODate),
-                                         startupLogPath,
-                                         QDir::currentPath(),
-                                         verboseQtLogs ? "true" : "false");
-    if (!appendDirectLineToLog(startupLogPath, startupLine)) {
+    const bool jsonLines = jsonLinesLoggingEnabled();
+    // Qt categories are already filtered by QLoggingCategory rules, so let everything they emit through by default.
+    setLogThreshold(LogCategory::Qt, LogLevel::Debug);
+    QString logFilterError;
+    configureLogFilter(qEnvironmentVariable("TV_TUNER_GUI_LOG_LEVELS"), &logFilterError);
+
+    QString logSinkError;
+    if (!startLogSink(startupLogPath, jsonLines, &logSinkError)) {
         fprintf(stderr, "tv_tuner_gui: failed to initialize log file: %s\n",
-                startupLogPath.toLocal8Bit().constData());
+                logSinkError.toLocal8Bit().constData());
+    }
+    LogRecord startupRecord;
+    startupRecord.monotonicNs = logMonotonicNowNs();
+    startupRecord.message = QString("logger initialized path=%1 cwd=%2 verboseQtLogs=%3 jsonLines=%4")
+                                .arg(startupLogPath,
+                                     QDir::currentPath(),
+                                     verboseQtLogs ? "true" : "false",
+                                     jsonLines ? "true" : "false");
+    fprintf(stderr, "%s\n", formatLogRecordText(startupRecord).toLocal8Bit().constData());
+    appendLogSinkRecord(std::move(startupRecord));
+    if (!logFilterError.isEmpty()) {
+        fprintf(stderr, "tv_tuner_gui: %s\n", logFilterError.toLocal8Bit().constData());
     }
-    fprintf(stderr, "%s\n", startupLine.toLocal8Bit().constData());
 
     qInstallMessageHandler(appendQtMessageToLog);
     if (verboseQtLogs) {
@@ -162,28 +132,40 @@ int main(int argc, char *argv[])
     QGuiApplication::setApplicationDisplayName(QStringLiteral("Voncloft TV Tuner"));
     QGuiApplication::setDesktopFileName(QStringLiteral("tv_tuner_gui"));
     QApplication app(argc, argv);
+    markStartupMilestone("qapplication-ready");
     const QIcon appIcon(":/assets/tv-icon.svg");
     app.setWindowIcon(appIcon);
-    QString displayThemeError;
-    DisplayThemeStore displayThemeStore;
-    if (!loadDisplayThemeStore(&displayThemeStore, &displayThemeError)) {
-        displayThemeStore = defaultDisplayThemeStore();
-    }
-    const DisplayTheme currentDisplayTheme = normalizedDisplayTheme(displayThemeStore.currentTheme);
-    app.setFont(
-        qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme, DisplayThemeKeys::AppFont), app.font()));
-    app.setPalette(buildApplicationPalette(currentDisplayTheme, app.palette()));
-    app.setStyleSheet(buildScrollBarStyleSheet(currentDisplayTheme) + buildSliderStyleSheet(currentDisplayTheme));
-    if (!displayThemeError.trimmed().isEmpty()) {
-        qWarning().noquote() << "display-theme:" << displayThemeError;
+    {
+        const StartupTraceScope trace("apply-startup-theme");
+        QString displayThemeError;
+        DisplayThemeStore displayThemeStore;
+        if (!loadDisplayThemeStore(&displayThemeStore, &displayThemeError)) {
+            displayThemeStore = defaultDisplayThemeStore();
+        }
+        const DisplayTheme currentDisplayTheme = normalizedDisplayTheme(displayThemeStore.currentTheme);
+        app.setFont(qFontFromDisplayFontStyle(displayThemeFontStyle(currentDisplayTheme, DisplayThemeKeys::AppFont),
+                                              app.font()));
+        app.setPalette(buildApplicationPalette(currentDisplayTheme, app.palette()));
+        app.setStyleSheet(buildScrollBarStyleSheet(currentDisplayTheme) + buildSliderStyleSheet(currentDisplayTheme));
+        if (!displayThemeError.trimmed().isEmpty()) {
+            qWarning().noquote() << "display-theme:" << displayThemeError;
+        }
     }
     qInfo() << "Startup env:"
             << "QT_QPA_PLATFORM=" << qEnvironmentVariable("QT_QPA_PLATFORM")
             << "QT_XCB_GL_INTEGRATION=" << qEnvironmentVariable("QT_XCB_GL_INTEGRATION")
             << "QT_MEDIA_BACKEND=" << qEnvironmentVariable("QT_MEDIA_BACKEND")
             << "QT_FFMPEG_DECODING_HW_DEVICE_TYPES=" << qEnvironmentVariable("QT_FFMPEG_DECODING_HW_DEVICE_TYPES");
-    MainWindow window;
-    window.setWindowIcon(appIcon);
-    window.show();
-    return app.exec();
+    int exitCode = 0;
+    {
+        // Scoped so the window's teardown logging still reaches the sink before it stops.
+        MainWindow window;
+        markStartupMilestone("main-window-constructed");
+        window.setWindowIcon(appIcon);
+        window.show();
+        markStartupMilestone("main-window-shown");
+        exitCode = app.exec();
+    }
+    stopLogSink();
+    return exitCode;
 }
@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+"""Canned Schedules Direct JSON API for exercising the guide download without an account.
+
+Point the app at it with
+
+    TV_TUNER_GUI_SCHEDULES_DIRECT_URL=http://127.0.0.1:8765/20141201 ./tv_tuner_gui
+
+and enter any username, password and ZIP code. The guide is generated deterministically from the options, so
+restarting the server with the same options serves byte-identical schedules and programs, which lets a second
+sync reuse everything it cached. --revision N changes a fixed share of the station-days and programs, the way a
+listings update would.
+
+Each POST /token starts a new run. When the next run starts, and on Ctrl-C, the server prints how many bytes it
+served per endpoint. The /schedules/md5, /schedules and /programs totals are the bodies the app counts in its
+"sync downloaded" log line.
+"""
+
+import argparse
+import datetime
+import hashlib
+import json
+import sys
+import threading
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import unquote, urlsplit
+
+SLOTS_PER_DAY = 48
+SERIES_PER_STATION = 24
+SERIES_NAMES = [
+    "Morning Report", "Kitchen Table", "Garden Hour", "City Desk", "Wild Frontier", "Ocean Lab",
+    "Mystery Lane", "History Road", "Family Court", "Classic Theater", "Sports Tonight", "Weather Watch",
+    "Science Now", "Travel Notes", "Comedy Corner", "Evening Journal", "Mountain Rescue", "River Towns",
+    "Space Files", "Desert Stories", "Island Life", "Detective Hour", "Planet Earth Live", "Late News",
+]
+
+
+def md5_of(payload):
+    return hashlib.md5(json.dumps(payload, sort_keys=True, separators=(",", ":")).encode()).hexdigest()
+
+
+class Guide:
+    def __init__(self, postal_code, station_count, day_count, revision):
+        self.lineup_id = f"USA-OTA-{postal_code}"
+        self.revision = revision
+        today = datetime.datetime.now(datetime.timezone.utc).date()
+        self.dates = [(today + datetime.timedelta(days=offset)).isoformat() for offset in range(day_count)]
+        self.stations = [
+            {
+                "stationID": str(10001 + index),
+                "name": f"Standin {index + 1}",
+                "callsign": f"W{chr(65 + index // 26 % 26)}{chr(65 + index % 26)}D",
+                "affiliate": "IND",
+            }
+            for index in range(station_count)
+        ]
+        self.programs = {}
+        self.days = {}
+        for station_index, station in enumerate(self.stations):
+            for day_index, date in enumerate(self.dates):
+                self.days[(station["stationID"], date)] = self._build_day(station_index, day_index, date)
+
+    def _changed(self, *key, share):
+        # Revision 0 is the baseline; each later revision picks its own deterministic subset.
+        if self.revision == 0:
+            return False
+        digest = hashlib.sha1(repr((self.revision,) + key).encode()).digest()
+        return int.from_bytes(digest[:4], "big") % share == 0
+
+    def _program(self, station_index, series, episode):
+        program_id = f"EP{station_index:04d}{series:02d}{episode:04d}"
+        if program_id not in self.programs:
+            title = SERIES_NAMES[series % len(SERIES_NAMES)]
+            description = (f"{title} episode {episode + 1}: a standalone story generated for station "
+                           f"{station_index + 1}, with enough text to look like a real listing description.")
+            if self._changed("program", program_id, share=50):
+                description += f" Updated in revision {self.revision}."
+            program = {
+                "programID": program_id,
+                "titles": [{"title120": title}],
+                "episodeTitle150": f"Episode {episode + 1}",
+                "descriptions": {"description1000": [{"descriptionLanguage": "en", "description": description}]},
+                "originalAirDate": "2020-01-01",
+                "genres": ["Series"],
+                "entityType": "Episode",
+                "showType": "Series",
+            }
+            program["md5"] = md5_of(program)
+            self.programs[program_id] = program
+        return self.programs[program_id]
+
+    def _build_day(self, station_index, day_index, date):
+        airings = []
+        start = datetime.datetime.fromisoformat(date).replace(tzinfo=datetime.timezone.utc)
+        day_changed = self._changed("day", station_index, date, share=10)
+        for slot in range(0, SLOTS_PER_DAY, 2):
+            series = (slot // 2 + station_index) % SERIES_PER_STATION
+            # Overnight slots rerun yesterday's episode; a changed day swaps one airing for a fresh episode.
+            episode = day_index - 1 if slot < 12 and day_index > 0 else day_index
+            if day_changed and slot == 2 * ((station_index + day_index) % (SLOTS_PER_DAY // 2)):
+                episode = 1000 + day_index
+            program = self._program(station_index, series, episode)
+            airings.append({
+                "programID": program["programID"],
+                "airDateTime": (start + datetime.timedelta(minutes=30 * slot)).strftime("%Y-%m-%dT%H:%M:%SZ"),
+                "duration": 3600,
+                "md5": program["md5"],
+            })
+        day = {"stationID": self.stations[station_index]["stationID"], "programs": airings}
+        day["metadata"] = {"modified": f"{date}T00:00:00Z", "md5": md5_of(day), "startDate": date}
+        return day
+
+    def lineup(self):
+        return {
+            "map": [
+                {"stationID": station["stationID"], "channel": f"{index + 2}.1", "uhfVhf": index + 14}
+                for index, station in enumerate(self.stations)
+            ],
+            "stations": self.stations,
+            "metadata": {"lineup": self.lineup_id, "modified": f"{self.dates[0]}T00:00:00Z", "transport": "Antenna"},
+        }
+
+
+class RunStats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.run = 0
+        self.endpoints = {}
+
+    def start_run(self):
+        with self.lock:
+            self._report_locked()
+            self.run += 1
+            self.endpoints = {}
+
+    def record(self, endpoint, body_bytes):
+        with self.lock:
+            requests, total = self.endpoints.get(endpoint, (0, 0))
+            self.endpoints[endpoint] = (requests + 1, total + body_bytes)
+
+    def report(self):
+        with self.lock:
+            self._report_locked()
+
+    def _report_locked(self):
+        if self.run == 0 or not self.endpoints:
+            return
+        sync_bytes = 0
+        print(f"run {self.run}:", flush=True)
+        for endpoint, (requests, total) in sorted(self.endpoints.items()):
+            print(f"  {endpoint:<16} {requests:>4} requests {total:>10} bytes", flush=True)
+            if endpoint in ("/schedules/md5", "/schedules", "/programs"):
+                sync_bytes += total
+        print(f"  schedules+programs {sync_bytes} bytes ({(sync_bytes + 1023) // 1024} KiB)", flush=True)
+        self.endpoints = {}
+
+
+def make_handler(guide, stats, postal_code):
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def log_message(self, format, *args):
+            pass
+
+        def _read_json(self):
+            length = int(self.headers.get("Content-Length") or 0)
+            raw = self.rfile.read(length) if length > 0 else b""
+            return json.loads(raw) if raw.strip() else None
+
+        def _send(self, endpoint, payload, status=200):
+            body = json.dumps(payload, separators=(",", ":")).encode()
+            self.send_response(status)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+            stats.record(endpoint, len(body))
+
+        def _endpoint(self):
+            path = urlsplit(self.path).path.rstrip("/")
+            for endpoint in ("/token", "/status", "/headends", "/schedules/md5", "/schedules", "/programs"):
+                if path.endswith(endpoint):
+                    return endpoint, ""
+            marker = "/lineups/"
+            if marker in path:
+                return "/lineups", unquote(path.split(marker, 1)[1])
+            return path, ""
+
+        def _require_token(self):
+            if self.headers.get("token") == "standin-token":
+                return True
+            self._send("error", {"code": 4006, "message": "Token expired or invalid."}, status=403)
+            return False
+
+        def do_POST(self):
+            endpoint, _ = self._endpoint()
+            request = self._read_json()
+            if endpoint == "/token":
+                stats.start_run()
+                self._send(endpoint, {"code": 0, "message": "OK", "token": "standin-token",
+                                      "tokenExpires": 4102444800})
+                return
+            if not self._require_token():
+                return
+            stations = [entry.get("stationID", "") for entry in request or []] if endpoint != "/programs" else []
+            if endpoint == "/schedules/md5":
+                response = {}
+                for station_id in stations:
+                    response[station_id] = {
+                        date: {"code": 0, "message": "OK", "lastModified": f"{date}T00:00:00Z",
+                               "md5": guide.days[(station_id, date)]["metadata"]["md5"]}
+                        for date in guide.dates if (station_id, date) in guide.days
+                    }
+                self._send(endpoint, response)
+            elif endpoint == "/schedules":
+                response = []
+                for entry in request or []:
+                    dates = entry.get("date") or guide.dates
+                    for date in dates:
+                        day = guide.days.get((entry.get("stationID", ""), date))
+                        if day is not None:
+                            response.append(day)
+                self._send(endpoint, response)
+            elif endpoint == "/programs":
+                self._send(endpoint, [guide.programs[program_id] for program_id in request or []
+                                      if program_id in guide.programs])
+            else:
+                self._send(endpoint, {"code": 2000, "message": f"Unknown endpoint {endpoint}"}, status=404)
+
+        def do_GET(self):
+            endpoint, lineup_id = self._endpoint()
+            if not self._require_token():
+                return
+            if endpoint == "/status":
+                self._send(endpoint, {"code": 0, "account": {"maxLineups": 4},
+                                      "lineups": [{"lineup": guide.lineup_id}]})
+            elif endpoint == "/headends":
+                self._send(endpoint, [{"headend": postal_code, "transport": "Antenna", "location": postal_code,
+                                       "lineups": [{"name": "Antenna", "lineup": guide.lineup_id}]}])
+            elif endpoint == "/lineups" and lineup_id == guide.lineup_id:
+                self._send(endpoint, guide.lineup())
+            else:
+                self._send(endpoint, {"code": 2100, "message": f"Unknown lineup {lineup_id}"}, status=404)
+
+        def do_PUT(self):
+            endpoint, _ = self._endpoint()
+            self._read_json()
+            if self._require_token():
+                self._send(endpoint, {"code": 0, "response": "OK", "changesRemaining": 5})
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8765)
+    parser.add_argument("--postal-code", default="12345", help="ZIP code the headend lookup answers for")
+    parser.add_argument("--stations", type=int, default=20)
+    parser.add_argument("--days", type=int, default=14)
+    parser.add_argument("--revision", type=int, default=0,
+                        help="0 serves the baseline guide; higher values change a fixed share of days and programs")
+    args = parser.parse_args()
+
+    guide = Guide(args.postal_code, args.stations, args.days, args.revision)
+    stats = RunStats()
+    server = ThreadingHTTPServer((args.host, args.port), make_handler(guide, stats, args.postal_code))
+    print(f"serving {len(guide.stations)} stations x {len(guide.dates)} days, {len(guide.programs)} programs, "
+          f"revision {args.revision} on http://{args.host}:{args.port}/20141201", flush=True)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        stats.report()
+        server.server_close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())